@@ -7,23 +7,47 @@
 #include "Application.h"
 #include "Window_Desktop_Procedure.h"
 
+#include "Graphics_Backend.h"
 #include "Graphics_DirectX11.h"
 #include "Graphics_DirectX12.h"
+#include "Graphics_Software.h"
+#include "Graphics_Null.h"
 
+#include "Memory_FrameArena.h"
+#include "Memory_Tracker.h"
 #include "Object_Cube.h"
+#include "Profiler.h"
 
 /* graphics class instance */
 IGraphics*                  Application::m_graphics = nullptr;
 Application::USING_API_TYPE Application::m_apiType;
+float                       Application::m_interpolation = 1.0f;
 
 ObjectCube* g_Cube;
 
 
+#if GRAPHICS_BACKEND == GRAPHICS_BACKEND_DIRECTX11
+static const Application::USING_API_TYPE k_staticApiType = Application::USING_API_TYPE::DIRECTX_11;
+#elif GRAPHICS_BACKEND == GRAPHICS_BACKEND_DIRECTX12
+static const Application::USING_API_TYPE k_staticApiType = Application::USING_API_TYPE::DIRECTX_12;
+#elif GRAPHICS_BACKEND == GRAPHICS_BACKEND_SOFTWARE
+static const Application::USING_API_TYPE k_staticApiType = Application::USING_API_TYPE::SOFTWARE;
+#elif GRAPHICS_BACKEND == GRAPHICS_BACKEND_NULL
+static const Application::USING_API_TYPE k_staticApiType = Application::USING_API_TYPE::NULL_DEVICE;
+#endif
+
+
 /* Constructor */
 Application::Application(const int width, const int height, const void* hInstance, USING_API_TYPE type)
     : WindowDesktop(width, height, (HINSTANCE)hInstance, L"Application", DefMyWndProc)
 {
+#if GRAPHICS_BACKEND_STATIC
+    // The build decides, type is kept so callers compile in both modes
+    (void)type;
+    m_apiType = k_staticApiType;
+#else
     m_apiType = type;
+#endif
 }
 
 /* Destructor */
@@ -36,6 +60,9 @@ Application::~Application()
 /* Initialize */
 bool Application::Init()
 {
+#if GRAPHICS_BACKEND_STATIC
+    m_graphics = new StaticGraphics();
+#else
     switch (m_apiType)
     {
     case Application::USING_API_TYPE::DIRECTX_11:
@@ -46,9 +73,16 @@ bool Application::Init()
         break;
     case Application::USING_API_TYPE::OPENGL:
         break;
+    case Application::USING_API_TYPE::SOFTWARE:
+        m_graphics = new GraphicsSoftware();
+        break;
+    case Application::USING_API_TYPE::NULL_DEVICE:
+        m_graphics = new GraphicsNull();
+        break;
     default:
         break;
     }
+#endif
 
     if (!m_graphics) 
         return false;
@@ -77,16 +111,38 @@ void Application::Uninit()
 /* Update */
 void Application::Upadte()
 {
+    PROFILE_SCOPE("Application::Update");
+    MEMORY_TAG("Application::Update");
+
+    g_Cube->Update();
 }
 
 /* Draw */
-void Application::Draw()
+void Application::Draw(const float interpolation)
 {
-    m_graphics->Clear();
+    PROFILE_SCOPE("Application::Draw");
+    MEMORY_TAG("Application::Draw");
+    m_interpolation = interpolation;
+
+    // Direct calls when the backend is fixed, virtual otherwise
+    StaticGraphics* graphics = static_cast<StaticGraphics*>(m_graphics);
+    graphics->Clear();
+
+    {
+        PROFILE_SCOPE("Application::DrawObjects");
+        g_Cube->Draw();
+    }
 
-    g_Cube->Draw();
+    graphics->Present();
+    PROFILE_FRAME();
+    FrameArena::Shared().NextFrame();
+    MemoryTracker::NextFrame();
+}
 
-    m_graphics->Present();
+/* Idle */
+bool Application::Idle()
+{
+    return this->Minimized() || (m_graphics && m_graphics->Occluded());
 }
 
 /* Get graphics class pointer */
@@ -100,3 +156,9 @@ Application::USING_API_TYPE Application::Get()
 {
     return m_apiType;
 }
+
+/* Get interpolation factor */
+float Application::Interpolation()
+{
+    return m_interpolation;
+}
@@ -19,6 +19,8 @@ public:
 		DIRECTX_11,
 		DIRECTX_12,
 		OPENGL,
+		SOFTWARE,
+		NULL_DEVICE,
 	};
 
 public:
@@ -69,9 +71,18 @@ public:
 	//**************************************************
 	/// \brief Draw in application window
 	///  
+	/// \param[in] interpolation ->	blend factor between last two updates
+	/// 
 	/// \return none
 	//**************************************************
-	void Draw();
+	void Draw(const float interpolation = 1.0f);
+
+	//**************************************************
+	/// \brief Check nothing has to be drawn (minimized or occluded)
+	///  
+	/// \return if idle then true
+	//**************************************************
+	bool Idle();
 
 	//**************************************************
 	/// \brief Graphics class pointer
@@ -87,8 +98,16 @@ public:
 	//**************************************************
 	static USING_API_TYPE Get();
 
+	//**************************************************
+	/// \brief Get interpolation factor of current draw
+	///  
+	/// \return blend factor between last two updates
+	//**************************************************
+	static float Interpolation();
+
 private:
 	static IGraphics*		m_graphics;
 	static USING_API_TYPE	m_apiType;
+	static float			m_interpolation;
 };
 
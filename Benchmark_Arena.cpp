@@ -0,0 +1,112 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Arena.cpp
+*		Detail	: Per thread transient lists, heap vectors against FrameArena
+===================================================================================*/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#include "Benchmark_Report.h"
+#include "Memory_FrameArena.h"
+#include "Memory_Tracker.h"
+#include "Thread_Pool.h"
+
+#include "Benchmark_Arena.h"
+
+/* Run */
+bool BenchmarkArena::Run(const Config& config, Result* result)
+{
+	*result = Result{};
+
+	// Culling style output, every job appends an unknown number of indices
+	const size_t itemNum	= (std::max)(size_t(config.ItemNum), size_t(1));
+	const size_t jobNum		= (std::max)(size_t(config.JobNum), size_t(1));
+	const int frameNum		= int((std::max)(config.FrameNum, 1u));
+	const int warmupNum		= int(config.WarmupFrameNum);
+	std::atomic<uint64_t> checksum{ 0 };
+	auto build = [&](auto& list, size_t job)
+	{
+		for (size_t i = job; i < itemNum; i += jobNum)
+			list.push_back(uint32_t(i));
+
+		uint64_t sum = 0;
+		for (uint32_t item : list)
+			sum += item;
+		checksum.fetch_add(sum, std::memory_order_relaxed);
+	};
+
+	double seconds = 0.0;
+	uint64_t allocations = MemoryTracker::Total().Count;
+	for (int frame = 0; frame < frameNum; ++frame)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		ThreadPool::Shared().ParallelFor(jobNum, [&](size_t job)
+		{
+			std::vector<uint32_t> list;
+			build(list, job);
+		});
+		seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+	result->HeapMilliseconds			= seconds * 1e3 / frameNum;
+	result->HeapAllocationsPerFrame		= double(MemoryTracker::Total().Count - allocations) / frameNum;
+
+	// Small blocks, warmup frames grow them to the working set
+	FrameArena arena(4 * 1024, 2);
+	seconds = 0.0;
+	for (int frame = -warmupNum; frame < frameNum; ++frame)
+	{
+		if (frame == 0)
+			allocations = MemoryTracker::Total().Count;
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		ThreadPool::Shared().ParallelFor(jobNum, [&](size_t job)
+		{
+			FrameVector<uint32_t> list{ FrameAllocator<uint32_t>(arena) };
+			build(list, job);
+		});
+		arena.NextFrame();
+		if (frame >= 0)
+			seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+	result->FrameMilliseconds			= seconds * 1e3 / frameNum;
+	result->FrameAllocationsPerFrame	= double(MemoryTracker::Total().Count - allocations) / frameNum;
+
+	const FrameArena::Statistics statistics = arena.GetStatistics();
+	result->ArenaBytes		= double(statistics.Bytes);
+	result->ArenaCapacity	= double(statistics.Capacity);
+
+	// Both passes sum every item once per frame
+	const uint64_t frameSum = uint64_t(itemNum) * (itemNum - 1) / 2;
+	return checksum.load() == frameSum * uint64_t(2 * frameNum + warmupNum);
+}
+
+/* Entry point */
+int BenchmarkArena::Main(const char* commandLine)
+{
+	Config config;
+	std::string value;
+	if (BenchmarkReport::FindOption(commandLine, "items", value))	config.ItemNum			= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "jobs", value))	config.JobNum			= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "frames", value))	config.FrameNum			= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "warmup", value))	config.WarmupFrameNum	= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+
+	Result result;
+	const bool success = BenchmarkArena::Run(config, &result);
+
+	using GATE = BenchmarkReport::GATE;
+	BenchmarkReport report("arena");
+	report.Add("items", config.ItemNum, 0);
+	report.Add("jobs", config.JobNum, 0);
+	report.Add("frames", config.FrameNum, 0);
+	report.Add("arena_heap_ms", result.HeapMilliseconds, 4);
+	report.Add("arena_frame_ms", result.FrameMilliseconds, 4, GATE::LOWER);
+	report.Add("arena_heap_allocs_per_frame", result.HeapAllocationsPerFrame, 1);
+	report.Add("arena_frame_allocs_per_frame", result.FrameAllocationsPerFrame, 1, GATE::COUNT);
+	report.Add("arena_bytes_per_frame", result.ArenaBytes, 0);
+	report.Add("arena_capacity", result.ArenaCapacity, 0);
+	return report.Finish(commandLine, success ? 0 : 1);
+}
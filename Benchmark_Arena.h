@@ -0,0 +1,58 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Arena.h
+*		Detail	: Per thread transient lists, heap vectors against FrameArena
+===================================================================================*/
+#pragma once
+
+class BenchmarkArena
+{
+public:
+	//**************************************************
+	/// \brief Workload parameters
+	//**************************************************
+	struct Config
+	{
+		unsigned int	ItemNum			= 200000;	// indices appended over all jobs per frame
+		unsigned int	JobNum			= 64;		// ThreadPool::Shared jobs per frame
+		unsigned int	FrameNum		= 64;		// measured frames
+		unsigned int	WarmupFrameNum	= 8;		// arena frames before measuring, the blocks grow
+	};
+
+	//**************************************************
+	/// \brief Measured values
+	//**************************************************
+	struct Result
+	{
+		double	HeapMilliseconds;			// frame of lists built with std::vector
+		double	FrameMilliseconds;			// same lists in FrameVector
+		double	HeapAllocationsPerFrame;
+		double	FrameAllocationsPerFrame;	// 0 once the blocks grew during warmup
+		double	ArenaBytes;					// requested in the last frame
+		double	ArenaCapacity;				// bytes of the blocks of every frame
+	};
+
+public:
+	//**************************************************
+	/// \brief Build the lists on ThreadPool::Shared both ways
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool Run(
+		const Config& config,
+		Result* result
+	);
+
+	//**************************************************
+	/// \brief Benchmark entry point, the arena time and allocation count are
+	///        gated against a baseline
+	///        -items= -jobs= -frames= -warmup=
+	///        -out=arena.json -baseline=old.json -tolerance=0.1
+	///
+	/// \param[in] commandLine	 ->	options
+	///
+	/// \return process exit code, non zero on failure or regression
+	//**************************************************
+	static int Main(const char* commandLine);
+};
@@ -0,0 +1,113 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Bvh.cpp
+*		Detail	: SceneBvh build, frustum and ray queries against brute force
+===================================================================================*/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "Benchmark_Report.h"
+#include "Scene_Bvh.h"
+
+#include "Benchmark_Bvh.h"
+using namespace DirectX;
+
+/* Run */
+bool BenchmarkBvh::Run(const Config& config, Result* result)
+{
+	*result = Result{};
+
+	// Unit sized boxes in a cube that keeps the density constant, camera at the center
+	const size_t objectNum	= (std::max)(size_t(config.ObjectNum), size_t(1));
+	const float extent		= 4.0f * std::cbrt(float(objectNum));
+	std::mt19937 random(config.Seed);
+	std::uniform_real_distribution<float> position(-extent, extent);
+	std::uniform_real_distribution<float> size(0.1f, 1.0f);
+	std::vector<structure::Bounds> bounds(objectNum);
+	for (structure::Bounds& box : bounds)
+	{
+		const XMFLOAT3 center(position(random), position(random), position(random));
+		const float half = size(random);
+		box = structure::Bounds{ { center.x - half, center.y - half, center.z - half }, { center.x + half, center.y + half, center.z + half } };
+	}
+
+	SceneBvh bvh;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	bvh.Build(bounds.data(), bounds.size());
+	result->BuildMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	XMFLOAT4X4 viewProjection;
+	XMStoreFloat4x4(&viewProjection,
+		XMMatrixLookAtLH(XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), XMVectorSet(0.3f, 0.1f, 1.0f, 1.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f)) *
+		XMMatrixPerspectiveFovLH(XM_PI / 3.0f, 16.0f / 9.0f, 0.1f, extent));
+
+	const int repeat = 10;
+	std::vector<uint32_t> visible, bruteVisible;
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < repeat; ++i)
+		bvh.Cull(viewProjection, &visible);
+	result->CullMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / repeat;
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < repeat; ++i)
+		SceneBvh::CullBruteForce(bounds.data(), bounds.size(), viewProjection, &bruteVisible);
+	result->BruteCullMilliseconds	= std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / repeat;
+	result->VisibleNum				= double(visible.size());
+
+	// Picking rays of a fixed length, brute force takes a subset since it is linear per ray
+	std::vector<structure::Ray> rays((std::max)(config.RayNum, 1u));
+	std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+	for (structure::Ray& ray : rays)
+		ray = structure::Ray{ { position(random), position(random), position(random) }, { direction(random), direction(random), direction(random) }, extent * 0.25f };
+	std::vector<structure::RayHit> hits(rays.size()), bruteHits(rays.size());
+	start = std::chrono::steady_clock::now();
+	bvh.Raycast(rays.data(), rays.size(), hits.data());
+	result->MegaraysPerSecond = double(rays.size()) / 1e6 / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	const size_t bruteRays = (std::max)((std::min)(size_t(4096 * 10000) / objectNum, rays.size()), size_t(1));
+	start = std::chrono::steady_clock::now();
+	SceneBvh::RaycastBruteForce(bounds.data(), bounds.size(), rays.data(), bruteRays, bruteHits.data());
+	result->BruteMegaraysPerSecond = double(bruteRays) / 1e6 / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	// Both paths run the same tests, any difference is a traversal bug
+	std::sort(visible.begin(), visible.end());
+	std::sort(bruteVisible.begin(), bruteVisible.end());
+	bool match = visible == bruteVisible;
+	for (size_t i = 0; i < bruteRays; ++i)
+		match = match && (hits[i].Object == SceneBvh::k_invalid) == (bruteHits[i].Object == SceneBvh::k_invalid) && hits[i].Distance == bruteHits[i].Distance;
+	if (!match)
+		std::printf("bvh: queries differ from brute force\n");
+
+	return match;
+}
+
+/* Entry point */
+int BenchmarkBvh::Main(const char* commandLine)
+{
+	Config config;
+	std::string value;
+	if (BenchmarkReport::FindOption(commandLine, "objects", value))	config.ObjectNum	= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "rays", value))	config.RayNum		= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "seed", value))	config.Seed			= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+
+	Result result;
+	const bool success = BenchmarkBvh::Run(config, &result);
+
+	using GATE = BenchmarkReport::GATE;
+	BenchmarkReport report("bvh");
+	report.Add("objects", config.ObjectNum, 0);
+	report.Add("rays", config.RayNum, 0);
+	report.Add("seed", config.Seed, 0);
+	report.Add("visible", result.VisibleNum, 0);
+	report.Add("bvh_build_ms", result.BuildMilliseconds, 3, GATE::LOWER);
+	report.Add("bvh_cull_ms", result.CullMilliseconds, 4, GATE::LOWER);
+	report.Add("brute_cull_ms", result.BruteCullMilliseconds, 4);
+	report.Add("bvh_mrays_per_s", result.MegaraysPerSecond, 3, GATE::HIGHER);
+	report.Add("brute_mrays_per_s", result.BruteMegaraysPerSecond, 5);
+	return report.Finish(commandLine, success ? 0 : 1);
+}
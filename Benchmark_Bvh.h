@@ -0,0 +1,56 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Bvh.h
+*		Detail	: SceneBvh build, frustum and ray queries against brute force
+===================================================================================*/
+#pragma once
+
+class BenchmarkBvh
+{
+public:
+	//**************************************************
+	/// \brief Workload parameters
+	//**************************************************
+	struct Config
+	{
+		unsigned int	ObjectNum	= 100000;	// boxes, the volume grows to keep the density
+		unsigned int	RayNum		= 4096;		// picking rays
+		unsigned int	Seed		= 1;
+	};
+
+	//**************************************************
+	/// \brief Measured values
+	//**************************************************
+	struct Result
+	{
+		double	BuildMilliseconds;
+		double	CullMilliseconds;			// one frustum query
+		double	BruteCullMilliseconds;		// same query testing every object
+		double	VisibleNum;					// objects in the frustum
+		double	MegaraysPerSecond;			// nearest hit
+		double	BruteMegaraysPerSecond;		// on a subset, brute force is linear per ray
+	};
+
+public:
+	//**************************************************
+	/// \brief Build the hierarchy over random boxes and query it
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool Run(
+		const Config& config,
+		Result* result
+	);
+
+	//**************************************************
+	/// \brief Benchmark entry point, the hierarchy timings are gated against a baseline
+	///        -objects= -rays= -seed=
+	///        -out=bvh.json -baseline=old.json -tolerance=0.1
+	///
+	/// \param[in] commandLine	 ->	options
+	///
+	/// \return process exit code, non zero on failure, mismatch or regression
+	//**************************************************
+	static int Main(const char* commandLine);
+};
@@ -0,0 +1,91 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Compress.cpp
+*		Detail	: TextureCompressor speed and quality on a generated image
+===================================================================================*/
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "Benchmark_Report.h"
+#include "Texture_Compressor.h"
+
+#include "Benchmark_Compress.h"
+
+/* Run */
+bool BenchmarkCompress::Run(const Config& config, Result* result)
+{
+	*result = Result{};
+
+	TextureCompressor::QUALITY quality = TextureCompressor::QUALITY::NORMAL;
+	if (config.Quality == "fast")	quality = TextureCompressor::QUALITY::FAST;
+	if (config.Quality == "high")	quality = TextureCompressor::QUALITY::HIGH;
+
+	// Smooth gradients, hard edges and noise, alpha varies slowly
+	const uint32_t size = (std::max)(config.Size & ~3u, 4u);
+	std::vector<uint8_t> image(size_t(size) * size * 4);
+	std::mt19937 random(config.Seed);
+	std::uniform_int_distribution<int> noise(-8, 8);
+	for (uint32_t y = 0; y < size; ++y)
+	{
+		for (uint32_t x = 0; x < size; ++x)
+		{
+			uint8_t* pixel = &image[(size_t(y) * size + x) * 4];
+			pixel[0] = uint8_t((std::min)((std::max)(int(x / 4) + noise(random), 0), 255));
+			pixel[1] = uint8_t(((x / 64 + y / 64) & 1) ? 200 : 48);
+			pixel[2] = uint8_t((x * y) >> 12);
+			pixel[3] = uint8_t(y / 4);
+		}
+	}
+
+	auto measure = [&](const TextureFile::FORMAT format, double* megapixels, double* psnr)
+	{
+		std::vector<uint8_t> blocks, decoded;
+		double best = 0.0;
+		for (unsigned int i = 0; i < (std::max)(config.RunNum, 1u); ++i)
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			if (!TextureCompressor::Compress(image.data(), size, size, size * 4, format, quality, &blocks))
+				return false;
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			best = (std::max)(best, double(size) * size / 1e6 / seconds);
+		}
+		if (!TextureCompressor::Decompress(blocks.data(), size, size, format, &decoded))
+			return false;
+		*megapixels	= best;
+		*psnr		= TextureCompressor::Psnr(image.data(), decoded.data(), size_t(size) * size, TextureCompressor::ChannelNum(format));
+		return true;
+	};
+	return
+		measure(TextureFile::FORMAT::BC1_UNORM, &result->Bc1MegapixelsPerSecond, &result->Bc1Psnr) &&
+		measure(TextureFile::FORMAT::BC7_UNORM, &result->Bc7MegapixelsPerSecond, &result->Bc7Psnr);
+}
+
+/* Entry point */
+int BenchmarkCompress::Main(const char* commandLine)
+{
+	Config config;
+	std::string value;
+	if (BenchmarkReport::FindOption(commandLine, "quality", value))	config.Quality	= value;
+	if (BenchmarkReport::FindOption(commandLine, "size", value))	config.Size		= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "runs", value))	config.RunNum	= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "seed", value))	config.Seed		= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+
+	Result result;
+	const bool success = BenchmarkCompress::Run(config, &result);
+
+	// Psnr of the fixed image is gated too, a quality drop is a regression
+	using GATE = BenchmarkReport::GATE;
+	BenchmarkReport report("compress");
+	report.AddText("quality", config.Quality);
+	report.Add("size", config.Size, 0);
+	report.Add("seed", config.Seed, 0);
+	report.Add("bc1_mpix_per_s", result.Bc1MegapixelsPerSecond, 2, GATE::HIGHER);
+	report.Add("bc1_psnr", result.Bc1Psnr, 2, GATE::HIGHER);
+	report.Add("bc7_mpix_per_s", result.Bc7MegapixelsPerSecond, 2, GATE::HIGHER);
+	report.Add("bc7_psnr", result.Bc7Psnr, 2, GATE::HIGHER);
+	return report.Finish(commandLine, success ? 0 : 1);
+}
@@ -0,0 +1,56 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Compress.h
+*		Detail	: TextureCompressor speed and quality on a generated image
+===================================================================================*/
+#pragma once
+#include <string>
+
+class BenchmarkCompress
+{
+public:
+	//**************************************************
+	/// \brief Workload parameters
+	//**************************************************
+	struct Config
+	{
+		std::string		Quality		= "normal";	// "fast", "normal" or "high"
+		unsigned int	Size		= 1024;		// image width and height, multiple of 4
+		unsigned int	RunNum		= 3;		// best of
+		unsigned int	Seed		= 1;
+	};
+
+	//**************************************************
+	/// \brief Measured values
+	//**************************************************
+	struct Result
+	{
+		double	Bc1MegapixelsPerSecond;
+		double	Bc1Psnr;					// dB over RGB
+		double	Bc7MegapixelsPerSecond;
+		double	Bc7Psnr;					// dB over RGBA
+	};
+
+public:
+	//**************************************************
+	/// \brief Compress the image to BC1 and BC7, decode for the error
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool Run(
+		const Config& config,
+		Result* result
+	);
+
+	//**************************************************
+	/// \brief Benchmark entry point, speed and psnr are gated against a baseline
+	///        -quality=fast|normal|high -size= -runs= -seed=
+	///        -out=compress.json -baseline=old.json -tolerance=0.1
+	///
+	/// \param[in] commandLine	 ->	options
+	///
+	/// \return process exit code, non zero on failure or regression
+	//**************************************************
+	static int Main(const char* commandLine);
+};
@@ -0,0 +1,97 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Dispatch.cpp
+*		Detail	: Per draw cost of virtual against compile time backend calls
+===================================================================================*/
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+#include "Benchmark_Report.h"
+#include "Benchmark_Scene.h"
+#include "Graphics_Null.h"
+#include "Graphics_Software.h"
+
+#include "Benchmark_Dispatch.h"
+
+/* Run */
+bool BenchmarkDispatch::Run(const Config& config, Result* result)
+{
+	*result = Result{};
+
+	IGraphics* graphics = nullptr;
+	if (config.Backend == "software")
+		graphics = new GraphicsSoftware();
+	else
+		graphics = new GraphicsNull();
+
+	BenchmarkScene::Config sceneConfig;
+	sceneConfig.Backend		= config.Backend;
+	sceneConfig.ObjectNum	= config.ObjectNum;
+	sceneConfig.Seed		= config.Seed;
+
+	if (!graphics->Init(sceneConfig.Width, sceneConfig.Height, nullptr))
+	{
+		delete graphics;
+		return false;
+	}
+
+	BenchmarkScene scene;
+	if (!scene.Init(sceneConfig, graphics))
+	{
+		graphics->Uninit();
+		delete graphics;
+		return false;
+	}
+
+	// The same submission loop instantiated for the interface and for the final class
+	ICommandContext* context = (ICommandContext*)graphics->Context();
+	auto measure = [&](auto* target)
+	{
+		double best = 1e30;
+		for (unsigned int run = 0; run < (std::max)(config.RunNum, 1u); ++run)
+		{
+			graphics->Clear();
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			scene.Submit(target);
+			best = (std::min)(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+			graphics->Present();
+		}
+		return best * 1e9 / double((std::max)(config.ObjectNum, 1u));
+	};
+
+	result->VirtualNanoseconds = measure(context);
+	if (config.Backend == "software")
+		result->StaticNanoseconds = measure(static_cast<GraphicsSoftware*>(context));
+	else
+		result->StaticNanoseconds = measure(static_cast<GraphicsNull*>(context));
+
+	scene.Uninit();
+	graphics->Uninit();
+	delete graphics;
+	return true;
+}
+
+/* Entry point */
+int BenchmarkDispatch::Main(const char* commandLine)
+{
+	Config config;
+	std::string value;
+	if (BenchmarkReport::FindOption(commandLine, "backend", value))	config.Backend		= value;
+	if (BenchmarkReport::FindOption(commandLine, "objects", value))	config.ObjectNum	= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "runs", value))	config.RunNum		= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "seed", value))	config.Seed			= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+
+	Result result;
+	const bool success = BenchmarkDispatch::Run(config, &result);
+
+	using GATE = BenchmarkReport::GATE;
+	BenchmarkReport report("dispatch");
+	report.AddText("backend", config.Backend);
+	report.Add("objects", config.ObjectNum, 0);
+	report.Add("seed", config.Seed, 0);
+	report.Add("dispatch_virtual_ns_per_draw", result.VirtualNanoseconds, 3);
+	report.Add("dispatch_static_ns_per_draw", result.StaticNanoseconds, 3, GATE::LOWER);
+	return report.Finish(commandLine, success ? 0 : 1);
+}
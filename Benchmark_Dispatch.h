@@ -0,0 +1,54 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Dispatch.h
+*		Detail	: Per draw cost of virtual against compile time backend calls
+===================================================================================*/
+#pragma once
+#include <string>
+
+class BenchmarkDispatch
+{
+public:
+	//**************************************************
+	/// \brief Workload parameters, the scene is the default BenchmarkScene
+	//**************************************************
+	struct Config
+	{
+		std::string		Backend		= "null";	// "null" or "software"
+		unsigned int	ObjectNum	= 10000;
+		unsigned int	RunNum		= 20;		// best of
+		unsigned int	Seed		= 1;
+	};
+
+	//**************************************************
+	/// \brief Measured values
+	//**************************************************
+	struct Result
+	{
+		double	VirtualNanoseconds;		// per object submission through ICommandContext
+		double	StaticNanoseconds;		// same submission through the final backend class
+	};
+
+public:
+	//**************************************************
+	/// \brief Submit the scene through both instantiations of BenchmarkScene::Submit
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool Run(
+		const Config& config,
+		Result* result
+	);
+
+	//**************************************************
+	/// \brief Benchmark entry point, the static path is gated against a baseline
+	///        -backend=null|software -objects= -runs= -seed=
+	///        -out=dispatch.json -baseline=old.json -tolerance=0.1
+	///
+	/// \param[in] commandLine	 ->	options
+	///
+	/// \return process exit code, non zero on failure or regression
+	//**************************************************
+	static int Main(const char* commandLine);
+};
@@ -0,0 +1,108 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Import.cpp
+*		Detail	: MeshImporter throughput of a file or of generated OBJ text
+===================================================================================*/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "Benchmark_Report.h"
+#include "Mesh_Importer.h"
+
+#include "Benchmark_Import.h"
+
+namespace
+{
+	//**************************************************
+	/// \brief Rolling grid as OBJ text with positions, normals and uvs
+	//**************************************************
+	std::string GenerateObj(const unsigned int triangleNum)
+	{
+		const unsigned int side = (std::max)((unsigned int)(std::sqrt(double(triangleNum) * 0.5)), 1u);
+		std::string text;
+		text.reserve(size_t(side + 1) * (side + 1) * 96 + size_t(side) * side * 80);
+
+		char line[128];
+		for (unsigned int y = 0; y <= side; ++y)
+		{
+			for (unsigned int x = 0; x <= side; ++x)
+			{
+				const float u = float(x) / float(side), v = float(y) / float(side);
+				std::snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvn 0 0 1\nvt %.6f %.6f\n", u, v, 0.05f * std::sin(u * 23.0f), u, v);
+				text += line;
+			}
+		}
+		for (unsigned int y = 0; y < side; ++y)
+		{
+			for (unsigned int x = 0; x < side; ++x)
+			{
+				const unsigned int i0 = y * (side + 1) + x + 1, i1 = i0 + 1, i2 = i0 + side + 1, i3 = i2 + 1;
+				std::snprintf(line, sizeof(line), "f %u/%u/%u %u/%u/%u %u/%u/%u %u/%u/%u\n", i0, i0, i0, i1, i1, i1, i3, i3, i3, i2, i2, i2);
+				text += line;
+			}
+		}
+		return text;
+	}
+}
+
+/* Run */
+bool BenchmarkImport::Run(const Config& config, Result* result)
+{
+	*result = Result{};
+
+	std::vector<uint8_t> data;
+	std::string text;
+	const std::wstring fileName(config.FileName.begin(), config.FileName.end());
+	if (config.FileName.empty())
+		text = GenerateObj(config.TriangleNum);
+	else if (!MeshImporter::ReadFile(fileName.c_str(), &data))
+		return false;
+
+	const size_t bytes = config.FileName.empty() ? text.size() : data.size();
+	structure::MeshData mesh;
+	double best = 0.0;
+	for (unsigned int i = 0; i < (std::max)(config.RunNum, 1u); ++i)
+	{
+		mesh = structure::MeshData();
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		const bool loaded = config.FileName.empty()
+			? MeshImporter::ParseObj(text.data(), text.size(), &mesh)
+			: MeshImporter::Load(fileName.c_str(), &mesh);
+		if (!loaded)
+			return false;
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		best = (std::max)(best, double(bytes) / (1024.0 * 1024.0) / seconds);
+	}
+
+	result->Megabytes			= double(bytes) / (1024.0 * 1024.0);
+	result->MegabytesPerSecond	= best;
+	result->VertexNum			= double(mesh.Vertices.size());
+	result->TriangleNum			= double(mesh.Indices.size() / 3);
+	return best > 0.0;
+}
+
+/* Entry point */
+int BenchmarkImport::Main(const char* commandLine)
+{
+	Config config;
+	std::string value;
+	if (BenchmarkReport::FindOption(commandLine, "file", value))		config.FileName		= value;
+	if (BenchmarkReport::FindOption(commandLine, "triangles", value))	config.TriangleNum	= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "runs", value))		config.RunNum		= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+
+	Result result;
+	const bool success = BenchmarkImport::Run(config, &result);
+
+	BenchmarkReport report("import");
+	report.AddText("file", config.FileName.empty() ? "generated.obj" : config.FileName);
+	report.Add("mb", result.Megabytes, 3);
+	report.Add("vertices", result.VertexNum, 0);
+	report.Add("triangles", result.TriangleNum, 0);
+	report.Add("import_mb_per_s", result.MegabytesPerSecond, 1, BenchmarkReport::GATE::HIGHER);
+	return report.Finish(commandLine, success ? 0 : 1);
+}
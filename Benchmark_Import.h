@@ -0,0 +1,55 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Import.h
+*		Detail	: MeshImporter throughput of a file or of generated OBJ text
+===================================================================================*/
+#pragma once
+#include <string>
+
+class BenchmarkImport
+{
+public:
+	//**************************************************
+	/// \brief Workload parameters
+	//**************************************************
+	struct Config
+	{
+		std::string		FileName;					// .obj .gltf .glb, empty parses generated OBJ text
+		unsigned int	TriangleNum		= 200000;	// triangles of the generated text
+		unsigned int	RunNum			= 3;		// best of
+	};
+
+	//**************************************************
+	/// \brief Measured values
+	//**************************************************
+	struct Result
+	{
+		double	Megabytes;				// size of the source
+		double	MegabytesPerSecond;		// best run, the file is in the os cache after the first read
+		double	VertexNum;				// after welding
+		double	TriangleNum;
+	};
+
+public:
+	//**************************************************
+	/// \brief Import the source RunNum times
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool Run(
+		const Config& config,
+		Result* result
+	);
+
+	//**************************************************
+	/// \brief Benchmark entry point, throughput is gated against a baseline
+	///        -file=mesh.obj|gltf|glb -triangles= -runs=
+	///        -out=import.json -baseline=old.json -tolerance=0.1
+	///
+	/// \param[in] commandLine	 ->	options
+	///
+	/// \return process exit code, non zero on failure or regression
+	//**************************************************
+	static int Main(const char* commandLine);
+};
@@ -0,0 +1,105 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Occlusion.cpp
+*		Detail	: OcclusionCuller cost and culled ratio behind generated walls
+===================================================================================*/
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "Benchmark_Report.h"
+#include "Scene_Occlusion.h"
+
+#include "Benchmark_Occlusion.h"
+using namespace DirectX;
+
+/* Run */
+bool BenchmarkOcclusion::Run(const Config& config, Result* result)
+{
+	*result = Result{};
+	if (config.Width == 0 || config.Height == 0)
+		return false;
+
+	// Rows of walls across the view, small boxes scattered between and behind them
+	const size_t boxNum = (std::max)(size_t(config.BoxNum), size_t(1));
+	std::vector<XMFLOAT3> wallPositions;
+	std::vector<uint32_t> wallIndices;
+	for (uint32_t row = 0; row < 4; ++row)
+	{
+		for (int segment = -4; segment < 4; ++segment)
+		{
+			const float z = 20.0f + 25.0f * row, left = float(segment) * 12.0f + (row & 1 ? 6.0f : 0.0f);
+			const uint32_t base = uint32_t(wallPositions.size());
+			wallPositions.push_back(XMFLOAT3(left, -5.0f, z));
+			wallPositions.push_back(XMFLOAT3(left + 10.0f, -5.0f, z));
+			wallPositions.push_back(XMFLOAT3(left + 10.0f, 15.0f, z));
+			wallPositions.push_back(XMFLOAT3(left, 15.0f, z));
+			wallIndices.insert(wallIndices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+		}
+	}
+
+	std::mt19937 random(config.Seed);
+	std::uniform_real_distribution<float> across(-50.0f, 50.0f), height(-4.0f, 4.0f), depth(10.0f, 120.0f);
+	std::vector<structure::Bounds> boxes(boxNum);
+	for (structure::Bounds& box : boxes)
+	{
+		const XMFLOAT3 center(across(random), height(random), depth(random));
+		box = structure::Bounds{ { center.x - 0.5f, center.y - 0.5f, center.z - 0.5f }, { center.x + 0.5f, center.y + 0.5f, center.z + 0.5f } };
+	}
+
+	XMFLOAT4X4 viewProjection;
+	XMStoreFloat4x4(&viewProjection,
+		XMMatrixLookAtLH(XMVectorSet(0.0f, 2.0f, 0.0f, 1.0f), XMVectorSet(0.0f, 2.0f, 1.0f, 1.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f)) *
+		XMMatrixPerspectiveFovLH(XM_PI / 3.0f, 16.0f / 9.0f, 0.1f, 500.0f));
+
+	OcclusionCuller culler;
+	culler.SetResolution(config.Width, config.Height);
+	std::vector<uint8_t> visible(boxNum);
+	const int repeat = 10;
+	double rasterSeconds = 0.0, testSeconds = 0.0;
+	size_t visibleNum = 0;
+	for (int i = 0; i < repeat; ++i)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		culler.BeginFrame();
+		culler.AddOccluder(wallPositions.data(), sizeof(XMFLOAT3), wallIndices.data(), uint32_t(wallIndices.size()), viewProjection);
+		culler.Rasterize();
+		std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+		visibleNum = culler.TestBatch(boxes.data(), boxes.size(), viewProjection, visible.data());
+		rasterSeconds	+= std::chrono::duration<double>(middle - start).count();
+		testSeconds		+= std::chrono::duration<double>(std::chrono::steady_clock::now() - middle).count();
+	}
+	result->RasterMilliseconds	= rasterSeconds * 1e3 / repeat;
+	result->TestNanoseconds		= testSeconds * 1e9 / repeat / double(boxNum);
+	result->CulledRatio			= double(boxNum - visibleNum) / double(boxNum);
+	return true;
+}
+
+/* Entry point */
+int BenchmarkOcclusion::Main(const char* commandLine)
+{
+	Config config;
+	std::string value;
+	if (BenchmarkReport::FindOption(commandLine, "boxes", value))	config.BoxNum	= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "width", value))	config.Width	= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "height", value))	config.Height	= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "seed", value))	config.Seed		= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+
+	Result result;
+	const bool success = BenchmarkOcclusion::Run(config, &result);
+
+	// A lower culled ratio with the same scene means the depth buffer got conservative
+	using GATE = BenchmarkReport::GATE;
+	BenchmarkReport report("occlusion");
+	report.Add("boxes", config.BoxNum, 0);
+	report.Add("width", config.Width, 0);
+	report.Add("height", config.Height, 0);
+	report.Add("seed", config.Seed, 0);
+	report.Add("occlusion_raster_ms", result.RasterMilliseconds, 4, GATE::LOWER);
+	report.Add("occlusion_test_ns", result.TestNanoseconds, 2, GATE::LOWER);
+	report.Add("occlusion_culled", result.CulledRatio, 4, GATE::HIGHER);
+	return report.Finish(commandLine, success ? 0 : 1);
+}
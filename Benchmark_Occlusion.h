@@ -0,0 +1,54 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Occlusion.h
+*		Detail	: OcclusionCuller cost and culled ratio behind generated walls
+===================================================================================*/
+#pragma once
+
+class BenchmarkOcclusion
+{
+public:
+	//**************************************************
+	/// \brief Workload parameters
+	//**************************************************
+	struct Config
+	{
+		unsigned int	BoxNum		= 10000;	// occludees between and behind the walls
+		unsigned int	Width		= 320;		// depth buffer
+		unsigned int	Height		= 192;
+		unsigned int	Seed		= 1;
+	};
+
+	//**************************************************
+	/// \brief Measured values
+	//**************************************************
+	struct Result
+	{
+		double	RasterMilliseconds;		// occluder pass
+		double	TestNanoseconds;		// per occludee bounds
+		double	CulledRatio;			// occludees rejected
+	};
+
+public:
+	//**************************************************
+	/// \brief Rasterize rows of walls and test the boxes, average of 10 frames
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool Run(
+		const Config& config,
+		Result* result
+	);
+
+	//**************************************************
+	/// \brief Benchmark entry point, timings and culled ratio are gated against a baseline
+	///        -boxes= -width= -height= -seed=
+	///        -out=occlusion.json -baseline=old.json -tolerance=0.1
+	///
+	/// \param[in] commandLine	 ->	options
+	///
+	/// \return process exit code, non zero on failure or regression
+	//**************************************************
+	static int Main(const char* commandLine);
+};
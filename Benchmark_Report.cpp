@@ -0,0 +1,194 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Report.cpp
+*		Detail	: Json report, baseline gate and options shared by the benchmarks
+===================================================================================*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Benchmark_Report.h"
+
+/* Constructor */
+BenchmarkReport::BenchmarkReport(const char* benchmark)
+	:m_benchmark(benchmark),
+	m_entries()
+{
+	this->AddText("benchmark", m_benchmark);
+}
+
+/* Add text */
+void BenchmarkReport::AddText(const char* key, const std::string& value, const GATE gate)
+{
+	m_entries.push_back(Entry{ key, "\"" + value + "\"", 0.0, gate });
+}
+
+/* Add number */
+void BenchmarkReport::Add(const char* key, const double value, const int precision, const GATE gate)
+{
+	char text[64];
+	std::snprintf(text, sizeof(text), "%.*f", precision, value);
+	m_entries.push_back(Entry{ key, text, value, gate });
+}
+
+/* Write */
+bool BenchmarkReport::Write(const char* fileName) const
+{
+	FILE* file = std::fopen(fileName, "w");
+	if (!file)
+		return false;
+
+	std::fprintf(file, "{\n");
+	for (size_t i = 0; i < m_entries.size(); ++i)
+		std::fprintf(file, "  \"%s\": %s%s\n", m_entries[i].Key.c_str(), m_entries[i].Text.c_str(), i + 1 < m_entries.size() ? "," : "");
+	std::fprintf(file, "}\n");
+
+	std::fclose(file);
+	return true;
+}
+
+/* Compare with baseline */
+bool BenchmarkReport::CompareBaseline(const char* fileName, const double tolerance) const
+{
+	FILE* file = std::fopen(fileName, "r");
+	if (!file)
+		return false;
+
+	std::string json;
+	char buffer[1024];
+	size_t readSize;
+	while ((readSize = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+		json.append(buffer, readSize);
+	std::fclose(file);
+
+	bool pass = true;
+	for (const Entry& entry : m_entries)
+	{
+		if (entry.Gate == GATE::NONE)
+			continue;
+
+		// Numbers of another workload are not comparable
+		if (entry.Gate == GATE::CONFIG)
+		{
+			std::string text;
+			if (!FindValue(json, entry.Key.c_str(), text) || text != entry.Text)
+			{
+				std::printf("baseline: %s %s, baseline %s, other config\n", entry.Key.c_str(), entry.Text.c_str(), text.empty() ? "missing" : text.c_str());
+				pass = false;
+			}
+			continue;
+		}
+
+		double base = 0.0;
+		if (!FindNumber(json, entry.Key.c_str(), base))
+		{
+			std::printf("baseline: %s missing in %s\n", entry.Key.c_str(), fileName);
+			pass = false;
+			continue;
+		}
+
+		bool regression = false;
+		switch (entry.Gate)
+		{
+		case GATE::LOWER:	regression = entry.Value > base * (1.0 + tolerance);	break;
+		case GATE::HIGHER:	regression = entry.Value < base * (1.0 - tolerance);	break;
+		case GATE::COUNT:	regression = entry.Value > base + 0.5;					break;
+		default:																	break;
+		}
+		if (regression)
+		{
+			std::printf("regression: %s %s, baseline %g\n", entry.Key.c_str(), entry.Text.c_str(), base);
+			pass = false;
+		}
+	}
+
+	return pass;
+}
+
+/* Finish */
+int BenchmarkReport::Finish(const char* commandLine, const int exitCode) const
+{
+	int result = exitCode;
+
+	std::string output = m_benchmark + ".json";
+	FindOption(commandLine, "out", output);
+	if (!this->Write(output.c_str()))
+		result = 1;
+
+	std::string baseline, value;
+	if (FindOption(commandLine, "baseline", baseline))
+	{
+		double tolerance = 0.1;
+		if (FindOption(commandLine, "tolerance", value))
+			tolerance = std::strtod(value.c_str(), nullptr);
+
+		if (!this->CompareBaseline(baseline.c_str(), tolerance) && result == 0)
+			result = 2;
+	}
+
+	return result;
+}
+
+/* Find option */
+bool BenchmarkReport::FindOption(const char* commandLine, const char* name, std::string& value)
+{
+	std::string key = std::string("-") + name + "=";
+	const char* found = std::strstr(commandLine, key.c_str());
+	if (!found)
+		return false;
+
+	found += key.size();
+	const char* end = found;
+	while (*end && *end != ' ' && *end != '\t')
+		++end;
+
+	value.assign(found, end);
+	return true;
+}
+
+/* Find switch */
+bool BenchmarkReport::FindSwitch(const char* commandLine, const char* name)
+{
+	const size_t length = std::strlen(name);
+	for (const char* found = std::strstr(commandLine, "-"); found; found = std::strstr(found + 1, "-"))
+	{
+		const bool start = found == commandLine || found[-1] == ' ' || found[-1] == '\t';
+		if (!start || std::strncmp(found + 1, name, length) != 0)
+			continue;
+
+		const char end = found[1 + length];
+		if (end == '\0' || end == ' ' || end == '\t')
+			return true;
+	}
+	return false;
+}
+
+/* Find number */
+bool BenchmarkReport::FindNumber(const std::string& json, const char* key, double& value)
+{
+	std::string pattern = std::string("\"") + key + "\":";
+	size_t position = json.find(pattern);
+	if (position == std::string::npos)
+		return false;
+
+	value = std::strtod(json.c_str() + position + pattern.size(), nullptr);
+	return true;
+}
+
+/* Find value */
+bool BenchmarkReport::FindValue(const std::string& json, const char* key, std::string& value)
+{
+	std::string pattern = std::string("\"") + key + "\":";
+	size_t position = json.find(pattern);
+	if (position == std::string::npos)
+		return false;
+
+	position = json.find_first_not_of(" \t", position + pattern.size());
+	if (position == std::string::npos)
+		return false;
+
+	size_t end = json.find_first_of(",\r\n}", position);
+	value = json.substr(position, end == std::string::npos ? std::string::npos : end - position);
+	return true;
+}
@@ -0,0 +1,158 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Report.h
+*		Detail	: Json report, baseline gate and options shared by the benchmarks
+===================================================================================*/
+#pragma once
+#include <string>
+#include <vector>
+
+//**************************************************
+/// \brief Values of one benchmark run, written as a flat json object
+///        A benchmark adds only what it measured, gated values are
+///        compared with the same key of a baseline report
+//**************************************************
+class BenchmarkReport
+{
+public:
+	//**************************************************
+	/// \brief How a value is compared with its baseline
+	//**************************************************
+	enum class GATE
+	{
+		NONE,		// information only
+		LOWER,		// time, lower is better, relative tolerance
+		HIGHER,		// throughput, higher is better, relative tolerance
+		COUNT,		// deterministic count, no tolerance
+		CONFIG,		// workload parameter, the baseline must be written with the same
+		NUM,
+	};
+
+public:
+	//**************************************************
+	/// \brief Constructor
+	///
+	/// \param[in] benchmark	 ->	name written as "benchmark", default output is name.json
+	///
+	/// \return none
+	//**************************************************
+	explicit BenchmarkReport(const char* benchmark);
+
+	//**************************************************
+	/// \brief Add a text value
+	///
+	/// \return none
+	//**************************************************
+	void AddText(
+		const char* key,
+		const std::string& value,
+		const GATE gate = GATE::NONE
+	);
+
+	//**************************************************
+	/// \brief Add a number
+	///
+	/// \param[in] key		 ->	json key
+	/// \param[in] value	 ->	measured value
+	/// \param[in] precision ->	digits after the decimal point
+	/// \param[in] gate		 ->	comparison with the baseline
+	///
+	/// \return none
+	//**************************************************
+	void Add(
+		const char* key,
+		const double value,
+		const int precision,
+		const GATE gate = GATE::NONE
+	);
+
+	//**************************************************
+	/// \brief Write every value in order of addition
+	///
+	/// \return Success is true
+	//**************************************************
+	bool Write(const char* fileName) const;
+
+	//**************************************************
+	/// \brief Compare gated values with a stored report, print regressions
+	///
+	/// \param[in] fileName	 ->	baseline json written by Write
+	/// \param[in] tolerance ->	allowed relative regression (0.1 is 10%)
+	///
+	/// \return if readable and no regression then true
+	//**************************************************
+	bool CompareBaseline(
+		const char* fileName,
+		const double tolerance
+	) const;
+
+	//**************************************************
+	/// \brief Common tail of a benchmark entry point
+	///        -out=report.json -baseline=old.json -tolerance=0.1
+	///
+	/// \param[in] commandLine	 ->	options
+	/// \param[in] exitCode		 ->	exit code of the measurement
+	///
+	/// \return exit code, 1 when the report is not written, 2 on regression
+	//**************************************************
+	int Finish(
+		const char* commandLine,
+		const int exitCode
+	) const;
+
+	//**************************************************
+	/// \brief Find "-name=value" in command line
+	///
+	/// \return if found then true
+	//**************************************************
+	static bool FindOption(
+		const char* commandLine,
+		const char* name,
+		std::string& value
+	);
+
+	//**************************************************
+	/// \brief Find "-name" as a whole word in command line
+	///
+	/// \return if found then true
+	//**************************************************
+	static bool FindSwitch(
+		const char* commandLine,
+		const char* name
+	);
+
+	//**************************************************
+	/// \brief Read number of "key": value from json text
+	///
+	/// \return if found then true
+	//**************************************************
+	static bool FindNumber(
+		const std::string& json,
+		const char* key,
+		double& value
+	);
+
+	//**************************************************
+	/// \brief Read the value of "key": as written, quotes included
+	///
+	/// \return if found then true
+	//**************************************************
+	static bool FindValue(
+		const std::string& json,
+		const char* key,
+		std::string& value
+	);
+
+private:
+	struct Entry
+	{
+		std::string	Key;
+		std::string	Text;		// formatted value
+		double		Value;
+		GATE		Gate;
+	};
+
+	std::string			m_benchmark;
+	std::vector<Entry>	m_entries;
+};
@@ -0,0 +1,360 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Scene.cpp
+*		Detail	:
+===================================================================================*/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "Graphics_Null.h"
+#include "Graphics_Software.h"
+#include "Memory_Tracker.h"
+#include "Profiler.h"
+
+#include "Benchmark_Report.h"
+#include "Benchmark_Scene.h"
+using namespace DirectX;
+using namespace structure;
+
+/* Initialize */
+bool BenchmarkScene::Init(const Config& config, IGraphics* graphics)
+{
+	if (!graphics || !graphics->Context() || config.MeshNum == 0 || config.MaterialNum == 0)
+		return false;
+
+	m_config	= config;
+	m_graphics	= graphics;
+
+	std::mt19937 random(config.Seed);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	// Meshes are grids of increasing density, 2 to 512 triangles
+	m_meshes.resize(config.MeshNum);
+	for (unsigned int m = 0; m < config.MeshNum; ++m)
+	{
+		Mesh& mesh = m_meshes[m];
+		const unsigned int division = 1 + (m % 16);
+		XMFLOAT3 color(unit(random), unit(random), unit(random));
+
+		for (unsigned int y = 0; y <= division; ++y)
+		{
+			for (unsigned int x = 0; x <= division; ++x)
+			{
+				float u = float(x) / float(division);
+				float v = float(y) / float(division);
+				mesh.Vertices.push_back(Vertex3D{ { u - 0.5f, v - 0.5f, 0.0f }, color, { u, v } });
+			}
+		}
+		for (unsigned int y = 0; y < division; ++y)
+		{
+			for (unsigned int x = 0; x < division; ++x)
+			{
+				unsigned int i0 = y * (division + 1) + x;
+				unsigned int i1 = i0 + 1;
+				unsigned int i2 = i0 + division + 1;
+				unsigned int i3 = i2 + 1;
+				mesh.Indices.insert(mesh.Indices.end(), { i0, i1, i3, i2, i3, i0 });
+			}
+		}
+	}
+
+	if (config.Optimize)
+	{
+		std::vector<MeshData*> meshes;
+		for (Mesh& mesh : m_meshes)
+			meshes.push_back(&mesh);
+		MeshOptimizer::OptimizeBatch(meshes.data(), meshes.size(), MeshOptimizer::Options());
+	}
+
+	for (Mesh& mesh : m_meshes)
+	{
+		if (config.Index32)
+		{
+			mesh.IndexBuffer.Indices32 = mesh.Indices;
+			mesh.IndexBuffer.Chunks.push_back(MeshIndex::Chunk{ 0, uint32_t(mesh.Indices.size()), 0 });
+		}
+		else
+		{
+			MeshIndex::Build(mesh.Indices.data(), mesh.Indices.size(), &mesh.IndexBuffer);
+		}
+	}
+
+	m_materials.resize(config.MaterialNum);
+	for (XMFLOAT4& material : m_materials)
+		material = XMFLOAT4(0.5f + 0.5f * unit(random), 0.5f + 0.5f * unit(random), 0.5f + 0.5f * unit(random), 1.0f);
+
+	// Objects scattered in front of the (identity) camera
+	m_objects.resize(config.ObjectNum);
+	for (Object& object : m_objects)
+	{
+		bool dynamic			= unit(random) < config.DynamicRatio;
+		object.Position			= XMFLOAT3(unit(random) * 2.0f - 1.0f, unit(random) * 2.0f - 1.0f, 0.05f + unit(random) * 0.9f);
+		object.Scale			= 0.02f + unit(random) * 0.08f;
+		object.Angle			= unit(random) * XM_PI * 2.0f;
+		object.AngularVelocity	= dynamic ? (unit(random) - 0.5f) * XM_PI : 0.0f;
+		object.MeshIndex		= uint32_t(random() % config.MeshNum);
+		object.MaterialIndex	= uint32_t(random() % config.MaterialNum);
+	}
+
+	// Sort once for state coherent submission
+	std::stable_sort(m_objects.begin(), m_objects.end(), [](const Object& a, const Object& b)
+	{
+		return a.MaterialIndex != b.MaterialIndex ? a.MaterialIndex < b.MaterialIndex : a.MeshIndex < b.MeshIndex;
+	});
+
+	m_dynamicObjects.clear();
+	for (uint32_t i = 0; i < uint32_t(m_objects.size()); ++i)
+	{
+		if (m_objects[i].AngularVelocity != 0.0f)
+			m_dynamicObjects.push_back(i);
+
+		Object& object = m_objects[i];
+		XMMATRIX world = XMMatrixScaling(object.Scale, object.Scale, object.Scale) * XMMatrixRotationZ(object.Angle) * XMMatrixTranslation(object.Position.x, object.Position.y, object.Position.z);
+		XMStoreFloat4x4(&object.World, world);
+	}
+
+	return true;
+}
+
+/* Uninitialize */
+void BenchmarkScene::Uninit()
+{
+	m_dynamicObjects.clear();
+	m_objects.clear();
+	m_materials.clear();
+	m_meshes.clear();
+	m_graphics = nullptr;
+}
+
+/* Run */
+BenchmarkScene::Result BenchmarkScene::Run()
+{
+	using Clock = std::chrono::steady_clock;
+	const float deltaTime = 1.0f / 60.0f;
+
+	for (unsigned int i = 0; i < m_config.WarmupFrameNum; ++i)
+	{
+		this->Update(deltaTime);
+		m_graphics->Clear();
+		this->Draw();
+		m_graphics->Present();
+	}
+
+	std::vector<double> frameTimes;
+	frameTimes.reserve(m_config.FrameNum);
+
+	uint64_t allocationCount = 0;
+	uint64_t allocationBytes = 0;
+	uint64_t triangleCount = 0;
+	double totalSeconds = 0.0;
+	for (const Object& object : m_objects)
+		triangleCount += m_meshes[object.MeshIndex].Indices.size() / 3;
+
+	// Steady state from here, strict mode turns every allocation into a violation
+	const uint64_t violationsBefore = MemoryTracker::Violations();
+	MemoryTracker::SetStrict(m_config.Strict);
+	MemoryTracker::NextFrame();
+
+	for (unsigned int i = 0; i < m_config.FrameNum; ++i)
+	{
+		Clock::time_point start = Clock::now();
+
+		this->Update(deltaTime);
+		m_graphics->Clear();
+		this->Draw();
+		m_graphics->Present();
+
+		double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+		MemoryTracker::NextFrame();
+		MemoryTracker::Counter allocation = MemoryTracker::LastFrame();
+		allocationCount += allocation.Count;
+		allocationBytes += allocation.Bytes;
+
+		frameTimes.push_back(seconds * 1000.0);
+		totalSeconds += seconds;
+	}
+
+	MemoryTracker::SetStrict(false);
+
+	Result result{};
+	if (frameTimes.empty())
+		return result;
+
+	std::vector<double> sorted = frameTimes;
+	std::sort(sorted.begin(), sorted.end());
+	auto percentile = [&](double p) { return sorted[size_t(p * double(sorted.size() - 1) + 0.5)]; };
+
+	const double frameNum			= double(frameTimes.size());
+	result.FrameAverage				= totalSeconds * 1000.0 / frameNum;
+	result.FrameP50					= percentile(0.50);
+	result.FrameP95					= percentile(0.95);
+	result.FrameP99					= percentile(0.99);
+	result.FrameMaximum				= sorted.back();
+	result.DrawsPerFrame			= double(m_objects.size());
+	result.DrawsPerSecond			= totalSeconds > 0.0 ? double(m_objects.size()) * frameNum / totalSeconds : 0.0;
+	result.TrianglesPerFrame		= double(triangleCount);
+	result.AllocationsPerFrame		= double(allocationCount) / frameNum;
+	result.AllocatedBytesPerFrame	= double(allocationBytes) / frameNum;
+	result.StrictViolations			= double(MemoryTracker::Violations() - violationsBefore);
+	for (const Mesh& mesh : m_meshes)
+	{
+		result.IndexBytes			+= double(mesh.IndexBuffer.ByteSize());
+		result.ACMR					+= double(MeshOptimizer::Analyze(mesh.Indices.data(), mesh.Indices.size(), mesh.Vertices.size()).ACMR) / double(m_meshes.size());
+	}
+	return result;
+}
+
+/* Entry point */
+int BenchmarkScene::Main(const char* commandLine)
+{
+	Config config;
+	std::string value;
+	if (BenchmarkReport::FindOption(commandLine, "backend", value))		config.Backend			= value;
+	if (BenchmarkReport::FindOption(commandLine, "objects", value))		config.ObjectNum		= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "meshes", value))		config.MeshNum			= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "materials", value))	config.MaterialNum		= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "dynamic", value))		config.DynamicRatio		= float(std::strtod(value.c_str(), nullptr));
+	if (BenchmarkReport::FindOption(commandLine, "frames", value))		config.FrameNum			= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "warmup", value))		config.WarmupFrameNum	= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "seed", value))		config.Seed				= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindSwitch(commandLine, "strict"))				config.Strict			= true;
+	if (BenchmarkReport::FindSwitch(commandLine, "index32"))			config.Index32			= true;
+	if (BenchmarkReport::FindSwitch(commandLine, "optimize"))			config.Optimize			= true;
+
+	IGraphics* graphics = nullptr;
+	if (config.Backend == "software")
+		graphics = new GraphicsSoftware();
+	else
+		graphics = new GraphicsNull();
+
+	if (!graphics->Init(config.Width, config.Height, nullptr))
+	{
+		delete graphics;
+		return 1;
+	}
+
+	int exitCode = 0;
+	BenchmarkScene scene;
+	if (scene.Init(config, graphics))
+	{
+		Result result = scene.Run();
+		result.MarkerNanoseconds = Profiler::MeasureScopeCost(1000000);
+
+		if (result.StrictViolations > 0.0)
+		{
+			std::printf("strict: %.0f allocations in steady state, first in %s\n", result.StrictViolations, MemoryTracker::FirstViolationTag());
+			MemoryTracker::Report();
+			exitCode = 3;
+		}
+
+		exitCode = BenchmarkScene::MakeReport(config, result).Finish(commandLine, exitCode);
+	}
+	else
+	{
+		exitCode = 1;
+	}
+
+	scene.Uninit();
+	graphics->Uninit();
+	delete graphics;
+	return exitCode;
+}
+
+// Make report
+BenchmarkReport BenchmarkScene::MakeReport(const Config& config, const Result& result)
+{
+	using GATE = BenchmarkReport::GATE;
+	BenchmarkReport report("scene");
+	report.AddText("backend", config.Backend, GATE::CONFIG);
+	report.Add("objects", config.ObjectNum, 0, GATE::CONFIG);
+	report.Add("meshes", config.MeshNum, 0, GATE::CONFIG);
+	report.Add("materials", config.MaterialNum, 0, GATE::CONFIG);
+	report.Add("dynamic_ratio", config.DynamicRatio, 3, GATE::CONFIG);
+	report.Add("frames", config.FrameNum, 0, GATE::CONFIG);
+	report.Add("warmup_frames", config.WarmupFrameNum, 0, GATE::CONFIG);
+	report.Add("seed", config.Seed, 0, GATE::CONFIG);
+	report.Add("strict", config.Strict ? 1.0 : 0.0, 0, GATE::CONFIG);
+	report.Add("index32", config.Index32 ? 1.0 : 0.0, 0, GATE::CONFIG);
+	report.Add("optimize", config.Optimize ? 1.0 : 0.0, 0, GATE::CONFIG);
+	report.Add("width", config.Width, 0, GATE::CONFIG);
+	report.Add("height", config.Height, 0, GATE::CONFIG);
+	report.Add("frame_ms_avg", result.FrameAverage, 6);
+	report.Add("frame_ms_p50", result.FrameP50, 6);
+	report.Add("frame_ms_p95", result.FrameP95, 6, GATE::LOWER);
+	report.Add("frame_ms_p99", result.FrameP99, 6);
+	report.Add("frame_ms_max", result.FrameMaximum, 6);
+	report.Add("draws_per_frame", result.DrawsPerFrame, 1);
+	report.Add("draws_per_second", result.DrawsPerSecond, 1, GATE::HIGHER);
+	report.Add("triangles_per_frame", result.TrianglesPerFrame, 1);
+	report.Add("allocations_per_frame", result.AllocationsPerFrame, 3, GATE::COUNT);
+	report.Add("allocated_bytes_per_frame", result.AllocatedBytesPerFrame, 1);
+	report.Add("strict_violations", result.StrictViolations, 0);
+	report.Add("marker_ns_per_scope", result.MarkerNanoseconds, 2);
+	report.Add("index_bytes", result.IndexBytes, 0);
+	report.Add("acmr", result.ACMR, 3);
+	return report;
+}
+
+// Update
+void BenchmarkScene::Update(const float deltaTime)
+{
+	MEMORY_TAG("BenchmarkScene::Update");
+
+	for (uint32_t index : m_dynamicObjects)
+	{
+		Object& object = m_objects[index];
+		object.Angle += object.AngularVelocity * deltaTime;
+
+		XMMATRIX world = XMMatrixScaling(object.Scale, object.Scale, object.Scale) * XMMatrixRotationZ(object.Angle) * XMMatrixTranslation(object.Position.x, object.Position.y, object.Position.z);
+		XMStoreFloat4x4(&object.World, world);
+	}
+}
+
+// Draw
+void BenchmarkScene::Draw()
+{
+	MEMORY_TAG("BenchmarkScene::Draw");
+	this->Submit((ICommandContext*)m_graphics->Context());
+}
+
+/* Submit */
+template<class CONTEXT>
+void BenchmarkScene::Submit(CONTEXT* context)
+{
+	uint32_t boundMesh		= UINT32_MAX;
+	uint32_t boundMaterial	= UINT32_MAX;
+	for (const Object& object : m_objects)
+	{
+		if (object.MaterialIndex != boundMaterial)
+		{
+			context->SetMaterialColor(m_materials[object.MaterialIndex]);
+			boundMaterial = object.MaterialIndex;
+		}
+
+		const Mesh& mesh = m_meshes[object.MeshIndex];
+		if (object.MeshIndex != boundMesh)
+		{
+			context->SetVertexBuffer(mesh.Vertices.data(), (unsigned int)(mesh.Vertices.size()));
+			if (mesh.IndexBuffer.Is16Bit)
+				context->SetIndexBuffer(mesh.IndexBuffer.Indices16.data(), mesh.IndexBuffer.IndexNum());
+			else
+				context->SetIndexBuffer(mesh.IndexBuffer.Indices32.data(), mesh.IndexBuffer.IndexNum());
+			boundMesh = object.MeshIndex;
+		}
+
+		context->SetWorldMatrix(object.World);
+		for (const MeshIndex::Chunk& chunk : mesh.IndexBuffer.Chunks)
+			context->DrawIndexed(chunk.IndexNum, chunk.StartIndex, chunk.BaseVertex);
+	}
+}
+
+// Draw uses the interface, BenchmarkDispatch the final classes
+template void BenchmarkScene::Submit<ICommandContext>(ICommandContext* context);
+template void BenchmarkScene::Submit<GraphicsNull>(GraphicsNull* context);
+template void BenchmarkScene::Submit<GraphicsSoftware>(GraphicsSoftware* context);
@@ -0,0 +1,160 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Scene.h
+*		Detail	: Reproducible generated scenes driven through the cpu backends
+===================================================================================*/
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Benchmark_Report.h"
+#include "Graphics_CommandContext.h"
+#include "Mesh_Index.h"
+#include "Mesh_Optimizer.h"
+
+class BenchmarkScene
+{
+public:
+	//**************************************************
+	/// \brief Workload parameters
+	//**************************************************
+	struct Config
+	{
+		std::string		Backend			= "null";	// "null" or "software"
+		unsigned int	ObjectNum		= 10000;	// N objects
+		unsigned int	MeshNum			= 16;		// M unique meshes
+		unsigned int	MaterialNum		= 8;		// K materials
+		float			DynamicRatio	= 0.25f;	// fraction of objects moving every update
+		unsigned int	FrameNum		= 1000;		// measured frames
+		unsigned int	WarmupFrameNum	= 60;		// frames before measuring
+		unsigned int	Seed			= 1;		// random seed of scene generation
+		bool			Strict			= false;	// fail when a measured frame allocates
+		bool			Index32			= false;	// keep 32 bit indices (comparison with 16 bit)
+		bool			Optimize		= false;	// run MeshOptimizer on generated meshes
+		int				Width			= 1280;
+		int				Height			= 720;
+	};
+
+	//**************************************************
+	/// \brief Measured values
+	//**************************************************
+	struct Result
+	{
+		double	FrameAverage;			// frame time (ms)
+		double	FrameP50;
+		double	FrameP95;
+		double	FrameP99;
+		double	FrameMaximum;
+		double	DrawsPerFrame;
+		double	DrawsPerSecond;
+		double	TrianglesPerFrame;
+		double	AllocationsPerFrame;	// heap allocations in a measured frame
+		double	AllocatedBytesPerFrame;
+		double	StrictViolations;		// allocations in measured frames under strict mode
+		double	MarkerNanoseconds;		// cost of one profiler scope
+		double	IndexBytes;				// index memory of all meshes
+		double	ACMR;					// average cache miss ratio of the meshes
+	};
+
+public:
+	//**************************************************
+	/// \brief Generate meshes, materials and objects
+	///
+	/// \param[in] config	 ->	workload parameters
+	/// \param[in] graphics	 ->	initialized backend with ICommandContext
+	///
+	/// \return Success is true
+	//**************************************************
+	bool Init(
+		const Config& config,
+		IGraphics* graphics
+	);
+
+	//**************************************************
+	/// \brief Release scene
+	///
+	/// \return none
+	//**************************************************
+	void Uninit();
+
+	//**************************************************
+	/// \brief Drive update and draw for warmup and measured frames
+	///
+	/// \return measured values
+	//**************************************************
+	Result Run();
+
+	//**************************************************
+	/// \brief Submission loop of Draw, CONTEXT is ICommandContext or a final backend
+	///        Instantiated for ICommandContext, GraphicsNull and GraphicsSoftware
+	///
+	/// \param[in] context	 ->	Context() of the backend given to Init
+	///
+	/// \return none
+	//**************************************************
+	template<class CONTEXT>
+	void Submit(CONTEXT* context);
+
+	//**************************************************
+	/// \brief Benchmark entry point, also reports cost of one profiler marker
+	///        -objects= -meshes= -materials= -dynamic= -frames= -warmup= -seed=
+	///        -backend=null|software -out=scene.json -baseline=old.json -tolerance=0.1
+	///        -strict (exit code 3 when a measured frame allocates) -index32 -optimize
+	///
+	/// \param[in] commandLine	 ->	options
+	///
+	/// \return process exit code, non zero on failure, regression or allocation
+	//**************************************************
+	static int Main(const char* commandLine);
+
+private:
+	struct Mesh : structure::MeshData
+	{
+		MeshIndex::Buffer	IndexBuffer;	// submitted indices, 16 bit when possible
+	};
+
+	struct Object
+	{
+		DirectX::XMFLOAT4X4	World;
+		DirectX::XMFLOAT3	Position;
+		float				Scale;
+		float				Angle;				// rotation around z axis
+		float				AngularVelocity;	// radian per second (zero is static)
+		uint32_t			MeshIndex;
+		uint32_t			MaterialIndex;
+	};
+
+	//**************************************************
+	/// \brief Report of config and result, frame p95, draw rate and
+	///        allocation count are gated against a baseline of the same config
+	///
+	/// \return report
+	//**************************************************
+	static BenchmarkReport MakeReport(
+		const Config& config,
+		const Result& result
+	);
+
+	//**************************************************
+	/// \brief Advance dynamic objects
+	///
+	/// \return none
+	//**************************************************
+	void Update(const float deltaTime);
+
+	//**************************************************
+	/// \brief Submit all objects in material / mesh order
+	///
+	/// \return none
+	//**************************************************
+	void Draw();
+
+	IGraphics*							m_graphics = nullptr;
+	std::vector<Mesh>					m_meshes;
+	std::vector<DirectX::XMFLOAT4>		m_materials;		// material is a color until textures land
+	std::vector<Object>					m_objects;			// sorted by material then mesh
+	std::vector<uint32_t>				m_dynamicObjects;	// indices of moving objects
+	Config								m_config;
+};
@@ -0,0 +1,85 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Simplify.cpp
+*		Detail	: MeshSimplifier throughput and error on a generated mesh
+===================================================================================*/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "Benchmark_Report.h"
+#include "Mesh_Simplifier.h"
+
+#include "Benchmark_Simplify.h"
+
+/* Run */
+bool BenchmarkSimplify::Run(const Config& config, Result* result)
+{
+	*result = Result{};
+
+	// Rolling height field on a unit square, a uv seam splits it in half
+	const uint32_t side = (std::max)(uint32_t(std::sqrt(double(config.TriangleNum) * 0.5)), 2u);
+	const uint32_t seam = side / 2;
+	structure::MeshData mesh;
+	for (uint32_t y = 0; y <= side; ++y)
+	{
+		for (uint32_t x = 0; x <= side; ++x)
+		{
+			const float u = float(x) / side, v = float(y) / side;
+			const float height = 0.05f * std::sin(u * 23.0f) * std::cos(v * 31.0f) + 0.01f * std::sin((u + v) * 97.0f);
+			mesh.Vertices.push_back(structure::Vertex3D{ { u, v, height }, { 0.0f, 0.0f, 1.0f }, { u, v } });
+		}
+	}
+	const uint32_t seamBase = uint32_t(mesh.Vertices.size());
+	for (uint32_t y = 0; y <= side; ++y)
+	{
+		structure::Vertex3D vertex = mesh.Vertices[y * (side + 1) + seam];
+		vertex.TexCoord.x += 1.0f;
+		mesh.Vertices.push_back(vertex);
+	}
+	for (uint32_t y = 0; y < side; ++y)
+	{
+		for (uint32_t x = 0; x < side; ++x)
+		{
+			auto corner = [&](uint32_t cx, uint32_t cy) { return x >= seam && cx == seam ? seamBase + cy : cy * (side + 1) + cx; };
+			const uint32_t quad[4] = { corner(x, y), corner(x + 1, y), corner(x + 1, y + 1), corner(x, y + 1) };
+			mesh.Indices.insert(mesh.Indices.end(), { quad[0], quad[1], quad[2], quad[0], quad[2], quad[3] });
+		}
+	}
+
+	MeshSimplifier::Options options;
+	options.TargetTriangleNum = size_t(double(mesh.Indices.size() / 3) * (std::min)((std::max)(double(config.Ratio), 0.0), 1.0));
+	std::vector<uint32_t> simplified;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	result->Error = MeshSimplifier::Simplify(mesh.Vertices.data(), mesh.Vertices.size(), mesh.Indices.data(), mesh.Indices.size(), options, &simplified);
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	result->SourceTriangleNum		= double(mesh.Indices.size() / 3);
+	result->TriangleNum				= double(simplified.size() / 3);
+	result->MegatrianglesPerSecond	= result->SourceTriangleNum / 1e6 / seconds;
+	return !simplified.empty();
+}
+
+/* Entry point */
+int BenchmarkSimplify::Main(const char* commandLine)
+{
+	Config config;
+	std::string value;
+	if (BenchmarkReport::FindOption(commandLine, "triangles", value))	config.TriangleNum	= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "ratio", value))		config.Ratio		= float(std::strtod(value.c_str(), nullptr));
+
+	Result result;
+	const bool success = BenchmarkSimplify::Run(config, &result);
+
+	using GATE = BenchmarkReport::GATE;
+	BenchmarkReport report("simplify");
+	report.Add("ratio", config.Ratio, 3);
+	report.Add("source_triangles", result.SourceTriangleNum, 0);
+	report.Add("triangles", result.TriangleNum, 0, GATE::COUNT);
+	report.Add("simplify_mtri_per_s", result.MegatrianglesPerSecond, 3, GATE::HIGHER);
+	report.Add("simplify_error", result.Error, 6, GATE::LOWER);
+	return report.Finish(commandLine, success ? 0 : 1);
+}
@@ -0,0 +1,54 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Simplify.h
+*		Detail	: MeshSimplifier throughput and error on a generated mesh
+===================================================================================*/
+#pragma once
+
+class BenchmarkSimplify
+{
+public:
+	//**************************************************
+	/// \brief Workload parameters
+	//**************************************************
+	struct Config
+	{
+		unsigned int	TriangleNum	= 200000;	// source triangles
+		float			Ratio		= 0.1f;		// target triangles relative to the source
+	};
+
+	//**************************************************
+	/// \brief Measured values
+	//**************************************************
+	struct Result
+	{
+		double	SourceTriangleNum;
+		double	TriangleNum;				// reached, above the target when collapses ran out
+		double	MegatrianglesPerSecond;		// source triangles per second
+		double	Error;						// largest collapse error, the mesh spans 1 unit
+	};
+
+public:
+	//**************************************************
+	/// \brief Simplify a rolling height field with a uv seam through the middle
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool Run(
+		const Config& config,
+		Result* result
+	);
+
+	//**************************************************
+	/// \brief Benchmark entry point, throughput, reached triangles and error
+	///        are gated against a baseline
+	///        -triangles= -ratio=
+	///        -out=simplify.json -baseline=old.json -tolerance=0.1
+	///
+	/// \param[in] commandLine	 ->	options
+	///
+	/// \return process exit code, non zero on failure or regression
+	//**************************************************
+	static int Main(const char* commandLine);
+};
@@ -0,0 +1,71 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Suite.cpp
+*		Detail	: Benchmark entry points by name
+===================================================================================*/
+#include <cstdio>
+#include <cstring>
+
+#include "Benchmark_Arena.h"
+#include "Benchmark_Bvh.h"
+#include "Benchmark_Compress.h"
+#include "Benchmark_Dispatch.h"
+#include "Benchmark_Import.h"
+#include "Benchmark_Occlusion.h"
+#include "Benchmark_Scene.h"
+#include "Benchmark_Simplify.h"
+#include "Benchmark_Transform.h"
+
+#include "Benchmark_Suite.h"
+
+namespace
+{
+	//**************************************************
+	/// \brief Named entry point
+	//**************************************************
+	struct Entry
+	{
+		const char*	Name;
+		int			(*Main)(const char* commandLine);
+	};
+
+	const Entry k_entries[]
+	{
+		{ "scene",		BenchmarkScene::Main },
+		{ "import",		BenchmarkImport::Main },
+		{ "compress",	BenchmarkCompress::Main },
+		{ "simplify",	BenchmarkSimplify::Main },
+		{ "bvh",		BenchmarkBvh::Main },
+		{ "occlusion",	BenchmarkOcclusion::Main },
+		{ "transforms",	BenchmarkTransform::Main },
+		{ "arena",		BenchmarkArena::Main },
+		{ "dispatch",	BenchmarkDispatch::Main },
+	};
+}
+
+/* Entry point */
+int BenchmarkSuite::Main(const char* name, const char* commandLine)
+{
+	if (!name || !*name)
+		name = "scene";
+
+	for (const Entry& entry : k_entries)
+	{
+		if (std::strcmp(entry.Name, name) == 0)
+			return entry.Main(commandLine ? commandLine : "");
+	}
+
+	std::printf("unknown benchmark %s\n", name);
+	BenchmarkSuite::PrintNames();
+	return 1;
+}
+
+/* Print names */
+void BenchmarkSuite::PrintNames()
+{
+	std::printf("benchmarks:");
+	for (const Entry& entry : k_entries)
+		std::printf(" %s", entry.Name);
+	std::printf("\n");
+}
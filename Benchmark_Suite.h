@@ -0,0 +1,32 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Suite.h
+*		Detail	: Benchmark entry points by name
+===================================================================================*/
+#pragma once
+
+class BenchmarkSuite
+{
+public:
+	//**************************************************
+	/// \brief Run one benchmark, every benchmark reads its own options
+	///        and writes a report of only what it measured
+	///
+	/// \param[in] name			 ->	benchmark name, nullptr or empty is "scene"
+	/// \param[in] commandLine	 ->	options of the benchmark
+	///
+	/// \return process exit code, non zero on failure or regression
+	//**************************************************
+	static int Main(
+		const char* name,
+		const char* commandLine
+	);
+
+	//**************************************************
+	/// \brief Print the benchmark names
+	///
+	/// \return none
+	//**************************************************
+	static void PrintNames();
+};
@@ -0,0 +1,127 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Transform.cpp
+*		Detail	: World matrices from SoA transforms, XMMATRIX loop against TransformBatch
+===================================================================================*/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Benchmark_Report.h"
+#include "Graphics_Constants.h"
+
+#include "Benchmark_Transform.h"
+using namespace DirectX;
+
+namespace
+{
+	const double k_maximumError = 1e-4;	// relative to the larger of 1 and the element
+}
+
+/* Run */
+bool BenchmarkTransform::Run(const Config& config, Result* result)
+{
+	*result = Result{};
+
+	// Random unit quaternions, output laid out like ObjectConstants blocks of an upload ring
+	const size_t objectNum = (std::max)(size_t(config.ObjectNum), size_t(1));
+	std::mt19937 random(config.Seed);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	std::vector<float> arrays[10];
+	for (std::vector<float>& values : arrays)
+		values.resize(objectNum);
+	for (size_t i = 0; i < objectNum; ++i)
+	{
+		XMFLOAT4 rotation;
+		XMStoreFloat4(&rotation, XMQuaternionNormalize(XMVectorSet(unit(random), unit(random), unit(random), unit(random) + 2.0f)));
+		arrays[0][i] = unit(random) * 100.0f;	arrays[1][i] = unit(random) * 100.0f;	arrays[2][i] = unit(random) * 100.0f;
+		arrays[3][i] = rotation.x;				arrays[4][i] = rotation.y;				arrays[5][i] = rotation.z;				arrays[6][i] = rotation.w;
+		arrays[7][i] = 1.0f + unit(random) * 0.5f;	arrays[8][i] = 1.0f + unit(random) * 0.5f;	arrays[9][i] = 1.0f + unit(random) * 0.5f;
+	}
+	const structure::TransformArrays transforms
+	{
+		arrays[0].data(), arrays[1].data(), arrays[2].data(),
+		arrays[3].data(), arrays[4].data(), arrays[5].data(), arrays[6].data(),
+		arrays[7].data(), arrays[8].data(), arrays[9].data(),
+	};
+	const size_t stride = sizeof(structure::ObjectConstants);
+	std::vector<uint8_t> upload(objectNum * stride), reference(objectNum * stride);
+
+	// Best of a few runs, each run touches every matrix once
+	const unsigned int runNum = (std::max)(config.RunNum, 1u);
+	double best = 1e30;
+	for (unsigned int run = 0; run < runNum; ++run)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < objectNum; ++i)
+		{
+			XMMATRIX world =
+				XMMatrixScaling(arrays[7][i], arrays[8][i], arrays[9][i]) *
+				XMMatrixRotationQuaternion(XMVectorSet(arrays[3][i], arrays[4][i], arrays[5][i], arrays[6][i])) *
+				XMMatrixTranslation(arrays[0][i], arrays[1][i], arrays[2][i]);
+			XMStoreFloat4x4((XMFLOAT4X4*)(reference.data() + i * stride), world);
+		}
+		best = (std::min)(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+	}
+	result->XmMatricesPerSecond = double(objectNum) / 1e6 / best;
+
+	for (size_t isa = 0; isa < size_t(TransformBatch::ISA::NUM); ++isa)
+	{
+		if (!TransformBatch::IsSupported(TransformBatch::ISA(isa)))
+			continue;
+
+		best = 1e30;
+		for (unsigned int run = 0; run < runNum; ++run)
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			TransformBatch::Compose(transforms, objectNum, upload.data(), stride, false, TransformBatch::ISA(isa));
+			best = (std::min)(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+		}
+		result->MatricesPerSecond[isa] = double(objectNum) / 1e6 / best;
+
+		for (size_t i = 0; i < objectNum; ++i)
+		{
+			const float* expected	= (const float*)(reference.data() + i * stride);
+			const float* actual		= (const float*)(upload.data() + i * stride);
+			for (int e = 0; e < 16; ++e)
+				result->MaximumError = (std::max)(result->MaximumError, std::fabs(double(actual[e]) - expected[e]) / (std::max)(1.0, std::fabs(double(expected[e]))));
+		}
+	}
+
+	if (result->MaximumError > k_maximumError)
+		std::printf("transforms: kernels differ from XMMATRIX by %g\n", result->MaximumError);
+
+	return result->MaximumError <= k_maximumError;
+}
+
+/* Entry point */
+int BenchmarkTransform::Main(const char* commandLine)
+{
+	Config config;
+	std::string value;
+	if (BenchmarkReport::FindOption(commandLine, "objects", value))	config.ObjectNum	= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "runs", value))	config.RunNum		= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+	if (BenchmarkReport::FindOption(commandLine, "seed", value))	config.Seed			= (unsigned int)(std::strtoul(value.c_str(), nullptr, 10));
+
+	Result result;
+	const bool success = BenchmarkTransform::Run(config, &result);
+
+	using GATE = BenchmarkReport::GATE;
+	BenchmarkReport report("transforms");
+	report.Add("objects", config.ObjectNum, 0);
+	report.Add("seed", config.Seed, 0);
+	report.Add("transform_xm_mmat_per_s", result.XmMatricesPerSecond, 2);
+	for (size_t isa = 0; isa < size_t(TransformBatch::ISA::NUM); ++isa)
+	{
+		if (TransformBatch::IsSupported(TransformBatch::ISA(isa)))
+			report.Add((std::string("transform_") + TransformBatch::Name(TransformBatch::ISA(isa)) + "_mmat_per_s").c_str(), result.MatricesPerSecond[isa], 2, GATE::HIGHER);
+	}
+	report.Add("transform_max_error", result.MaximumError, 8);
+	return report.Finish(commandLine, success ? 0 : 1);
+}
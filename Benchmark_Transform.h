@@ -0,0 +1,55 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Benchmark_Transform.h
+*		Detail	: World matrices from SoA transforms, XMMATRIX loop against TransformBatch
+===================================================================================*/
+#pragma once
+#include "Scene_Transform.h"
+
+class BenchmarkTransform
+{
+public:
+	//**************************************************
+	/// \brief Workload parameters
+	//**************************************************
+	struct Config
+	{
+		unsigned int	ObjectNum	= 100000;
+		unsigned int	RunNum		= 5;		// best of
+		unsigned int	Seed		= 1;
+	};
+
+	//**************************************************
+	/// \brief Measured values, millions of matrices per second
+	//**************************************************
+	struct Result
+	{
+		double	XmMatricesPerSecond;									// one XMMATRIX composition per object
+		double	MatricesPerSecond[size_t(TransformBatch::ISA::NUM)];	// 0 when the kernel is unsupported
+		double	MaximumError;											// largest difference of a kernel to XMMATRIX
+	};
+
+public:
+	//**************************************************
+	/// \brief Compose every matrix with XMMATRIX and with every supported kernel
+	///        into ObjectConstants sized blocks like an upload ring
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool Run(
+		const Config& config,
+		Result* result
+	);
+
+	//**************************************************
+	/// \brief Benchmark entry point, the supported kernels are gated against a baseline
+	///        -objects= -runs= -seed=
+	///        -out=transforms.json -baseline=old.json -tolerance=0.1
+	///
+	/// \param[in] commandLine	 ->	options
+	///
+	/// \return process exit code, non zero on failure, mismatch or regression
+	//**************************************************
+	static int Main(const char* commandLine);
+};
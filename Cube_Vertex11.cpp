@@ -6,12 +6,15 @@
 ===================================================================================*/
 #include "Application.h"
 #include "Graphics_DirectX11.h"
+#include "Mesh_File.h"
 
 #include "Cube_Vertex11.h"
 using namespace structure;
 
-ID3D11Buffer* CubeVertex11::m_vertexBuffer;
-ID3D11Buffer* CubeVertex11::m_indexBuffer;
+GraphicsDirectX11::BufferHandle CubeVertex11::m_vertexBuffer;
+GraphicsDirectX11::BufferHandle CubeVertex11::m_indexBuffer;
+DXGI_FORMAT CubeVertex11::m_indexFormat = DXGI_FORMAT::DXGI_FORMAT_R16_UINT;
+std::vector<MeshIndex::Chunk> CubeVertex11::m_submeshes;
 
 static const Vertex3D g_planeMeta[]
 {
@@ -21,7 +24,7 @@ static const Vertex3D g_planeMeta[]
 	{{ 0.5,  0.5f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f}},	// RT
 };
 
-static const unsigned int g_planeIndex[]
+static const unsigned short g_planeIndex[]	// 16 bit, less than 65536 vertices
 {
 	0, 1, 3,
 	2, 3, 0
@@ -30,56 +33,95 @@ static const unsigned int g_planeIndex[]
 /* Load vertex data */
 bool CubeVertex11::Load(const wchar_t* fileName)
 {
-	UNREFERENCED_PARAMETER(fileName);
-
-	HRESULT ret{};
-	ID3D11Device* device = (ID3D11Device*)Application::Graphics()->Device();
-	if (!device)
+	GraphicsDirectX11* graphics = (GraphicsDirectX11*)Application::Graphics();
+	if (!graphics->Device())
 		return false;
 
+	// Mapped streams go to the buffers as they are, the quad is the fallback
+	MeshFile file;
+	const bool mapped = file.Open(fileName);
+
 	// Create vertex buffer
 	D3D11_BUFFER_DESC vertexDesc{};
-	vertexDesc.ByteWidth	= sizeof(Vertex3D) * 4;
+	vertexDesc.ByteWidth	= mapped ? file.VertexBytes() : sizeof(g_planeMeta);
 	vertexDesc.Usage		= D3D11_USAGE::D3D11_USAGE_DEFAULT;
 	vertexDesc.BindFlags	= D3D11_BIND_FLAG::D3D11_BIND_VERTEX_BUFFER;
 
-	D3D11_SUBRESOURCE_DATA vertexSubresource;
-	vertexSubresource.pSysMem = g_planeMeta;
-	ret = device->CreateBuffer(&vertexDesc, &vertexSubresource, &m_vertexBuffer);
-	if (FAILED(ret))
+	D3D11_SUBRESOURCE_DATA vertexSubresource{};
+	vertexSubresource.pSysMem = mapped ? file.Vertices() : g_planeMeta;
+	m_vertexBuffer = graphics->CreatePooledBuffer(vertexDesc, &vertexSubresource, GraphicsMemory::CATEGORY::GEOMETRY, "CubeVertex11::VertexBuffer");
+	if (!m_vertexBuffer.IsValid())
 		return false;
 
 	// Create index buffer
 	D3D11_BUFFER_DESC indexDesc{};
-	indexDesc.ByteWidth	= sizeof(unsigned int) * 6;
+	indexDesc.ByteWidth	= mapped ? file.IndexBytes() : sizeof(g_planeIndex);
 	indexDesc.Usage		= D3D11_USAGE::D3D11_USAGE_DEFAULT;
 	indexDesc.BindFlags	= D3D11_BIND_FLAG::D3D11_BIND_INDEX_BUFFER;
 
-	D3D11_SUBRESOURCE_DATA indexSubresource;
-	indexSubresource.pSysMem = g_planeIndex;
-	ret = device->CreateBuffer(&indexDesc, &indexSubresource, &m_indexBuffer);
-	if (FAILED(ret))
+	D3D11_SUBRESOURCE_DATA indexSubresource{};
+	indexSubresource.pSysMem = mapped ? file.Indices() : g_planeIndex;
+	m_indexBuffer = graphics->CreatePooledBuffer(indexDesc, &indexSubresource, GraphicsMemory::CATEGORY::GEOMETRY, "CubeVertex11::IndexBuffer");
+	if (!m_indexBuffer.IsValid())
 		return false;
 
+	m_indexFormat = (mapped && file.GetHeader()->IndexSize == sizeof(uint32_t)) ? DXGI_FORMAT::DXGI_FORMAT_R32_UINT : DXGI_FORMAT::DXGI_FORMAT_R16_UINT;
+
+	// Draw ranges of the file, chunks over 65536 vertices and nonzero bases need their own BaseVertex
+	m_submeshes.clear();
+	if (!mapped)
+	{
+		m_submeshes.push_back(MeshIndex::Chunk{ 0, _countof(g_planeIndex), 0 });
+	}
+	else if (file.GetHeader()->SubmeshNum == 0)
+	{
+		m_submeshes.push_back(MeshIndex::Chunk{ 0, file.GetHeader()->IndexNum, 0 });
+	}
+	else
+	{
+		for (uint32_t i = 0; i < file.GetHeader()->SubmeshNum; ++i)
+		{
+			const MeshFile::Submesh& submesh = file.Submeshes()[i];
+			m_submeshes.push_back(MeshIndex::Chunk{ submesh.StartIndex, submesh.IndexNum, submesh.BaseVertex });
+		}
+	}
 	return true;
 }
 
 /* Unload vertex buffer */
 void CubeVertex11::Unload()
 {
-	SAFE_RELEASE(m_vertexBuffer);
-	SAFE_RELEASE(m_indexBuffer);
+	GraphicsDirectX11* graphics = (GraphicsDirectX11*)Application::Graphics();
+	graphics->ReleaseBuffer(m_vertexBuffer);
+	graphics->ReleaseBuffer(m_indexBuffer);
+	m_vertexBuffer	= GraphicsDirectX11::BufferHandle{};
+	m_indexBuffer	= GraphicsDirectX11::BufferHandle{};
+	m_submeshes.clear();
 }
 
 /* Set vertex buffer */
 void CubeVertex11::Set()
 {
-	ID3D11DeviceContext* context = (ID3D11DeviceContext*)Application::Graphics()->Context();
-	if (!context)
+	GraphicsDirectX11* graphics = (GraphicsDirectX11*)Application::Graphics();
+	ID3D11DeviceContext* context = (ID3D11DeviceContext*)graphics->Context();
+	ID3D11Buffer* vertexBuffer = graphics->Buffer(m_vertexBuffer);
+	if (!context || !vertexBuffer)
 		return;
 
 	UINT stride = sizeof(Vertex3D);
 	UINT offset = 0;
-	context->IASetVertexBuffers(0, 1, &m_vertexBuffer, &stride, &offset);
-	context->IASetIndexBuffer(m_indexBuffer, DXGI_FORMAT::DXGI_FORMAT_R32_UINT, offset);
+	context->IASetVertexBuffers(0, 1, &vertexBuffer, &stride, &offset);
+	context->IASetIndexBuffer(graphics->Buffer(m_indexBuffer), m_indexFormat, offset);
+}
+
+/* Draw submeshes */
+void CubeVertex11::Draw()
+{
+	GraphicsDirectX11* graphics = (GraphicsDirectX11*)Application::Graphics();
+	ID3D11DeviceContext* context = (ID3D11DeviceContext*)graphics->Context();
+	if (!context || !graphics->Buffer(m_indexBuffer))
+		return;
+
+	for (const MeshIndex::Chunk& submesh : m_submeshes)
+		context->DrawIndexed(submesh.IndexNum, submesh.StartIndex, submesh.BaseVertex);
 }
@@ -5,6 +5,9 @@
 *		Detail	:
 ===================================================================================*/
 #pragma once
+#include <vector>
+
+#include "Mesh_Index.h"
 
 class ICube {};
 
@@ -14,9 +17,12 @@ public:
 	bool Load(const wchar_t* fileName);
 	void Unload() ;
 	void Set() ;
+	void Draw() ;	// one DrawIndexed per submesh, after Set
 
 private:
-	static ID3D11Buffer*	m_vertexBuffer;
-	static ID3D11Buffer*	m_indexBuffer;
+	static GraphicsDirectX11::BufferHandle	m_vertexBuffer;
+	static GraphicsDirectX11::BufferHandle	m_indexBuffer;
+	static DXGI_FORMAT						m_indexFormat;
+	static std::vector<MeshIndex::Chunk>	m_submeshes;	// 16 bit indices are relative to BaseVertex
 };
 
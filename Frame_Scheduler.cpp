@@ -0,0 +1,202 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Frame_Scheduler.cpp
+*		Detail	:
+===================================================================================*/
+#include <algorithm>
+#include <thread>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "Frame_Scheduler.h"
+using namespace std::chrono;
+
+//**************************************************
+/// \brief Hint to the processor that we are in a spin loop
+///
+/// \return none
+//**************************************************
+static inline void SpinPause()
+{
+#if defined(_WIN32)
+	YieldProcessor();
+#elif defined(__x86_64__) || defined(__i386__)
+	_mm_pause();
+#else
+	std::this_thread::yield();
+#endif
+}
+
+/* Constructor */
+FrameScheduler::FrameScheduler(const double targetFrameRate, const double fixedTimeStep)
+	:m_targetFrameTime(),
+	m_fixedTimeStep(fixedTimeStep),
+	m_accumulator(0.0),
+	m_stepCount(0),
+	m_history(),
+	m_historyHead(0),
+	m_historyCount(0),
+	m_waitableTimer(nullptr)
+{
+#if defined(_WIN32)
+	// High resolution timer is supported from Windows 10 1803, fallback is Sleep + spin
+	m_waitableTimer = CreateWaitableTimerEx(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+#endif
+	this->SetTargetFrameRate(targetFrameRate);
+	this->Reset();
+}
+
+/* Destructor */
+FrameScheduler::~FrameScheduler()
+{
+#if defined(_WIN32)
+	if (m_waitableTimer)
+		CloseHandle((HANDLE)m_waitableTimer);
+#endif
+}
+
+/* Begin frame */
+void FrameScheduler::BeginFrame()
+{
+	m_frameStart = Clock::now();
+	double elapsed = duration<double>(m_frameStart - m_lastFrameStart).count();
+	m_lastFrameStart = m_frameStart;
+
+	// Record frame time (start to start, includes pacing wait)
+	m_history[m_historyHead] = float(elapsed * 1000.0);
+	m_historyHead = (m_historyHead + 1) % k_historyNum;
+	m_historyCount = (std::min)(m_historyCount + 1, k_historyNum);
+
+	// Feed simulation, clamp long hitches so we never try to catch up forever
+	m_accumulator += (std::min)(elapsed, m_fixedTimeStep * k_maxSteps);
+	m_stepCount = 0;
+}
+
+/* Step simulation */
+bool FrameScheduler::Step()
+{
+	if (m_accumulator < m_fixedTimeStep || m_stepCount >= k_maxSteps)
+		return false;
+
+	m_accumulator -= m_fixedTimeStep;
+	++m_stepCount;
+	return true;
+}
+
+/* End frame */
+void FrameScheduler::EndFrame()
+{
+	if (m_targetFrameTime == Clock::duration::zero())
+		return;
+
+	Clock::time_point now = Clock::now();
+	m_nextDeadline += m_targetFrameTime;
+
+	if (m_nextDeadline < now)
+	{// Missed the deadline, re-sync instead of bursting frames to catch up
+		m_nextDeadline = now;
+		return;
+	}
+
+	this->WaitUntil(m_nextDeadline);
+}
+
+/* Reset */
+void FrameScheduler::Reset()
+{
+	m_frameStart		= Clock::now();
+	m_lastFrameStart	= m_frameStart;
+	m_nextDeadline		= m_frameStart;
+	m_accumulator		= 0.0;
+	m_stepCount			= 0;
+}
+
+/* Interpolation factor */
+float FrameScheduler::Alpha() const
+{
+	if (m_fixedTimeStep <= 0.0)
+		return 1.0f;
+
+	return float((std::min)(m_accumulator / m_fixedTimeStep, 1.0));
+}
+
+/* Set target frame rate */
+void FrameScheduler::SetTargetFrameRate(const double targetFrameRate)
+{
+	if (targetFrameRate <= 0.0)
+	{
+		m_targetFrameTime = Clock::duration::zero();
+		return;
+	}
+
+	m_targetFrameTime = duration_cast<Clock::duration>(duration<double>(1.0 / targetFrameRate));
+}
+
+/* Get statistics */
+FrameScheduler::Statistics FrameScheduler::GetStatistics() const
+{
+	Statistics stats{};
+	stats.Count = m_historyCount;
+	if (m_historyCount == 0)
+		return stats;
+
+	// Sort a copy on the stack, no heap allocation
+	std::array<float, k_historyNum> sorted{};
+	std::copy(m_history.begin(), m_history.begin() + m_historyCount, sorted.begin());
+	std::sort(sorted.begin(), sorted.begin() + m_historyCount);
+
+	double sum = 0.0;
+	for (size_t i = 0; i < m_historyCount; ++i)
+		sum += sorted[i];
+
+	auto percentile = [&](double p)
+	{
+		size_t index = size_t(p * double(m_historyCount - 1) + 0.5);
+		return double(sorted[index]);
+	};
+
+	stats.Average = sum / double(m_historyCount);
+	stats.Minimum = sorted[0];
+	stats.Maximum = sorted[m_historyCount - 1];
+	stats.P50 = percentile(0.50);
+	stats.P95 = percentile(0.95);
+	stats.P99 = percentile(0.99);
+	return stats;
+}
+
+// Wait until deadline
+void FrameScheduler::WaitUntil(const Clock::time_point deadline)
+{
+	// OS sleep has coarse granularity, leave the tail of the wait to a spin loop
+	const Clock::duration spinThreshold = m_waitableTimer ? Clock::duration(microseconds(500)) : Clock::duration(milliseconds(2));
+
+	Clock::time_point now = Clock::now();
+	if (deadline - now > spinThreshold)
+	{
+		Clock::duration sleepTime = deadline - now - spinThreshold;
+#if defined(_WIN32)
+		if (m_waitableTimer)
+		{
+			LARGE_INTEGER dueTime{};
+			dueTime.QuadPart = -LONGLONG(duration_cast<nanoseconds>(sleepTime).count() / 100);	// relative time in 100ns unit
+			if (SetWaitableTimerEx((HANDLE)m_waitableTimer, &dueTime, 0, nullptr, nullptr, nullptr, 0))
+				WaitForSingleObject((HANDLE)m_waitableTimer, INFINITE);
+		}
+		else
+#endif
+		{
+			std::this_thread::sleep_for(sleepTime);
+		}
+	}
+
+	while (Clock::now() < deadline)
+		SpinPause();
+}
@@ -0,0 +1,134 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Frame_Scheduler.h
+*		Detail	: Frame pacing, fixed timestep simulation and frame time statistics
+===================================================================================*/
+#pragma once
+#include <array>
+#include <chrono>
+
+class FrameScheduler
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	//**************************************************
+	/// \brief Frame time percentiles of recent frames
+	//**************************************************
+	struct Statistics
+	{
+		double	Average;	// average frame time (ms)
+		double	Minimum;	// fastest frame time (ms)
+		double	Maximum;	// slowest frame time (ms)
+		double	P50;		// median frame time (ms)
+		double	P95;		// 95th percentile frame time (ms)
+		double	P99;		// 99th percentile frame time (ms)
+		size_t	Count;		// number of frames sampled
+	};
+
+public:
+	//**************************************************
+	/// \brief Constructor
+	///
+	/// \param[in] targetFrameRate	->	frame rate limit (0 is unlimited)
+	/// \param[in] fixedTimeStep	->	simulation step in seconds
+	///
+	/// \return none
+	//**************************************************
+	FrameScheduler(
+		const double targetFrameRate,
+		const double fixedTimeStep
+	);
+
+	//**************************************************
+	/// \brief Destructor
+	///
+	/// \return none
+	//**************************************************
+	~FrameScheduler();
+
+	//**************************************************
+	/// \brief Begin frame, measure elapsed time and feed the simulation accumulator
+	///
+	/// \return none
+	//**************************************************
+	void BeginFrame();
+
+	//**************************************************
+	/// \brief Consume one fixed simulation step
+	///
+	/// \return if a step should be simulated then true
+	//**************************************************
+	bool Step();
+
+	//**************************************************
+	/// \brief End frame and wait until the target frame time has passed
+	///
+	/// \return none
+	//**************************************************
+	void EndFrame();
+
+	//**************************************************
+	/// \brief Forget accumulated time (after idle or minimized periods)
+	///
+	/// \return none
+	//**************************************************
+	void Reset();
+
+	//**************************************************
+	/// \brief Interpolation factor between the last two simulation steps
+	///
+	/// \return blend factor in range [0, 1]
+	//**************************************************
+	float Alpha() const;
+
+	//**************************************************
+	/// \brief Change frame rate limit
+	///
+	/// \param[in] targetFrameRate	->	frame rate limit (0 is unlimited)
+	///
+	/// \return none
+	//**************************************************
+	void SetTargetFrameRate(const double targetFrameRate);
+
+	//**************************************************
+	/// \brief Fixed simulation step
+	///
+	/// \return step in seconds
+	//**************************************************
+	double FixedTimeStep() const { return m_fixedTimeStep; }
+
+	//**************************************************
+	/// \brief Calculate frame time statistics of recent frames
+	///
+	/// \return statistics
+	//**************************************************
+	Statistics GetStatistics() const;
+
+private:
+	//**************************************************
+	/// \brief Sleep coarsely then spin until deadline
+	///
+	/// \param[in] deadline	->	wake up time
+	///
+	/// \return none
+	//**************************************************
+	void WaitUntil(const Clock::time_point deadline);
+
+	static const size_t		k_historyNum	= 512;	// number of frame times kept for statistics
+	static const int		k_maxSteps		= 8;	// simulation steps per frame limit (avoid spiral of death)
+
+	Clock::duration			m_targetFrameTime;	// zero is unlimited
+	Clock::time_point		m_frameStart;		// begin of current frame
+	Clock::time_point		m_lastFrameStart;	// begin of previous frame
+	Clock::time_point		m_nextDeadline;		// target end of current frame
+	double					m_fixedTimeStep;	// simulation step (sec)
+	double					m_accumulator;		// unsimulated time (sec)
+	int						m_stepCount;		// steps simulated in current frame
+	std::array<float, k_historyNum> m_history;	// frame times (ms) ring buffer
+	size_t					m_historyHead;		// next write position
+	size_t					m_historyCount;		// valid samples
+	void*					m_waitableTimer;	// high resolution timer handle (windows)
+};
+
@@ -0,0 +1,82 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Graphics_Backend.h
+*		Detail	: Backend fixed at compile time, calls bind to the final classes
+===================================================================================*/
+#pragma once
+
+//**************************************************
+/// \brief Define GRAPHICS_BACKEND to one of these for a shipped build,
+///        RUNTIME keeps the choice in Application for tools and benchmarks
+//**************************************************
+#define GRAPHICS_BACKEND_RUNTIME	0
+#define GRAPHICS_BACKEND_DIRECTX11	1
+#define GRAPHICS_BACKEND_DIRECTX12	2
+#define GRAPHICS_BACKEND_SOFTWARE	3
+#define GRAPHICS_BACKEND_NULL		4
+
+#if !defined(GRAPHICS_BACKEND)
+#define GRAPHICS_BACKEND GRAPHICS_BACKEND_RUNTIME
+#endif
+
+#define GRAPHICS_BACKEND_STATIC	(GRAPHICS_BACKEND != GRAPHICS_BACKEND_RUNTIME)
+
+class IGraphics;
+class ICommandContext;
+class IObject;
+class GraphicsDirectX11;
+class GraphicsDirectX12;
+class GraphicsSoftware;
+class GraphicsNull;
+class ObjectCube11;
+class ObjectCube12;
+class ObjectCubeSoftware;
+
+//**************************************************
+/// \brief Classes of a backend, the interfaces when it is chosen at runtime
+///        Concrete classes are final, so calls through them need no vtable
+//**************************************************
+template<int BACKEND>
+struct GraphicsBackend
+{
+	using Graphics	= IGraphics;
+	using Context	= ICommandContext;	// cpu backends only
+	using Cube		= IObject;
+};
+
+template<>
+struct GraphicsBackend<GRAPHICS_BACKEND_DIRECTX11>
+{
+	using Graphics	= GraphicsDirectX11;
+	using Context	= ICommandContext;
+	using Cube		= ObjectCube11;
+};
+
+template<>
+struct GraphicsBackend<GRAPHICS_BACKEND_DIRECTX12>
+{
+	using Graphics	= GraphicsDirectX12;
+	using Context	= ICommandContext;
+	using Cube		= ObjectCube12;
+};
+
+template<>
+struct GraphicsBackend<GRAPHICS_BACKEND_SOFTWARE>
+{
+	using Graphics	= GraphicsSoftware;
+	using Context	= GraphicsSoftware;
+	using Cube		= ObjectCubeSoftware;
+};
+
+template<>
+struct GraphicsBackend<GRAPHICS_BACKEND_NULL>
+{
+	using Graphics	= GraphicsNull;
+	using Context	= GraphicsNull;
+	using Cube		= ObjectCubeSoftware;
+};
+
+using StaticGraphics	= GraphicsBackend<GRAPHICS_BACKEND>::Graphics;
+using StaticContext		= GraphicsBackend<GRAPHICS_BACKEND>::Context;
+using StaticCube		= GraphicsBackend<GRAPHICS_BACKEND>::Cube;
@@ -0,0 +1,20 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Graphics_CommandContext.h
+*		Detail	: Draw interface of backends which run on the cpu (no device object)
+===================================================================================*/
+#pragma once
+#include "Graphics_Interface.h"
+
+class ICommandContext
+{
+public:
+	virtual ~ICommandContext() {};
+	virtual void SetVertexBuffer(const structure::Vertex3D* vertices, unsigned int vertexNum)	= 0;
+	virtual void SetIndexBuffer(const unsigned int* indices, unsigned int indexNum)				= 0;
+	virtual void SetIndexBuffer(const unsigned short* indices, unsigned int indexNum)			= 0;
+	virtual void SetWorldMatrix(const DirectX::XMFLOAT4X4& world)								= 0;
+	virtual void SetMaterialColor(const DirectX::XMFLOAT4& color)								= 0;
+	virtual void DrawIndexed(unsigned int indexNum, unsigned int startIndex, int baseVertex)	= 0;
+};
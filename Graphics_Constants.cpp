@@ -0,0 +1,107 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Graphics_Constants.cpp
+*		Detail	: Shader constants grouped by update frequency with dirty tracking
+===================================================================================*/
+#include <cstring>
+
+#include "Graphics_Constants.h"
+using namespace DirectX;
+using namespace structure;
+
+/* Constructor */
+GraphicsConstants::GraphicsConstants()
+	:m_object(),
+	m_frame(),
+	m_pass(),
+	m_dirty(0)
+{
+	// Identity camera and world keep vertices in clip space until a camera is set
+	XMStoreFloat4x4(&m_object.World, XMMatrixIdentity());
+	XMStoreFloat4x4(&m_frame.ViewProjection, XMMatrixIdentity());
+	m_object.MaterialColor	= XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f);
+	m_frame.CameraPosition	= XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f);
+	this->Invalidate();
+}
+
+/* Set camera */
+void GraphicsConstants::SetCamera(const XMFLOAT4X4& view, const XMFLOAT4X4& projection)
+{
+	XMMATRIX viewMatrix = XMLoadFloat4x4(&view);
+	XMStoreFloat4x4(&m_frame.ViewProjection, XMMatrixMultiply(viewMatrix, XMLoadFloat4x4(&projection)));
+
+	// Camera position is the translation of the inverse view
+	XMMATRIX inverseView = XMMatrixInverse(nullptr, viewMatrix);
+	XMStoreFloat4(&m_frame.CameraPosition, XMVectorSetW(inverseView.r[3], 1.0f));
+
+	m_dirty |= 1u << uint32_t(CONSTANT_FREQUENCY::FRAME);
+}
+
+/* Set viewport */
+void GraphicsConstants::SetViewport(const int width, const int height)
+{
+	if (width <= 0 || height <= 0)
+		return;
+
+	XMFLOAT4 size(float(width), float(height), 1.0f / float(width), 1.0f / float(height));
+	if (std::memcmp(&m_pass.ViewportSize, &size, sizeof(XMFLOAT4)) == 0)
+		return;
+
+	m_pass.ViewportSize = size;
+	m_dirty |= 1u << uint32_t(CONSTANT_FREQUENCY::PASS);
+}
+
+/* Set object */
+void GraphicsConstants::SetObject(const XMFLOAT4X4& world, const XMFLOAT4& materialColor)
+{
+	// Repeated draws of one object upload nothing
+	if (std::memcmp(&m_object.World, &world, sizeof(XMFLOAT4X4)) == 0 &&
+		std::memcmp(&m_object.MaterialColor, &materialColor, sizeof(XMFLOAT4)) == 0)
+		return;
+
+	m_object.World			= world;
+	m_object.MaterialColor	= materialColor;
+	m_dirty |= 1u << uint32_t(CONSTANT_FREQUENCY::OBJECT);
+}
+
+/* Invalidate */
+void GraphicsConstants::Invalidate()
+{
+	m_dirty = (1u << uint32_t(CONSTANT_FREQUENCY::NUM)) - 1;
+}
+
+/* Consume dirty flag */
+bool GraphicsConstants::Consume(const CONSTANT_FREQUENCY frequency)
+{
+	const uint32_t bit = 1u << uint32_t(frequency);
+	if (!(m_dirty & bit))
+		return false;
+
+	m_dirty &= ~bit;
+	return true;
+}
+
+/* Data */
+const void* GraphicsConstants::Data(const CONSTANT_FREQUENCY frequency) const
+{
+	switch (frequency)
+	{
+	case CONSTANT_FREQUENCY::OBJECT:	return &m_object;
+	case CONSTANT_FREQUENCY::FRAME:		return &m_frame;
+	case CONSTANT_FREQUENCY::PASS:		return &m_pass;
+	default:							return nullptr;
+	}
+}
+
+/* Size */
+size_t GraphicsConstants::Size(const CONSTANT_FREQUENCY frequency)
+{
+	switch (frequency)
+	{
+	case CONSTANT_FREQUENCY::OBJECT:	return sizeof(ObjectConstants);
+	case CONSTANT_FREQUENCY::FRAME:		return sizeof(FrameConstants);
+	case CONSTANT_FREQUENCY::PASS:		return sizeof(PassConstants);
+	default:							return 0;
+	}
+}
@@ -0,0 +1,118 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Graphics_Constants.h
+*		Detail	: Shader constants grouped by update frequency with dirty tracking
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include <DirectXMath.h>
+
+namespace structure
+{
+	//**************************************************
+	/// \brief Constant blocks by update frequency, the value is the shader register
+	//**************************************************
+	enum class CONSTANT_FREQUENCY
+	{
+		OBJECT,		// b0 every draw
+		FRAME,		// b1 once per frame
+		PASS,		// b2 when the render target changes
+		NUM
+	};
+
+	//**************************************************
+	/// \brief b0, matrices are row_major in the shader
+	//**************************************************
+	struct ObjectConstants
+	{
+		DirectX::XMFLOAT4X4	World;
+		DirectX::XMFLOAT4	MaterialColor;
+	};
+
+	//**************************************************
+	/// \brief b1, view and projection are multiplied on the cpu once per frame
+	//**************************************************
+	struct FrameConstants
+	{
+		DirectX::XMFLOAT4X4	ViewProjection;
+		DirectX::XMFLOAT4	CameraPosition;	// w is 1
+	};
+
+	//**************************************************
+	/// \brief b2
+	//**************************************************
+	struct PassConstants
+	{
+		DirectX::XMFLOAT4	ViewportSize;	// width, height, 1 / width, 1 / height
+	};
+}
+
+class GraphicsConstants
+{
+public:
+	GraphicsConstants();
+
+	//**************************************************
+	/// \brief Precompute view projection, marks FRAME dirty
+	///
+	/// \param[in] view			 ->	row vector view matrix
+	/// \param[in] projection	 ->	row vector projection matrix
+	///
+	/// \return none
+	//**************************************************
+	void SetCamera(
+		const DirectX::XMFLOAT4X4& view,
+		const DirectX::XMFLOAT4X4& projection
+	);
+
+	//**************************************************
+	/// \brief Set render target size, marks PASS dirty when it changed
+	///
+	/// \return none
+	//**************************************************
+	void SetViewport(
+		const int width,
+		const int height
+	);
+
+	//**************************************************
+	/// \brief Set constants of the next draw, marks OBJECT dirty when they changed
+	///
+	/// \return none
+	//**************************************************
+	void SetObject(
+		const DirectX::XMFLOAT4X4& world,
+		const DirectX::XMFLOAT4& materialColor
+	);
+
+	//**************************************************
+	/// \brief Mark every block dirty, after the bindings were lost
+	///
+	/// \return none
+	//**************************************************
+	void Invalidate();
+
+	//**************************************************
+	/// \brief Take the dirty flag of a block
+	///
+	/// \return if the block has to be uploaded then true
+	//**************************************************
+	bool Consume(const structure::CONSTANT_FREQUENCY frequency);
+
+	//**************************************************
+	/// \brief Cpu copy and size of a block
+	//**************************************************
+	const void*		Data(const structure::CONSTANT_FREQUENCY frequency) const;
+	static size_t	Size(const structure::CONSTANT_FREQUENCY frequency);
+
+	uint32_t		DirtyMask() const	{ return m_dirty; }
+
+private:
+	structure::ObjectConstants	m_object;
+	structure::FrameConstants	m_frame;
+	structure::PassConstants	m_pass;
+	uint32_t					m_dirty;	// bit per CONSTANT_FREQUENCY
+};
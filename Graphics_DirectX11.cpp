@@ -4,6 +4,8 @@
 *		File	: Graphics_DirectX11.cpp
 *		Detail	:
 ===================================================================================*/
+#include <algorithm>
+#include <cstring>
 #include <d3dcompiler.h>
 #pragma comment(lib, "d3dcompiler.lib")
 
@@ -41,6 +43,12 @@ bool GraphicsDirectX11::Init(int width, int height, void* handle)
 		return false;
 
 	this->SetViewport(width, height);
+	this->UpdateMemoryBudget();
+
+#if PROFILER_ENABLE
+	if (!this->CreateTimerQueries())
+		return false;
+#endif
 
 	return true;	// Success
 }
@@ -48,23 +56,67 @@ bool GraphicsDirectX11::Init(int width, int height, void* handle)
 /* Uninitialize */
 void GraphicsDirectX11::Uninit()
 {
-	SAFE_RELEASE(m_projectionMatrix);
-	SAFE_RELEASE(m_viewMatrix);
-	SAFE_RELEASE(m_modelMatrix);
+#if PROFILER_ENABLE
+	for (UINT i = 0; i < k_timerLatency; ++i)
+	{
+		SAFE_RELEASE(m_timerEnd[i]);
+		SAFE_RELEASE(m_timerBegin[i]);
+		SAFE_RELEASE(m_timerDisjoint[i]);
+	}
+#endif
+	for (auto& layouts : m_packedInputLayouts)
+	{
+		for (ID3D11InputLayout*& layout : layouts)
+		{
+			SAFE_RELEASE(layout);
+		}
+	}
+	SAFE_RELEASE(m_packedVertexShader);
+	SAFE_RELEASE(m_pixelShader);
+	SAFE_RELEASE(m_vertexShader);
+	SAFE_RELEASE(m_inputLayout);
+	SAFE_RELEASE_TRACKED(m_vertexLayoutBuffer);
+	for (ID3D11Buffer*& buffer : m_constantBuffers)
+	{
+		SAFE_RELEASE_TRACKED(buffer);
+	}
 	SAFE_RELEASE(m_samplerState);
 	SAFE_RELEASE(m_depthStencilState);
 	SAFE_RELEASE(m_blendState);
 	SAFE_RELEASE(m_rasterizerState);
 	SAFE_RELEASE(m_depthStencilView);
+	SAFE_RELEASE_TRACKED(m_depthStencil);
 	SAFE_RELEASE(m_renderTargetView);
-	SAFE_RELEASE(m_swapChain);
+	SAFE_RELEASE_TRACKED(m_swapChain);
+	SAFE_RELEASE(m_adapter);
 	SAFE_RELEASE(m_context);
 	SAFE_RELEASE(m_device);
+
+	// Everything created by this backend and the objects is released at this point
+	GraphicsMemory::ReportLeaks();
+
+	// Buffers the objects forgot were reported above
+	for (size_t i = 0; i < m_buffers.Size(); ++i)
+	{
+		SAFE_RELEASE_TRACKED(m_buffers.Data<0>()[i]);
+	}
+	m_buffers.Clear();
 }
 
 /* Clear screen */
 void GraphicsDirectX11::Clear()
 {
+	PROFILE_SCOPE("GraphicsDirectX11::Clear");
+
+#if PROFILER_ENABLE
+	this->ResolveTimerQueries();
+
+	const UINT slot = UINT(m_timerFrame % k_timerLatency);
+	m_context->Begin(m_timerDisjoint[slot]);
+	m_context->End(m_timerBegin[slot]);
+	m_timerCpuBegin[slot] = Profiler::Now();
+#endif
+
 	float clearColor[4]{ 0.0f, 0.5f, 0.0f, 1.0f };
 	m_context->ClearRenderTargetView(m_renderTargetView, clearColor);
 	m_context->ClearDepthStencilView(m_depthStencilView, D3D11_CLEAR_FLAG::D3D11_CLEAR_DEPTH, D3D11_MAX_DEPTH, NULL);
@@ -77,7 +129,21 @@ void GraphicsDirectX11::Clear()
 /* Present buffer */
 void GraphicsDirectX11::Present()
 {
-	m_swapChain->Present(true, NULL);
+	PROFILE_SCOPE("GraphicsDirectX11::Present");
+
+#if PROFILER_ENABLE
+	const UINT slot = UINT(m_timerFrame % k_timerLatency);
+	m_context->End(m_timerEnd[slot]);
+	m_context->End(m_timerDisjoint[slot]);
+	++m_timerFrame;
+#endif
+
+	// While occluded only test the output, do not waste gpu on frames nobody sees
+	HRESULT ret = m_swapChain->Present(m_occluded ? 0 : 1, m_occluded ? DXGI_PRESENT_TEST : 0);
+	m_occluded = (ret == DXGI_STATUS_OCCLUDED);
+
+	if (++m_presentCount % k_budgetInterval == 0)
+		this->UpdateMemoryBudget();
 }
 
 /* Get device pointer */
@@ -92,6 +158,136 @@ void* GraphicsDirectX11::Context()
 	return m_context;
 }
 
+/* Occluded */
+bool GraphicsDirectX11::Occluded()
+{
+	return m_occluded;
+}
+
+/* Set vertex layout */
+void GraphicsDirectX11::SetVertexLayout(const structure::VertexLayout* layout)
+{
+	if (!layout)
+	{
+		m_context->IASetInputLayout(m_inputLayout);
+		m_context->VSSetShader(m_vertexShader, nullptr, 0);
+		return;
+	}
+
+	// First three float4 of VertexLayout are the cbuffer contents
+	m_context->UpdateSubresource(m_vertexLayoutBuffer, 0, nullptr, layout, 0, 0);
+	m_context->IASetInputLayout(m_packedInputLayouts[(size_t)layout->Position][(size_t)layout->TexCoord]);
+	m_context->VSSetShader(m_packedVertexShader, nullptr, 0);
+}
+
+/* Set camera */
+void GraphicsDirectX11::SetCamera(const XMFLOAT4X4& view, const XMFLOAT4X4& projection)
+{
+	m_constants.SetCamera(view, projection);
+}
+
+/* Set object constants */
+void GraphicsDirectX11::SetObjectConstants(const XMFLOAT4X4& world, const XMFLOAT4& color)
+{
+	m_constants.SetObject(world, color);
+	this->UploadConstants();
+}
+
+/* Create tracked buffer */
+HRESULT GraphicsDirectX11::CreateBuffer(ID3D11Device* device, const D3D11_BUFFER_DESC& desc, const D3D11_SUBRESOURCE_DATA* data, ID3D11Buffer** buffer, const GraphicsMemory::CATEGORY category, const char* name)
+{
+	HRESULT ret = device->CreateBuffer(&desc, data, buffer);
+	if (SUCCEEDED(ret))
+		GraphicsMemory::Track(*buffer, category, desc.ByteWidth, name);
+
+	return ret;
+}
+
+/* Create pooled buffer */
+GraphicsDirectX11::BufferHandle GraphicsDirectX11::CreatePooledBuffer(const D3D11_BUFFER_DESC& desc, const D3D11_SUBRESOURCE_DATA* data, const GraphicsMemory::CATEGORY category, const char* name)
+{
+	ID3D11Buffer* buffer = nullptr;
+	if (FAILED(GraphicsDirectX11::CreateBuffer(m_device, desc, data, &buffer, category, name)))
+		return BufferHandle{};
+
+	BufferHandle handle = m_buffers.Create(buffer, desc.ByteWidth, category);
+	if (!handle.IsValid())
+	{
+		SAFE_RELEASE_TRACKED(buffer);
+	}
+	return handle;
+}
+
+/* Release pooled buffer */
+void GraphicsDirectX11::ReleaseBuffer(const BufferHandle handle)
+{
+	ID3D11Buffer** buffer = m_buffers.Get<0>(handle);
+	if (!buffer)
+		return;
+
+	SAFE_RELEASE_TRACKED(*buffer);
+	m_buffers.Destroy(handle);
+}
+
+/* Pooled buffer */
+ID3D11Buffer* GraphicsDirectX11::Buffer(const BufferHandle handle) const
+{
+	ID3D11Buffer* const* buffer = m_buffers.Get<0>(handle);
+	return buffer ? *buffer : nullptr;
+}
+
+/* Create tracked texture */
+HRESULT GraphicsDirectX11::CreateTexture2D(ID3D11Device* device, const D3D11_TEXTURE2D_DESC& desc, const D3D11_SUBRESOURCE_DATA* data, ID3D11Texture2D** texture, const GraphicsMemory::CATEGORY category, const char* name)
+{
+	HRESULT ret = device->CreateTexture2D(&desc, data, texture);
+	if (FAILED(ret))
+		return ret;
+
+	// Bits of one pixel or one 4x4 block for compressed formats
+	UINT bits = 32;
+	bool block = false;
+	switch (desc.Format)
+	{
+	case DXGI_FORMAT::DXGI_FORMAT_R32G32B32A32_FLOAT:	bits = 128;	break;
+	case DXGI_FORMAT::DXGI_FORMAT_R16G16B16A16_FLOAT:
+	case DXGI_FORMAT::DXGI_FORMAT_R16G16B16A16_UNORM:
+	case DXGI_FORMAT::DXGI_FORMAT_R32G32_FLOAT:			bits = 64;	break;
+	case DXGI_FORMAT::DXGI_FORMAT_D16_UNORM:
+	case DXGI_FORMAT::DXGI_FORMAT_R16_UNORM:
+	case DXGI_FORMAT::DXGI_FORMAT_R16_FLOAT:
+	case DXGI_FORMAT::DXGI_FORMAT_R8G8_UNORM:			bits = 16;	break;
+	case DXGI_FORMAT::DXGI_FORMAT_R8_UNORM:				bits = 8;	break;
+	case DXGI_FORMAT::DXGI_FORMAT_BC1_UNORM:
+	case DXGI_FORMAT::DXGI_FORMAT_BC1_UNORM_SRGB:
+	case DXGI_FORMAT::DXGI_FORMAT_BC4_UNORM:			bits = 64;	block = true;	break;
+	case DXGI_FORMAT::DXGI_FORMAT_BC3_UNORM:
+	case DXGI_FORMAT::DXGI_FORMAT_BC3_UNORM_SRGB:
+	case DXGI_FORMAT::DXGI_FORMAT_BC5_UNORM:
+	case DXGI_FORMAT::DXGI_FORMAT_BC7_UNORM:
+	case DXGI_FORMAT::DXGI_FORMAT_BC7_UNORM_SRGB:		bits = 128;	block = true;	break;
+	default:														break;
+	}
+
+	// Driver padding is unknown, sum of all mips is the lower bound
+	uint64_t size = 0;
+	UINT mipLevels = desc.MipLevels ? desc.MipLevels : 1;
+	for (UINT mip = 0; mip < mipLevels; ++mip)
+	{
+		uint64_t width	= (std::max)(1u, desc.Width >> mip);
+		uint64_t height	= (std::max)(1u, desc.Height >> mip);
+		if (block)
+		{
+			width	= (width + 3) / 4;
+			height	= (height + 3) / 4;
+		}
+		size += width * height * bits / 8;
+	}
+	size *= desc.ArraySize * (std::max)(1u, desc.SampleDesc.Count);
+
+	GraphicsMemory::Track(*texture, category, size, name);
+	return ret;
+}
+
 // Create device and swapchain
 bool GraphicsDirectX11::CreateDeviceAndSwapChain(const int width, const int height, const HWND hWnd)
 {
@@ -127,6 +323,26 @@ bool GraphicsDirectX11::CreateDeviceAndSwapChain(const int width, const int heig
 	if (FAILED(ret))
 		return false;
 
+	GraphicsMemory::Track(
+		m_swapChain,
+		GraphicsMemory::CATEGORY::RENDER_TARGETS,
+		uint64_t(width) * height * 4 * desc.BufferCount,
+		"SwapChain"
+	);
+
+	// Budget query needs Windows 10, without it only tracked totals are reported
+	IDXGIDevice* dxgiDevice{};
+	if (SUCCEEDED(m_device->QueryInterface(__uuidof(IDXGIDevice), (void**)&dxgiDevice)))
+	{
+		IDXGIAdapter* adapter{};
+		if (SUCCEEDED(dxgiDevice->GetAdapter(&adapter)))
+		{
+			adapter->QueryInterface(__uuidof(IDXGIAdapter3), (void**)&m_adapter);
+			SAFE_RELEASE(adapter);
+		}
+		SAFE_RELEASE(dxgiDevice);
+	}
+
 	return true;	// Success
 }
 
@@ -156,7 +372,6 @@ bool GraphicsDirectX11::CreateRenderTargetView()
 bool GraphicsDirectX11::CreateDepthStencilView(const int width, const int height)
 {
 	HRESULT ret{};
-	ID3D11Texture2D* depthStencil{};
 	D3D11_TEXTURE2D_DESC textureDesc{};
 	textureDesc.Width					= width;
 	textureDesc.Height					= height;
@@ -169,7 +384,7 @@ bool GraphicsDirectX11::CreateDepthStencilView(const int width, const int height
 	textureDesc.BindFlags				= D3D11_BIND_FLAG::D3D11_BIND_DEPTH_STENCIL;
 	textureDesc.CPUAccessFlags			= 0;
 	textureDesc.MiscFlags				= 0;
-	ret = m_device->CreateTexture2D(&textureDesc, nullptr, &depthStencil);
+	ret = GraphicsDirectX11::CreateTexture2D(m_device, textureDesc, nullptr, &m_depthStencil, GraphicsMemory::CATEGORY::RENDER_TARGETS, "DepthStencil");
 	if (FAILED(ret))
 		return false;
 
@@ -178,17 +393,12 @@ bool GraphicsDirectX11::CreateDepthStencilView(const int width, const int height
 	viewDesc.ViewDimension	= D3D11_DSV_DIMENSION::D3D11_DSV_DIMENSION_TEXTURE2D;
 	viewDesc.Flags			= 0;
 
-	ret = m_device->CreateDepthStencilView(depthStencil, &viewDesc, &m_depthStencilView);
+	ret = m_device->CreateDepthStencilView(m_depthStencil, &viewDesc, &m_depthStencilView);
 	if (FAILED(ret))
-	{
-		SAFE_RELEASE(depthStencil);
 		return false;
-	}
-		
 
 	// Set to render target
 	m_context->OMSetRenderTargets(1, &m_renderTargetView, m_depthStencilView);
-	SAFE_RELEASE(depthStencil);
 
 	return true;	// Success
 }
@@ -285,33 +495,59 @@ bool GraphicsDirectX11::CreateConstantBuffers()
 {
 	HRESULT ret{};
 	D3D11_BUFFER_DESC bufferDesc{};
-	bufferDesc.ByteWidth = sizeof(XMMATRIX);
-	bufferDesc.Usage = D3D11_USAGE::D3D11_USAGE_DEFAULT;
+	bufferDesc.Usage = D3D11_USAGE::D3D11_USAGE_DYNAMIC;	// Rewritten with WRITE_DISCARD, the driver renames the memory
 	bufferDesc.BindFlags = D3D11_BIND_FLAG::D3D11_BIND_CONSTANT_BUFFER;
-	bufferDesc.CPUAccessFlags = 0;
+	bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_FLAG::D3D11_CPU_ACCESS_WRITE;
 	bufferDesc.MiscFlags = 0;
-	bufferDesc.StructureByteStride = sizeof(float);
+	bufferDesc.StructureByteStride = 0;
 
-	ret = m_device->CreateBuffer(&bufferDesc, nullptr, &m_modelMatrix);
-	if (FAILED(ret))
-		return false;
+	const char* names[]{ "ObjectConstants", "FrameConstants", "PassConstants" };
+	for (size_t i = 0; i < (size_t)structure::CONSTANT_FREQUENCY::NUM; ++i)
+	{
+		bufferDesc.ByteWidth = UINT(GraphicsConstants::Size((structure::CONSTANT_FREQUENCY)i) + 15) & ~15u;
+		ret = GraphicsDirectX11::CreateBuffer(m_device, bufferDesc, nullptr, &m_constantBuffers[i], GraphicsMemory::CATEGORY::CONSTANTS, names[i]);
+		if (FAILED(ret))
+			return false;
+	}
 
-	m_device->CreateBuffer(&bufferDesc, nullptr, &m_viewMatrix);
+	bufferDesc.ByteWidth = sizeof(float) * 12;
+	bufferDesc.Usage = D3D11_USAGE::D3D11_USAGE_DEFAULT;
+	bufferDesc.CPUAccessFlags = 0;
+	ret = GraphicsDirectX11::CreateBuffer(m_device, bufferDesc, nullptr, &m_vertexLayoutBuffer, GraphicsMemory::CATEGORY::CONSTANTS, "VertexLayout");
 	if (FAILED(ret))
 		return false;
 
-	m_device->CreateBuffer(&bufferDesc, nullptr, &m_projectionMatrix);
-	if (FAILED(ret))
-		return false;
+	// Set to constant buffers, register is the CONSTANT_FREQUENCY value
+	m_context->VSSetConstantBuffers(0, UINT(structure::CONSTANT_FREQUENCY::NUM), m_constantBuffers);	// register b0 object, b1 frame, b2 pass
+	m_context->VSSetConstantBuffers(3, 1, &m_vertexLayoutBuffer); // register b3 packed vertex dequantization
 
-	// Set to constant buffers
-	m_context->VSSetConstantBuffers(0, 1, &m_modelMatrix);      // register b0 model matrix
-	m_context->VSSetConstantBuffers(1, 1, &m_viewMatrix);       // register b1 view matrix
-	m_context->VSSetConstantBuffers(2, 1, &m_projectionMatrix); // register b2 projection matrix 
+	// Dynamic buffers have undefined contents until the first map
+	m_constants.Invalidate();
+	this->UploadConstants();
 
 	return true;	// Success
 }
 
+// Upload constants
+void GraphicsDirectX11::UploadConstants()
+{
+	if (!m_constants.DirtyMask())
+		return;
+
+	for (size_t i = 0; i < (size_t)structure::CONSTANT_FREQUENCY::NUM; ++i)
+	{
+		const structure::CONSTANT_FREQUENCY frequency = (structure::CONSTANT_FREQUENCY)i;
+		if (!m_constants.Consume(frequency))
+			continue;
+
+		D3D11_MAPPED_SUBRESOURCE mapped{};
+		if (FAILED(m_context->Map(m_constantBuffers[i], 0, D3D11_MAP::D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+			continue;
+		std::memcpy(mapped.pData, m_constants.Data(frequency), GraphicsConstants::Size(frequency));
+		m_context->Unmap(m_constantBuffers[i], 0);
+	}
+}
+
 // Create shader
 bool GraphicsDirectX11::CreateShader()
 {
@@ -365,8 +601,58 @@ bool GraphicsDirectX11::CreateShader()
 		return false;
 	}
 	SAFE_RELEASE(psBlob);
-	
-	return true;
+
+	return this->CreatePackedShader();
+}
+
+// Create packed shader
+bool GraphicsDirectX11::CreatePackedShader()
+{
+	HRESULT ret{};
+	ID3DBlob* vsBlob;
+
+	ret = D3DCompileFromFile(L"shader.hlsl", nullptr, nullptr, "vsmain_packed", "vs_4_0", 0, 0, &vsBlob, nullptr);
+	if (FAILED(ret))
+		return false;
+
+	ret = m_device->CreateVertexShader(vsBlob->GetBufferPointer(), vsBlob->GetBufferSize(), nullptr, &m_packedVertexShader);
+	if (FAILED(ret))
+	{
+		SAFE_RELEASE(vsBlob);
+		return false;
+	}
+
+	// One layout per position / texcoord encoding, order matches VERTEX_POSITION and VERTEX_TEXCOORD
+	const DXGI_FORMAT positionFormats[]{ DXGI_FORMAT::DXGI_FORMAT_R16G16B16A16_SNORM, DXGI_FORMAT::DXGI_FORMAT_R16G16B16A16_FLOAT };
+	const DXGI_FORMAT texCoordFormats[]{ DXGI_FORMAT::DXGI_FORMAT_R16G16_FLOAT, DXGI_FORMAT::DXGI_FORMAT_R16G16_UNORM };
+	for (size_t p = 0; p < (size_t)structure::VERTEX_POSITION::NUM; ++p)
+	{
+		for (size_t t = 0; t < (size_t)structure::VERTEX_TEXCOORD::NUM; ++t)
+		{
+			D3D11_INPUT_ELEMENT_DESC elementDesc[]
+			{
+				{"POSITION", 0, positionFormats[p],					 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_CLASSIFICATION::D3D11_INPUT_PER_VERTEX_DATA, 0},
+				{"NORMAL",	 0, DXGI_FORMAT::DXGI_FORMAT_R16G16_SNORM, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_CLASSIFICATION::D3D11_INPUT_PER_VERTEX_DATA, 0},
+				{"TEXCOORD", 0, texCoordFormats[t],					 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_CLASSIFICATION::D3D11_INPUT_PER_VERTEX_DATA, 0},
+			};
+
+			ret = m_device->CreateInputLayout(
+				elementDesc,
+				ARRAYSIZE(elementDesc),
+				vsBlob->GetBufferPointer(),
+				vsBlob->GetBufferSize(),
+				&m_packedInputLayouts[p][t]
+			);
+			if (FAILED(ret))
+			{
+				SAFE_RELEASE(vsBlob);
+				return false;
+			}
+		}
+	}
+	SAFE_RELEASE(vsBlob);
+
+	return true;	// Success
 }
 
 // Set viewport
@@ -377,4 +663,68 @@ void GraphicsDirectX11::SetViewport(const int width, const int height)
 	viewport.Height		= FLOAT(height);
 	viewport.MaxDepth	= D3D11_MAX_DEPTH;
 	m_context->RSSetViewports(1, &viewport);
+
+	m_constants.SetViewport(width, height);
+	this->UploadConstants();
+}
+
+// Update memory budget
+void GraphicsDirectX11::UpdateMemoryBudget()
+{
+	if (!m_adapter)
+		return;
+
+	DXGI_QUERY_VIDEO_MEMORY_INFO info{};
+	if (SUCCEEDED(m_adapter->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP::DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &info)))
+		GraphicsMemory::SetBudget(info.Budget, info.CurrentUsage);
+}
+
+#if PROFILER_ENABLE
+// Create timer queries
+bool GraphicsDirectX11::CreateTimerQueries()
+{
+	HRESULT ret{};
+	D3D11_QUERY_DESC disjointDesc{ D3D11_QUERY::D3D11_QUERY_TIMESTAMP_DISJOINT, 0 };
+	D3D11_QUERY_DESC timestampDesc{ D3D11_QUERY::D3D11_QUERY_TIMESTAMP, 0 };
+	for (UINT i = 0; i < k_timerLatency; ++i)
+	{
+		ret = m_device->CreateQuery(&disjointDesc, &m_timerDisjoint[i]);
+		if (FAILED(ret))
+			return false;
+
+		ret = m_device->CreateQuery(&timestampDesc, &m_timerBegin[i]);
+		if (FAILED(ret))
+			return false;
+
+		ret = m_device->CreateQuery(&timestampDesc, &m_timerEnd[i]);
+		if (FAILED(ret))
+			return false;
+	}
+
+	return true;	// Success
+}
+
+// Resolve timer queries
+void GraphicsDirectX11::ResolveTimerQueries()
+{
+	if (m_timerFrame < k_timerLatency)
+		return;
+
+	// Slot about to be reused holds the frame issued k_timerLatency frames ago
+	const UINT slot = UINT(m_timerFrame % k_timerLatency);
+	D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint{};
+	UINT64 begin{}, end{};
+	if (m_context->GetData(m_timerDisjoint[slot], &disjoint, sizeof(disjoint), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+		return;	// not ready yet, drop the sample instead of stalling
+	if (disjoint.Disjoint || disjoint.Frequency == 0)
+		return;
+	if (m_context->GetData(m_timerBegin[slot], &begin, sizeof(begin), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+		return;
+	if (m_context->GetData(m_timerEnd[slot], &end, sizeof(end), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+		return;
+
+	// Gpu clock is not calibrated, the interval is placed at the cpu time of Clear
+	uint64_t duration = uint64_t(double(end - begin) * 1e9 / double(disjoint.Frequency));
+	Profiler::RecordGpu("GPU Frame", m_timerCpuBegin[slot], duration);
 }
+#endif
@@ -6,13 +6,23 @@
 ===================================================================================*/
 #pragma once
 #include <d3d11.h>
+#include <dxgi1_4.h>
 #pragma comment(lib, "d3d11.lib")
 
+#include "Graphics_Constants.h"
 #include "Graphics_Interface.h"
+#include "Graphics_Memory.h"
+#include "Handle_Pool.h"
+#include "Profiler.h"
+#include "Vertex_Format.h"
 
-class GraphicsDirectX11 : public IGraphics
+class GraphicsDirectX11 final : public IGraphics
 {
 public:
+	using BufferHandle	= structure::Handle<ID3D11Buffer>;
+	using BufferPool	= HandlePool<ID3D11Buffer, ID3D11Buffer*, UINT, GraphicsMemory::CATEGORY>;	// buffer, bytes, category
+
+
 	//**************************************************
 	/// \brief Initialize DirectX11 
 	/// 
@@ -55,6 +65,117 @@ public:
 	//**************************************************
 	void* Context() override;
 
+	//**************************************************
+	/// \brief Check window is occluded at last present
+	/// 
+	/// \return if nothing is visible then true
+	//**************************************************
+	bool Occluded() override;
+
+	//**************************************************
+	/// \brief Select input layout and vertex shader for following draws
+	/// 
+	/// \param[in] layout	 ->	packed layout and dequantization (nullptr is Vertex3D)
+	/// 
+	/// \return none
+	//**************************************************
+	void SetVertexLayout(const structure::VertexLayout* layout) override;
+
+	//**************************************************
+	/// \brief Set camera of the frame, uploaded with the next draw constants
+	/// 
+	/// \param[in] view			 ->	row vector view matrix
+	/// \param[in] projection	 ->	row vector projection matrix
+	/// 
+	/// \return none
+	//**************************************************
+	void SetCamera(const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& projection) override;
+
+	//**************************************************
+	/// \brief Set constants of the next draw and upload every dirty block
+	/// 
+	/// \param[in] world	 ->	row vector world matrix
+	/// \param[in] color	 ->	material color
+	/// 
+	/// \return none
+	//**************************************************
+	void SetObjectConstants(const DirectX::XMFLOAT4X4& world, const DirectX::XMFLOAT4& color) override;
+
+	//**************************************************
+	/// \brief Create buffer and register it to GraphicsMemory
+	/// 
+	/// \param[in]  device	 ->	device
+	/// \param[in]  desc		 ->	buffer description
+	/// \param[in]  data		 ->	initial data (nullptr is none)
+	/// \param[out] buffer	 ->	created buffer, release with SAFE_RELEASE_TRACKED
+	/// \param[in]  category	 ->	usage of the memory
+	/// \param[in]  name		 ->	name for the leak report
+	/// 
+	/// \return result of CreateBuffer
+	//**************************************************
+	static HRESULT CreateBuffer(
+		ID3D11Device* device,
+		const D3D11_BUFFER_DESC& desc,
+		const D3D11_SUBRESOURCE_DATA* data,
+		ID3D11Buffer** buffer,
+		const GraphicsMemory::CATEGORY category,
+		const char* name
+	);
+
+	//**************************************************
+	/// \brief Create tracked buffer owned by the buffer pool
+	/// 
+	/// \param[in] desc		 ->	buffer description
+	/// \param[in] data		 ->	initial data (nullptr is none)
+	/// \param[in] category	 ->	usage of the memory
+	/// \param[in] name		 ->	name for the leak report
+	/// 
+	/// \return handle, invalid on failure
+	//**************************************************
+	BufferHandle CreatePooledBuffer(
+		const D3D11_BUFFER_DESC& desc,
+		const D3D11_SUBRESOURCE_DATA* data,
+		const GraphicsMemory::CATEGORY category,
+		const char* name
+	);
+
+	//**************************************************
+	/// \brief Release a pooled buffer, the handle becomes invalid
+	/// 
+	/// \return none
+	//**************************************************
+	void ReleaseBuffer(const BufferHandle handle);
+
+	//**************************************************
+	/// \brief Look up a pooled buffer
+	/// 
+	/// \return buffer, nullptr for stale or invalid handles
+	//**************************************************
+	ID3D11Buffer* Buffer(const BufferHandle handle) const;
+
+	const BufferPool& Buffers() const { return m_buffers; }
+
+	//**************************************************
+	/// \brief Create texture and register it to GraphicsMemory
+	/// 
+	/// \param[in]  device	 ->	device
+	/// \param[in]  desc		 ->	texture description
+	/// \param[in]  data		 ->	initial data of each subresource (nullptr is none)
+	/// \param[out] texture	 ->	created texture, release with SAFE_RELEASE_TRACKED
+	/// \param[in]  category	 ->	usage of the memory
+	/// \param[in]  name		 ->	name for the leak report
+	/// 
+	/// \return result of CreateTexture2D
+	//**************************************************
+	static HRESULT CreateTexture2D(
+		ID3D11Device* device,
+		const D3D11_TEXTURE2D_DESC& desc,
+		const D3D11_SUBRESOURCE_DATA* data,
+		ID3D11Texture2D** texture,
+		const GraphicsMemory::CATEGORY category,
+		const char* name
+	);
+
 private:
 	//**************************************************
 	/// \brief Create device and swapchain
@@ -126,6 +247,13 @@ private:
 	//**************************************************
 	bool CreateConstantBuffers();
 
+	//**************************************************
+	/// \brief Map dirty constant blocks with WRITE_DISCARD
+	///    
+	/// \return none
+	//**************************************************
+	void UploadConstants();
+
 	//**************************************************
 	/// \brief Create shader
 	///    
@@ -133,6 +261,13 @@ private:
 	//**************************************************
 	bool CreateShader();
 
+	//**************************************************
+	/// \brief Create vertex shader and input layouts of VertexPacked
+	///    
+	/// \return Succcess is true
+	//**************************************************
+	bool CreatePackedShader();
+
 	//**************************************************
 	/// \brief Create depth stencil view
 	///
@@ -146,20 +281,61 @@ private:
 		const int height
 	);
 
+	//**************************************************
+	/// \brief Pass adapter video memory budget to GraphicsMemory
+	///   
+	/// \return none
+	//**************************************************
+	void UpdateMemoryBudget();
+
+#if PROFILER_ENABLE
+	//**************************************************
+	/// \brief Create timestamp queries for gpu frame time
+	///    
+	/// \return Succcess is true
+	//**************************************************
+	bool CreateTimerQueries();
+
+	//**************************************************
+	/// \brief Read timestamps of the oldest frame in flight
+	///    
+	/// \return none
+	//**************************************************
+	void ResolveTimerQueries();
+#endif
+
 private:
 	ID3D11Device*				m_device;				// Device Interface
 	ID3D11DeviceContext*		m_context;				// DeviceContext Interface
 	IDXGISwapChain*				m_swapChain;			// SwapChain Interface
 	ID3D11RenderTargetView*		m_renderTargetView; 	// RenderTargetView Interface
+	ID3D11Texture2D*			m_depthStencil;			// Depth buffer of DepthStencilView
 	ID3D11DepthStencilView*		m_depthStencilView; 	// DepthStencilView Interface
 	ID3D11RasterizerState*		m_rasterizerState;  	// RasterizerState Interface
 	ID3D11BlendState*			m_blendState;       	// BlendState Interface
 	ID3D11DepthStencilState*	m_depthStencilState;	// DepthStencilState Interface
 	ID3D11SamplerState*			m_samplerState;     	// SamplerState Interface
-	ID3D11Buffer*				m_modelMatrix;      	// The buffer is model matrix send to vertex buffer 
-	ID3D11Buffer*				m_viewMatrix;       	// The buffer is view matrix send to vertex buffer
-	ID3D11Buffer*				m_projectionMatrix; 	// The buffer is projection matrix send to vertex buffer
+	ID3D11Buffer*				m_constantBuffers[(size_t)structure::CONSTANT_FREQUENCY::NUM]{};	// Dynamic buffers of b0 object, b1 frame, b2 pass
+	GraphicsConstants			m_constants;			// Cpu copy and dirty flags of the constant buffers
 	ID3D11InputLayout*			m_inputLayout;			// Vertex layout Interface
 	ID3D11VertexShader*			m_vertexShader;			// Vertex shader Interface
 	ID3D11PixelShader*			m_pixelShader;			// Pixel shader Interface
+	ID3D11VertexShader*			m_packedVertexShader;	// Vertex shader of VertexPacked
+	ID3D11InputLayout*			m_packedInputLayouts[(size_t)structure::VERTEX_POSITION::NUM][(size_t)structure::VERTEX_TEXCOORD::NUM];	// Position x texcoord encoding
+	ID3D11Buffer*				m_vertexLayoutBuffer;	// Dequantization of VertexPacked (b3)
+	bool						m_occluded = false;		// Last present result was occluded
+	IDXGIAdapter3*				m_adapter = nullptr;	// Adapter for video memory budget (nullptr before Windows 10)
+	UINT64						m_presentCount = 0;		// Presented frames
+	BufferPool					m_buffers;				// Buffers of objects, referenced by handle
+
+	static const UINT			k_budgetInterval = 60;	// frames between budget queries
+
+#if PROFILER_ENABLE
+	static const UINT			k_timerLatency = 3;						// frames before timestamps are read back
+	ID3D11Query*				m_timerDisjoint[k_timerLatency]{};		// Timestamp frequency and validity
+	ID3D11Query*				m_timerBegin[k_timerLatency]{};			// Timestamp at Clear
+	ID3D11Query*				m_timerEnd[k_timerLatency]{};			// Timestamp at Present
+	uint64_t					m_timerCpuBegin[k_timerLatency]{};		// Cpu time at Clear (profiler clock)
+	UINT64						m_timerFrame = 0;						// Frame counter for timer slots
+#endif
 };
\ No newline at end of file
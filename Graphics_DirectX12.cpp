@@ -4,11 +4,14 @@
 *		File	: Graphics_DirectX12.cpp
 *		Detail	:
 ===================================================================================*/
-#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <d3dcompiler.h>
 #pragma comment(lib, "d3dcompiler.lib")
 
 #include "Graphics_DirectX12.h"
+using namespace DirectX;
 
 //**************************************************
 /// \brief These are roots index for send to shader
@@ -17,10 +20,11 @@
 //**************************************************
 enum CONSTANT_BUFFER_INDEX
 {
-	WORLD_MATRIX		= 0,	// World buffer root index
-	VIEW_MATRIX			= 1,	// View buffer root index
-	PROJECTION_MATRIX	= 2,	// Projection buffer root index
-	TEXTURE_INDEX		= 3		// Texture buffer root index
+	OBJECT_CONSTANTS	= 0,	// Per draw buffer root index (same value as CONSTANT_FREQUENCY)
+	FRAME_CONSTANTS		= 1,	// Per frame buffer root index
+	PASS_CONSTANTS		= 2,	// Per pass buffer root index
+	TEXTURE_INDEX		= 3,	// Texture buffer root index
+	VERTEX_LAYOUT		= 4		// Packed vertex dequantization root index (root constants)
 };
 
 /* Initialize */
@@ -38,11 +42,20 @@ bool GraphicsDirectX12::Init(int width, int height, void* handle)
 	if (!this->CreateFence())
 		return false;
 
+	if (!this->CreateConstantUpload())
+		return false;
+
 	if (!this->CreateGraphicsPipeline())
 		return false;
 
 	this->SetViewport(width, height);
 	this->SetScissorRect(width, height);
+	this->UpdateMemoryBudget();
+
+#if PROFILER_ENABLE
+	if (!this->CreateTimerQueries())
+		return false;
+#endif
 
 	return true;
 }
@@ -50,26 +63,65 @@ bool GraphicsDirectX12::Init(int width, int height, void* handle)
 /* Uninitialize */
 void GraphicsDirectX12::Uninit()
 {
+	// Nothing may be in flight when the queue and the device go away
+	this->WaitForGpu();
+	this->ProcessDeferredReleases(UINT64_MAX);
+
+	// Resources the objects forgot, gone before the leak report
+	for (size_t i = 0; i < m_resources.Size(); ++i)
+	{
+		SAFE_RELEASE_TRACKED(m_resources.Data<0>()[i]);
+	}
+	m_resources.Clear();
+
+#if PROFILER_ENABLE
+	SAFE_RELEASE_TRACKED(m_timerReadback);
+	SAFE_RELEASE(m_timerHeap);
+#endif
+	for (auto& pipelineStates : m_packedPipelineStates)
+	{
+		for (ID3D12PipelineState*& pipelineState : pipelineStates)
+		{
+			SAFE_RELEASE(pipelineState);
+		}
+	}
 	SAFE_RELEASE(m_pipelineState);
 	SAFE_RELEASE(m_rootSignature);
+	for (ConstantPage& page : m_constantPages)
+	{
+		if (page.Resource && page.Map)
+			page.Resource->Unmap(0, nullptr);
+		page.Map = nullptr;
+		SAFE_RELEASE_TRACKED(page.Resource);
+	}
+	m_constantPages.clear();
 	SAFE_RELEASE(m_fence);
 	SAFE_RELEASE(m_depthBufferHeap);
-	SAFE_RELEASE(m_depthBuffer);
+	SAFE_RELEASE_TRACKED(m_depthBuffer);
 	for (size_t i = 0; i < k_backBufferNum; ++i)
 	{
-		SAFE_RELEASE(m_backBuffers[i]);
+		SAFE_RELEASE_TRACKED(m_backBuffers[i]);
 	}
 	SAFE_RELEASE(m_renderTargetViewHeap);
 	SAFE_RELEASE(m_swapChain);
+	SAFE_RELEASE(m_adapter);
 	SAFE_RELEASE(m_commandQueue);
 	SAFE_RELEASE(m_commandList);
 	SAFE_RELEASE(m_commandAllocator);
 	SAFE_RELEASE(m_device);
+
+	// Everything created by this backend and the objects is released at this point
+	GraphicsMemory::ReportLeaks();
 }
 
 /* Clear screen */
 void GraphicsDirectX12::Clear()
 {
+	PROFILE_SCOPE("GraphicsDirectX12::Clear");
+
+	// Batch of releases the gpu no longer references
+	this->ProcessDeferredReleases(m_fence->GetCompletedValue());
+
 	// Get currently buffer index
 	UINT index = m_swapChain->GetCurrentBackBufferIndex();
 	this->SetResourceBarrier(
@@ -78,6 +130,14 @@ void GraphicsDirectX12::Clear()
 		D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RENDER_TARGET
 	);
 
+#if PROFILER_ENABLE
+	this->ResolveTimerQueries();
+
+	const UINT slot = UINT(m_timerFrame % k_timerLatency);
+	m_commandList->EndQuery(m_timerHeap, D3D12_QUERY_TYPE::D3D12_QUERY_TYPE_TIMESTAMP, slot * 2);
+	m_timerCpuBegin[slot] = Profiler::Now();
+#endif
+
 	// Set pipeline
 	m_commandList->SetPipelineState(m_pipelineState);
 
@@ -102,14 +162,37 @@ void GraphicsDirectX12::Clear()
 	m_commandList->RSSetViewports(1, &m_viewport);
 	m_commandList->RSSetScissorRects(1, &m_scissorRect);
 	m_commandList->SetGraphicsRootSignature(m_rootSignature);
+
+	// Present waits for the gpu, so every page is free again
+	// Root arguments are reset with the signature, every block is bound again
+	m_constantPage = 0;
+	m_constantOffset = 0;
+	m_constants.Invalidate();
+	this->UploadConstants();
 }
 
 /* Present buffer */
 void GraphicsDirectX12::Present()
 {
+	PROFILE_SCOPE("GraphicsDirectX12::Present");
+
 	// Get currently buffer index
 	UINT index = m_swapChain->GetCurrentBackBufferIndex();
 
+#if PROFILER_ENABLE
+	const UINT slot = UINT(m_timerFrame % k_timerLatency);
+	m_commandList->EndQuery(m_timerHeap, D3D12_QUERY_TYPE::D3D12_QUERY_TYPE_TIMESTAMP, slot * 2 + 1);
+	m_commandList->ResolveQueryData(
+		m_timerHeap,
+		D3D12_QUERY_TYPE::D3D12_QUERY_TYPE_TIMESTAMP,
+		slot * 2,
+		2,
+		m_timerReadback,
+		UINT64(slot) * 2 * sizeof(UINT64)
+	);
+	++m_timerFrame;
+#endif
+
 	this->SetResourceBarrier(
 		index,
 		D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RENDER_TARGET,
@@ -119,30 +202,23 @@ void GraphicsDirectX12::Present()
 	// Close command list
 	m_commandList->Close();
 
-	// Execute command list
-	std::vector<ID3D12CommandList*> commandLists{ m_commandList };
-	m_commandQueue->ExecuteCommandLists(commandLists.size(), &commandLists[0]);
+	// Execute command list (fixed array, no heap allocation per frame)
+	ID3D12CommandList* commandLists[]{ m_commandList };
+	m_commandQueue->ExecuteCommandLists(_countof(commandLists), commandLists);
 
 	// Wait
-	m_commandQueue->Signal(m_fence, ++m_fenceValue);
-
-	if (m_fence->GetCompletedValue() != m_fenceValue)
-	{
-		HANDLE fenceEvent = CreateEvent(nullptr, false, false, nullptr);
-		if (fenceEvent)
-		{
-			m_fence->SetEventOnCompletion(m_fenceValue, fenceEvent);
-			WaitForSingleObject(fenceEvent, INFINITE);
-			CloseHandle(fenceEvent);
-		}
-	}
+	this->WaitForGpu();
 
 	// Reset
 	m_commandAllocator->Reset();
 	m_commandList->Reset(m_commandAllocator, nullptr);
 
 	// Flip
-	m_swapChain->Present(1, 0);
+	HRESULT ret = m_swapChain->Present(1, 0);
+	m_occluded = (ret == DXGI_STATUS_OCCLUDED);
+
+	if (m_fenceValue % k_budgetInterval == 0)
+		this->UpdateMemoryBudget();
 }
 
 /* Get device pointer */
@@ -157,6 +233,105 @@ void* GraphicsDirectX12::Context()
 	return m_commandList;
 }
 
+/* Occluded */
+bool GraphicsDirectX12::Occluded()
+{
+	return m_occluded;
+}
+
+/* Set vertex layout */
+void GraphicsDirectX12::SetVertexLayout(const structure::VertexLayout* layout)
+{
+	if (!layout)
+	{
+		m_commandList->SetPipelineState(m_pipelineState);
+		return;
+	}
+
+	// First three float4 of VertexLayout are the root constants
+	m_commandList->SetPipelineState(m_packedPipelineStates[(size_t)layout->Position][(size_t)layout->TexCoord]);
+	m_commandList->SetGraphicsRoot32BitConstants(CONSTANT_BUFFER_INDEX::VERTEX_LAYOUT, 12, layout, 0);
+}
+
+/* Set camera */
+void GraphicsDirectX12::SetCamera(const XMFLOAT4X4& view, const XMFLOAT4X4& projection)
+{
+	m_constants.SetCamera(view, projection);
+}
+
+/* Set object constants */
+void GraphicsDirectX12::SetObjectConstants(const XMFLOAT4X4& world, const XMFLOAT4& color)
+{
+	m_constants.SetObject(world, color);
+	this->UploadConstants();
+}
+
+/* Defer release */
+void GraphicsDirectX12::DeferRelease(IUnknown* resource)
+{
+	if (!resource)
+		return;
+
+	// Commands recorded so far are submitted with the next signal
+	m_deferredReleases.push_back(DeferredRelease{ resource, UINT64(m_fenceValue) + 1 });
+}
+
+/* Create pooled resource */
+GraphicsDirectX12::ResourceHandle GraphicsDirectX12::CreatePooledResource(const D3D12_HEAP_PROPERTIES& heapProperties, const D3D12_RESOURCE_DESC& desc, const D3D12_RESOURCE_STATES state, const D3D12_CLEAR_VALUE* clearValue, const GraphicsMemory::CATEGORY category, const char* name)
+{
+	ID3D12Resource* resource = nullptr;
+	if (FAILED(GraphicsDirectX12::CreateCommittedResource(m_device, heapProperties, desc, state, clearValue, &resource, category, name)))
+		return ResourceHandle{};
+
+	const D3D12_RESOURCE_ALLOCATION_INFO info = m_device->GetResourceAllocationInfo(0, 1, &desc);
+	ResourceHandle handle = m_resources.Create(resource, info.SizeInBytes, category);
+	if (!handle.IsValid())
+	{
+		SAFE_RELEASE_TRACKED(resource);
+	}
+	return handle;
+}
+
+/* Release pooled resource */
+void GraphicsDirectX12::ReleaseResource(const ResourceHandle handle)
+{
+	ID3D12Resource** resource = m_resources.Get<0>(handle);
+	if (!resource)
+		return;
+
+	// The gpu may still read it, only the handle dies immediately
+	this->DeferRelease(*resource);
+	m_resources.Destroy(handle);
+}
+
+/* Pooled resource */
+ID3D12Resource* GraphicsDirectX12::Resource(const ResourceHandle handle) const
+{
+	ID3D12Resource* const* resource = m_resources.Get<0>(handle);
+	return resource ? *resource : nullptr;
+}
+
+/* Create tracked committed resource */
+HRESULT GraphicsDirectX12::CreateCommittedResource(ID3D12Device* device, const D3D12_HEAP_PROPERTIES& heapProperties, const D3D12_RESOURCE_DESC& desc, const D3D12_RESOURCE_STATES state, const D3D12_CLEAR_VALUE* clearValue, ID3D12Resource** resource, const GraphicsMemory::CATEGORY category, const char* name)
+{
+	HRESULT ret = device->CreateCommittedResource(
+		&heapProperties,
+		D3D12_HEAP_FLAGS::D3D12_HEAP_FLAG_NONE,
+		&desc,
+		state,
+		clearValue,
+		__uuidof(ID3D12Resource),
+		(void**)resource
+	);
+	if (FAILED(ret))
+		return ret;
+
+	// Committed resource occupies its allocation size including alignment
+	D3D12_RESOURCE_ALLOCATION_INFO info = device->GetResourceAllocationInfo(0, 1, &desc);
+	GraphicsMemory::Track(*resource, category, info.SizeInBytes, name);
+	return ret;
+}
+
 // Create device and swapchain
 bool GraphicsDirectX12::CreateDeviceAndSwapChain(const int width, const int height, const HWND hWnd)
 {
@@ -246,6 +421,9 @@ bool GraphicsDirectX12::CreateDeviceAndSwapChain(const int width, const int heig
 		return false;
 	}
 
+	// Adapter of the device for the budget, failure only disables budget reporting
+	factory->EnumAdapterByLuid(m_device->GetAdapterLuid(), __uuidof(IDXGIAdapter3), (void**)&m_adapter);
+
 	SAFE_RELEASE(factory);
 	return true;	// Success
 }
@@ -277,6 +455,14 @@ bool GraphicsDirectX12::CreateRenderTargetView()
 		if (FAILED(ret))
 			return false;
 
+		D3D12_RESOURCE_DESC backBufferDesc = m_backBuffers[i]->GetDesc();
+		GraphicsMemory::Track(
+			m_backBuffers[i],
+			GraphicsMemory::CATEGORY::RENDER_TARGETS,
+			m_device->GetResourceAllocationInfo(0, 1, &backBufferDesc).SizeInBytes,
+			"BackBuffer"
+		);
+
 		m_device->CreateRenderTargetView(m_backBuffers[i], nullptr, handle);
 		handle.ptr += m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE::D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
 	}
@@ -310,14 +496,15 @@ bool GraphicsDirectX12::CreateDepthBuffer(const int width, const int height)
 	clearValue.DepthStencil.Depth	= D3D12_MAX_DEPTH;
 	clearValue.Format				= DXGI_FORMAT::DXGI_FORMAT_D32_FLOAT;
 
-	ret = m_device->CreateCommittedResource(
-		&heapProperties,
-		D3D12_HEAP_FLAGS::D3D12_HEAP_FLAG_NONE,
-		&resourceDesc,
+	ret = GraphicsDirectX12::CreateCommittedResource(
+		m_device,
+		heapProperties,
+		resourceDesc,
 		D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_DEPTH_WRITE,
 		&clearValue,
-		__uuidof(ID3D12Resource),
-		(void**)&m_depthBuffer
+		&m_depthBuffer,
+		GraphicsMemory::CATEGORY::RENDER_TARGETS,
+		"DepthBuffer"
 	);
 	if (FAILED(ret))
 		return false;
@@ -360,6 +547,88 @@ bool GraphicsDirectX12::CreateFence()
 	return true;
 }
 
+// Create constant upload
+bool GraphicsDirectX12::CreateConstantUpload()
+{
+	HRESULT ret{};
+	D3D12_HEAP_PROPERTIES heapProperties{};
+	heapProperties.Type					= D3D12_HEAP_TYPE::D3D12_HEAP_TYPE_UPLOAD;
+	heapProperties.CPUPageProperty		= D3D12_CPU_PAGE_PROPERTY::D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+	heapProperties.MemoryPoolPreference = D3D12_MEMORY_POOL::D3D12_MEMORY_POOL_UNKNOWN;
+
+	D3D12_RESOURCE_DESC resourceDesc{};
+	resourceDesc.Dimension			= D3D12_RESOURCE_DIMENSION::D3D12_RESOURCE_DIMENSION_BUFFER;
+	resourceDesc.Width				= k_constantUploadSize;
+	resourceDesc.Height				= 1;
+	resourceDesc.DepthOrArraySize	= 1;
+	resourceDesc.MipLevels			= 1;
+	resourceDesc.Format				= DXGI_FORMAT::DXGI_FORMAT_UNKNOWN;
+	resourceDesc.SampleDesc.Count	= 1;
+	resourceDesc.Flags				= D3D12_RESOURCE_FLAGS::D3D12_RESOURCE_FLAG_NONE;
+	resourceDesc.Layout				= D3D12_TEXTURE_LAYOUT::D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+
+	ConstantPage page{};
+	ret = GraphicsDirectX12::CreateCommittedResource(
+		m_device,
+		heapProperties,
+		resourceDesc,
+		D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_GENERIC_READ,
+		nullptr,
+		&page.Resource,
+		GraphicsMemory::CATEGORY::CONSTANTS,
+		"ConstantUpload"
+	);
+	if (FAILED(ret))
+		return false;
+
+	// Upload heaps stay mapped for the lifetime of the resource
+	D3D12_RANGE readRange{ 0, 0 };
+	ret = page.Resource->Map(0, &readRange, (void**)&page.Map);
+	if (FAILED(ret))
+	{
+		SAFE_RELEASE_TRACKED(page.Resource);
+		return false;
+	}
+
+	m_constantPages.push_back(page);
+	return true;	// Success
+}
+
+// Upload constants
+void GraphicsDirectX12::UploadConstants()
+{
+	if (!m_constants.DirtyMask())
+		return;
+
+	for (UINT i = 0; i < UINT(structure::CONSTANT_FREQUENCY::NUM); ++i)
+	{
+		const structure::CONSTANT_FREQUENCY frequency = (structure::CONSTANT_FREQUENCY)i;
+		if (!(m_constants.DirtyMask() & (1u << i)))
+			continue;
+
+		const UINT64 size = (GraphicsConstants::Size(frequency) + D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1) & ~UINT64(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1);
+		if (m_constantOffset + size > k_constantUploadSize)
+		{// Page is full, continue in the next one, the first frame that needs it creates it
+			if (m_constantPage + 1 == m_constantPages.size() && !this->CreateConstantUpload())
+			{
+				OutputDebugStringA("GraphicsDirectX12::UploadConstants: no constant upload page, the draw uses stale constants\n");
+				assert(!"constant upload page could not be created");
+				return;
+			}
+			++m_constantPage;
+			m_constantOffset = 0;
+		}
+
+		m_constants.Consume(frequency);
+
+		// Blocks of earlier draws are still read by the gpu, each upload takes new memory
+		const ConstantPage& page = m_constantPages[m_constantPage];
+		std::memcpy(page.Map + m_constantOffset, m_constants.Data(frequency), GraphicsConstants::Size(frequency));
+		m_commandList->SetGraphicsRootConstantBufferView(i, page.Resource->GetGPUVirtualAddress() + m_constantOffset);	// root index is the CONSTANT_FREQUENCY value
+		m_constantOffset += size;
+	}
+}
+
 // Create graphics pipeline
 bool GraphicsDirectX12::CreateGraphicsPipeline()
 {
@@ -449,27 +718,33 @@ bool GraphicsDirectX12::CreateGraphicsPipeline()
 	descriptorRange.BaseShaderRegister					= 0;
 	descriptorRange.OffsetInDescriptorsFromTableStart	= D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
 
-	D3D12_ROOT_PARAMETER rootParameter[4]{};
-	rootParameter[CONSTANT_BUFFER_INDEX::WORLD_MATRIX].ParameterType					= D3D12_ROOT_PARAMETER_TYPE::D3D12_ROOT_PARAMETER_TYPE_CBV;
-	rootParameter[CONSTANT_BUFFER_INDEX::WORLD_MATRIX].ShaderVisibility					= D3D12_SHADER_VISIBILITY::D3D12_SHADER_VISIBILITY_VERTEX;
-	rootParameter[CONSTANT_BUFFER_INDEX::WORLD_MATRIX].Descriptor.ShaderRegister		= 0;
-	rootParameter[CONSTANT_BUFFER_INDEX::WORLD_MATRIX].Descriptor.RegisterSpace			= 0;
+	D3D12_ROOT_PARAMETER rootParameter[5]{};
+	rootParameter[CONSTANT_BUFFER_INDEX::OBJECT_CONSTANTS].ParameterType					= D3D12_ROOT_PARAMETER_TYPE::D3D12_ROOT_PARAMETER_TYPE_CBV;
+	rootParameter[CONSTANT_BUFFER_INDEX::OBJECT_CONSTANTS].ShaderVisibility					= D3D12_SHADER_VISIBILITY::D3D12_SHADER_VISIBILITY_VERTEX;
+	rootParameter[CONSTANT_BUFFER_INDEX::OBJECT_CONSTANTS].Descriptor.ShaderRegister		= 0;
+	rootParameter[CONSTANT_BUFFER_INDEX::OBJECT_CONSTANTS].Descriptor.RegisterSpace			= 0;
 
-	rootParameter[CONSTANT_BUFFER_INDEX::VIEW_MATRIX].ParameterType						= D3D12_ROOT_PARAMETER_TYPE::D3D12_ROOT_PARAMETER_TYPE_CBV;
-	rootParameter[CONSTANT_BUFFER_INDEX::VIEW_MATRIX].ShaderVisibility					= D3D12_SHADER_VISIBILITY::D3D12_SHADER_VISIBILITY_VERTEX;
-	rootParameter[CONSTANT_BUFFER_INDEX::VIEW_MATRIX].Descriptor.ShaderRegister			= 1;
-	rootParameter[CONSTANT_BUFFER_INDEX::VIEW_MATRIX].Descriptor.RegisterSpace			= 0;
+	rootParameter[CONSTANT_BUFFER_INDEX::FRAME_CONSTANTS].ParameterType						= D3D12_ROOT_PARAMETER_TYPE::D3D12_ROOT_PARAMETER_TYPE_CBV;
+	rootParameter[CONSTANT_BUFFER_INDEX::FRAME_CONSTANTS].ShaderVisibility					= D3D12_SHADER_VISIBILITY::D3D12_SHADER_VISIBILITY_VERTEX;
+	rootParameter[CONSTANT_BUFFER_INDEX::FRAME_CONSTANTS].Descriptor.ShaderRegister			= 1;
+	rootParameter[CONSTANT_BUFFER_INDEX::FRAME_CONSTANTS].Descriptor.RegisterSpace			= 0;
 
-	rootParameter[CONSTANT_BUFFER_INDEX::PROJECTION_MATRIX].ParameterType				= D3D12_ROOT_PARAMETER_TYPE::D3D12_ROOT_PARAMETER_TYPE_CBV;
-	rootParameter[CONSTANT_BUFFER_INDEX::PROJECTION_MATRIX].ShaderVisibility			= D3D12_SHADER_VISIBILITY::D3D12_SHADER_VISIBILITY_VERTEX;
-	rootParameter[CONSTANT_BUFFER_INDEX::PROJECTION_MATRIX].Descriptor.ShaderRegister	= 2;
-	rootParameter[CONSTANT_BUFFER_INDEX::PROJECTION_MATRIX].Descriptor.RegisterSpace	= 0;
+	rootParameter[CONSTANT_BUFFER_INDEX::PASS_CONSTANTS].ParameterType				= D3D12_ROOT_PARAMETER_TYPE::D3D12_ROOT_PARAMETER_TYPE_CBV;
+	rootParameter[CONSTANT_BUFFER_INDEX::PASS_CONSTANTS].ShaderVisibility			= D3D12_SHADER_VISIBILITY::D3D12_SHADER_VISIBILITY_VERTEX;
+	rootParameter[CONSTANT_BUFFER_INDEX::PASS_CONSTANTS].Descriptor.ShaderRegister	= 2;
+	rootParameter[CONSTANT_BUFFER_INDEX::PASS_CONSTANTS].Descriptor.RegisterSpace	= 0;
 
 	rootParameter[CONSTANT_BUFFER_INDEX::TEXTURE_INDEX].ParameterType						= D3D12_ROOT_PARAMETER_TYPE::D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
 	rootParameter[CONSTANT_BUFFER_INDEX::TEXTURE_INDEX].DescriptorTable.pDescriptorRanges	= &descriptorRange;
 	rootParameter[CONSTANT_BUFFER_INDEX::TEXTURE_INDEX].DescriptorTable.NumDescriptorRanges = 1;
 	rootParameter[CONSTANT_BUFFER_INDEX::TEXTURE_INDEX].ShaderVisibility					= D3D12_SHADER_VISIBILITY::D3D12_SHADER_VISIBILITY_PIXEL;
 
+	rootParameter[CONSTANT_BUFFER_INDEX::VERTEX_LAYOUT].ParameterType				= D3D12_ROOT_PARAMETER_TYPE::D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+	rootParameter[CONSTANT_BUFFER_INDEX::VERTEX_LAYOUT].ShaderVisibility			= D3D12_SHADER_VISIBILITY::D3D12_SHADER_VISIBILITY_VERTEX;
+	rootParameter[CONSTANT_BUFFER_INDEX::VERTEX_LAYOUT].Constants.ShaderRegister	= 3;
+	rootParameter[CONSTANT_BUFFER_INDEX::VERTEX_LAYOUT].Constants.RegisterSpace		= 0;
+	rootParameter[CONSTANT_BUFFER_INDEX::VERTEX_LAYOUT].Constants.Num32BitValues	= 12;
+
 	rootSignatureDesc.pParameters = rootParameter;
 	rootSignatureDesc.NumParameters = _countof(rootParameter);
 
@@ -527,13 +802,94 @@ bool GraphicsDirectX12::CreateGraphicsPipeline()
 		return false;
 	}
 
+	// Packed pipelines share the pixel shader, create them before the blob is released
+	bool packed = this->CreatePackedPipelines(graphicsPipeline);
+
 	SAFE_RELEASE(rootSignatureBlob);
 	SAFE_RELEASE(psBlob);
 	SAFE_RELEASE(vsBlob);
 
+	return packed;
+}
+
+// Create packed pipelines
+bool GraphicsDirectX12::CreatePackedPipelines(D3D12_GRAPHICS_PIPELINE_STATE_DESC graphicsPipeline)
+{
+	HRESULT ret{};
+	ID3DBlob* vsBlob;
+
+	ret = D3DCompileFromFile(L"shader.hlsl", nullptr, nullptr, "vsmain_packed", "vs_4_0", 0, 0, &vsBlob, nullptr);
+	if (FAILED(ret))
+		return false;
+
+	graphicsPipeline.VS.pShaderBytecode	= vsBlob->GetBufferPointer();
+	graphicsPipeline.VS.BytecodeLength	= vsBlob->GetBufferSize();
+
+	// One pipeline per position / texcoord encoding, order matches VERTEX_POSITION and VERTEX_TEXCOORD
+	const DXGI_FORMAT positionFormats[]{ DXGI_FORMAT::DXGI_FORMAT_R16G16B16A16_SNORM, DXGI_FORMAT::DXGI_FORMAT_R16G16B16A16_FLOAT };
+	const DXGI_FORMAT texCoordFormats[]{ DXGI_FORMAT::DXGI_FORMAT_R16G16_FLOAT, DXGI_FORMAT::DXGI_FORMAT_R16G16_UNORM };
+	for (size_t p = 0; p < (size_t)structure::VERTEX_POSITION::NUM; ++p)
+	{
+		for (size_t t = 0; t < (size_t)structure::VERTEX_TEXCOORD::NUM; ++t)
+		{
+			D3D12_INPUT_ELEMENT_DESC inputLayout[]
+			{
+				{"POSITION", 0, positionFormats[p],					 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION::D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+				{"NORMAL",	 0, DXGI_FORMAT::DXGI_FORMAT_R16G16_SNORM, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION::D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+				{"TEXCOORD", 0, texCoordFormats[t],					 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION::D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+			};
+			graphicsPipeline.InputLayout.pInputElementDescs	= inputLayout;
+			graphicsPipeline.InputLayout.NumElements		= _countof(inputLayout);
+
+			ret = m_device->CreateGraphicsPipelineState(
+				&graphicsPipeline,
+				__uuidof(ID3D12PipelineState),
+				(void**)&m_packedPipelineStates[p][t]
+			);
+			if (FAILED(ret))
+			{
+				SAFE_RELEASE(vsBlob);
+				return false;
+			}
+		}
+	}
+	SAFE_RELEASE(vsBlob);
+
 	return true;	// Success
 }
 
+// Wait for gpu
+void GraphicsDirectX12::WaitForGpu()
+{
+	if (!m_commandQueue || !m_fence)
+		return;
+
+	m_commandQueue->Signal(m_fence, ++m_fenceValue);
+
+	if (m_fence->GetCompletedValue() < m_fenceValue)
+	{
+		HANDLE fenceEvent = CreateEvent(nullptr, false, false, nullptr);
+		if (fenceEvent)
+		{
+			m_fence->SetEventOnCompletion(m_fenceValue, fenceEvent);
+			WaitForSingleObject(fenceEvent, INFINITE);
+			CloseHandle(fenceEvent);
+		}
+	}
+}
+
+// Process deferred releases
+void GraphicsDirectX12::ProcessDeferredReleases(const UINT64 completedValue)
+{
+	// Fence values only grow, so finished entries are all at the front
+	while (!m_deferredReleases.empty() && m_deferredReleases.front().FenceValue <= completedValue)
+	{
+		IUnknown* resource = m_deferredReleases.front().Resource;
+		m_deferredReleases.pop_front();
+		SAFE_RELEASE_TRACKED(resource);
+	}
+}
+
 // Resource barrier setting
 void GraphicsDirectX12::SetResourceBarrier(const UINT index, D3D12_RESOURCE_STATES before, D3D12_RESOURCE_STATES after)
 {
@@ -553,6 +909,8 @@ void GraphicsDirectX12::SetViewport(const int width, const int height)
 	m_viewport.Width	= FLOAT(width);
 	m_viewport.Height	= FLOAT(height);
 	m_viewport.MaxDepth = D3D12_MAX_DEPTH;
+
+	m_constants.SetViewport(width, height);
 }
 
 // Set scissor rect
@@ -562,4 +920,90 @@ void GraphicsDirectX12::SetScissorRect(const int width, const int height)
 	m_scissorRect.top		= 0;
 	m_scissorRect.right		= m_scissorRect.left + width;
 	m_scissorRect.bottom	= m_scissorRect.top + height;
-}
\ No newline at end of file
+}
+
+// Update memory budget
+void GraphicsDirectX12::UpdateMemoryBudget()
+{
+	if (!m_adapter)
+		return;
+
+	DXGI_QUERY_VIDEO_MEMORY_INFO info{};
+	if (SUCCEEDED(m_adapter->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP::DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &info)))
+		GraphicsMemory::SetBudget(info.Budget, info.CurrentUsage);
+}
+
+#if PROFILER_ENABLE
+// Create timer queries
+bool GraphicsDirectX12::CreateTimerQueries()
+{
+	HRESULT ret{};
+	D3D12_QUERY_HEAP_DESC heapDesc{};
+	heapDesc.Type	= D3D12_QUERY_HEAP_TYPE::D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+	heapDesc.Count	= k_timerLatency * 2;
+	ret = m_device->CreateQueryHeap(&heapDesc, __uuidof(ID3D12QueryHeap), (void**)&m_timerHeap);
+	if (FAILED(ret))
+		return false;
+
+	D3D12_HEAP_PROPERTIES heapProperties{};
+	heapProperties.Type					= D3D12_HEAP_TYPE::D3D12_HEAP_TYPE_READBACK;
+	heapProperties.CPUPageProperty		= D3D12_CPU_PAGE_PROPERTY::D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+	heapProperties.MemoryPoolPreference = D3D12_MEMORY_POOL::D3D12_MEMORY_POOL_UNKNOWN;
+
+	D3D12_RESOURCE_DESC resourceDesc{};
+	resourceDesc.Dimension			= D3D12_RESOURCE_DIMENSION::D3D12_RESOURCE_DIMENSION_BUFFER;
+	resourceDesc.Width				= k_timerLatency * 2 * sizeof(UINT64);
+	resourceDesc.Height				= 1;
+	resourceDesc.DepthOrArraySize	= 1;
+	resourceDesc.MipLevels			= 1;
+	resourceDesc.Format				= DXGI_FORMAT::DXGI_FORMAT_UNKNOWN;
+	resourceDesc.SampleDesc.Count	= 1;
+	resourceDesc.Flags				= D3D12_RESOURCE_FLAGS::D3D12_RESOURCE_FLAG_NONE;
+	resourceDesc.Layout				= D3D12_TEXTURE_LAYOUT::D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+
+	ret = GraphicsDirectX12::CreateCommittedResource(
+		m_device,
+		heapProperties,
+		resourceDesc,
+		D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COPY_DEST,
+		nullptr,
+		&m_timerReadback,
+		GraphicsMemory::CATEGORY::OTHER,
+		"TimerReadback"
+	);
+	if (FAILED(ret))
+		return false;
+
+	ret = m_commandQueue->GetTimestampFrequency(&m_timerFrequency);
+	if (FAILED(ret))
+		return false;
+
+	return true;	// Success
+}
+
+// Resolve timer queries
+void GraphicsDirectX12::ResolveTimerQueries()
+{
+	if (m_timerFrame < k_timerLatency || m_timerFrequency == 0)
+		return;
+
+	// Slot about to be reused was resolved k_timerLatency frames ago and its fence has passed
+	const UINT slot = UINT(m_timerFrame % k_timerLatency);
+	D3D12_RANGE readRange{ SIZE_T(slot) * 2 * sizeof(UINT64), SIZE_T(slot + 1) * 2 * sizeof(UINT64) };
+	UINT64* timestamps{};
+	if (FAILED(m_timerReadback->Map(0, &readRange, (void**)&timestamps)))
+		return;
+
+	UINT64 begin	= timestamps[slot * 2];
+	UINT64 end		= timestamps[slot * 2 + 1];
+	D3D12_RANGE writeRange{ 0, 0 };
+	m_timerReadback->Unmap(0, &writeRange);
+
+	// Gpu clock is not calibrated, the interval is placed at the cpu time of Clear
+	if (end > begin)
+	{
+		uint64_t duration = uint64_t(double(end - begin) * 1e9 / double(m_timerFrequency));
+		Profiler::RecordGpu("GPU Frame", m_timerCpuBegin[slot], duration);
+	}
+}
+#endif
@@ -5,17 +5,36 @@
 *		Detail	:
 ===================================================================================*/
 #pragma once
+#include <deque>
+#include <vector>
 #include <d3d12.h>
 #include <dxgi1_6.h>
 
 #pragma comment(lib, "d3d12.lib")
 #pragma comment(lib, "dxgi.lib")
 
+#include "Graphics_Constants.h"
 #include "Graphics_Interface.h"
+#include "Graphics_Memory.h"
+#include "Handle_Pool.h"
+#include "Profiler.h"
+#include "Vertex_Format.h"
 
-class GraphicsDirectX12 : public IGraphics
+//**************************************************
+/// \brief Release a resource once the gpu finished the commands recorded so far
+///
+/// \return none
+//**************************************************
+#define SAFE_RELEASE_DEFERRED(graphics, p)\
+	if(p)	(graphics)->DeferRelease(p);\
+	p = nullptr;\
+
+class GraphicsDirectX12 final : public IGraphics
 {
 	public:
+	using ResourceHandle	= structure::Handle<ID3D12Resource>;
+	using ResourcePool		= HandlePool<ID3D12Resource, ID3D12Resource*, UINT64, GraphicsMemory::CATEGORY>;	// resource, bytes, category
+
 	//**************************************************
 	/// \brief Initialize DirectX12 
 	/// 
@@ -58,6 +77,118 @@ class GraphicsDirectX12 : public IGraphics
 	//**************************************************
 	void* Context() override;
 
+	//**************************************************
+	/// \brief Check window is occluded at last present
+	/// 
+	/// \return if nothing is visible then true
+	//**************************************************
+	bool Occluded() override;
+
+	//**************************************************
+	/// \brief Select pipeline state for following draws
+	/// 
+	/// \param[in] layout	 ->	packed layout and dequantization (nullptr is Vertex3D)
+	/// 
+	/// \return none
+	//**************************************************
+	void SetVertexLayout(const structure::VertexLayout* layout) override;
+
+	//**************************************************
+	/// \brief Set camera of the frame, uploaded with the next draw constants
+	/// 
+	/// \param[in] view			 ->	row vector view matrix
+	/// \param[in] projection	 ->	row vector projection matrix
+	/// 
+	/// \return none
+	//**************************************************
+	void SetCamera(const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& projection) override;
+
+	//**************************************************
+	/// \brief Set constants of the next draw, dirty blocks are copied to the upload ring
+	///        and bound as root constant buffer views
+	/// 
+	/// \param[in] world	 ->	row vector world matrix
+	/// \param[in] color	 ->	material color
+	/// 
+	/// \return none
+	//**************************************************
+	void SetObjectConstants(const DirectX::XMFLOAT4X4& world, const DirectX::XMFLOAT4& color) override;
+
+	//**************************************************
+	/// \brief Queue a release behind the fence value of the current frame
+	///        The resource is untracked and released at the start of the first frame
+	///        after the gpu passed that value, so unloads never wait for the gpu
+	/// 
+	/// \param[in] resource	 ->	resource or any other device object (nullptr is ignored)
+	/// 
+	/// \return none
+	//**************************************************
+	void DeferRelease(IUnknown* resource);
+
+	size_t DeferredReleaseNum() const { return m_deferredReleases.size(); }
+
+	//**************************************************
+	/// \brief Create tracked committed resource owned by the resource pool
+	/// 
+	/// \param[in] heapProperties	 ->	heap of the resource
+	/// \param[in] desc			 ->	resource description
+	/// \param[in] state			 ->	initial state
+	/// \param[in] clearValue		 ->	optimized clear value (nullptr is none)
+	/// \param[in] category		 ->	usage of the memory
+	/// \param[in] name			 ->	name for the leak report
+	/// 
+	/// \return handle, invalid on failure
+	//**************************************************
+	ResourceHandle CreatePooledResource(
+		const D3D12_HEAP_PROPERTIES& heapProperties,
+		const D3D12_RESOURCE_DESC& desc,
+		const D3D12_RESOURCE_STATES state,
+		const D3D12_CLEAR_VALUE* clearValue,
+		const GraphicsMemory::CATEGORY category,
+		const char* name
+	);
+
+	//**************************************************
+	/// \brief Invalidate the handle now, release the resource through DeferRelease
+	/// 
+	/// \return none
+	//**************************************************
+	void ReleaseResource(const ResourceHandle handle);
+
+	//**************************************************
+	/// \brief Look up a pooled resource
+	/// 
+	/// \return resource, nullptr for stale or invalid handles
+	//**************************************************
+	ID3D12Resource* Resource(const ResourceHandle handle) const;
+
+	const ResourcePool& Resources() const { return m_resources; }
+
+	//**************************************************
+	/// \brief Create committed resource and register it to GraphicsMemory
+	/// 
+	/// \param[in]  device			 ->	device
+	/// \param[in]  heapProperties	 ->	heap of the resource
+	/// \param[in]  desc			 ->	resource description
+	/// \param[in]  state			 ->	initial state
+	/// \param[in]  clearValue		 ->	optimized clear value (nullptr is none)
+	/// \param[out] resource		 ->	created resource, release with SAFE_RELEASE_TRACKED
+	/// \param[in]  category		 ->	usage of the memory
+	/// \param[in]  name			 ->	name for the leak report
+	/// 
+	/// \return result of CreateCommittedResource
+	//**************************************************
+	static HRESULT CreateCommittedResource(
+		ID3D12Device* device,
+		const D3D12_HEAP_PROPERTIES& heapProperties,
+		const D3D12_RESOURCE_DESC& desc,
+		const D3D12_RESOURCE_STATES state,
+		const D3D12_CLEAR_VALUE* clearValue,
+		ID3D12Resource** resource,
+		const GraphicsMemory::CATEGORY category,
+		const char* name
+	);
+
 private:
 	//**************************************************
 	/// \brief Create device and swapchain
@@ -100,6 +231,20 @@ private:
 	//**************************************************
 	bool CreateFence();
 
+	//**************************************************
+	/// \brief Create persistently mapped upload page of constants, appended to the chain
+	/// 
+	/// \return Succcess is true
+	//**************************************************
+	bool CreateConstantUpload();
+
+	//**************************************************
+	/// \brief Copy dirty constant blocks to the upload ring and bind them
+	/// 
+	/// \return none
+	//**************************************************
+	void UploadConstants();
+
 	//**************************************************
 	/// \brief Create graphics pipeline
 	/// 
@@ -107,6 +252,31 @@ private:
 	//**************************************************
 	bool CreateGraphicsPipeline();
 
+	//**************************************************
+	/// \brief Create pipeline states of VertexPacked
+	/// 
+	/// \param[in] graphicsPipeline	 ->	description of Vertex3D pipeline
+	/// 
+	/// \return Succcess is true
+	//**************************************************
+	bool CreatePackedPipelines(D3D12_GRAPHICS_PIPELINE_STATE_DESC graphicsPipeline);
+
+	//**************************************************
+	/// \brief Signal the queue and block until the gpu reaches the signal
+	/// 
+	/// \return none
+	//**************************************************
+	void WaitForGpu();
+
+	//**************************************************
+	/// \brief Release queued resources whose fence value the gpu passed
+	/// 
+	/// \param[in] completedValue	 ->	last fence value finished by the gpu
+	/// 
+	/// \return none
+	//**************************************************
+	void ProcessDeferredReleases(const UINT64 completedValue);
+
 	//**************************************************
 	/// \brief Set Resource barrier
 	/// 
@@ -142,6 +312,29 @@ private:
 		const int height
 	);
 
+	//**************************************************
+	/// \brief Pass adapter video memory budget to GraphicsMemory
+	/// 
+	/// \return none
+	//**************************************************
+	void UpdateMemoryBudget();
+
+#if PROFILER_ENABLE
+	//**************************************************
+	/// \brief Create timestamp query heap and readback buffer
+	/// 
+	/// \return Succcess is true
+	//**************************************************
+	bool CreateTimerQueries();
+
+	//**************************************************
+	/// \brief Read timestamps of the oldest frame in flight
+	/// 
+	/// \return none
+	//**************************************************
+	void ResolveTimerQueries();
+#endif
+
 	static const UINT			k_backBufferNum = 2;
 	ID3D12Device*				m_device;
 	ID3D12CommandAllocator*		m_commandAllocator;
@@ -154,9 +347,45 @@ private:
 	ID3D12DescriptorHeap*		m_depthBufferHeap;
 	ID3D12Fence*				m_fence;
 	UINT						m_fenceValue = 0;
+
+	//**************************************************
+	/// \brief Resource waiting for the gpu, queued in fence order
+	//**************************************************
+	struct DeferredRelease
+	{
+		IUnknown*	Resource;
+		UINT64		FenceValue;	// released when the completed value reaches this
+	};
+	std::deque<DeferredRelease>	m_deferredReleases;
+	ResourcePool				m_resources;	// Resources of objects, referenced by handle
 	ID3D12RootSignature*		m_rootSignature;
 	ID3D12PipelineState*		m_pipelineState;
+	ID3D12PipelineState*		m_packedPipelineStates[(size_t)structure::VERTEX_POSITION::NUM][(size_t)structure::VERTEX_TEXCOORD::NUM];
 	D3D12_VIEWPORT				m_viewport{};
 	D3D12_RECT					m_scissorRect{};
+	bool						m_occluded = false;
+	IDXGIAdapter3*				m_adapter = nullptr;	// Adapter for video memory budget
+	struct ConstantPage
+	{
+		ID3D12Resource*	Resource;
+		UINT8*			Map;		// persistent
+	};
+	std::vector<ConstantPage>	m_constantPages;			// Linear chain of constant blocks, rewound every frame
+	size_t						m_constantPage = 0;			// Page being filled
+	UINT64						m_constantOffset = 0;		// Next free byte of the page
+	GraphicsConstants			m_constants;				// Cpu copy and dirty flags of the constant blocks
+
+	static const UINT64			k_constantUploadSize = 1 << 20;	// 4096 blocks of 256 bytes per page, a frame adds pages as it needs
+
+	static const UINT			k_budgetInterval = 60;	// frames between budget queries
+
+#if PROFILER_ENABLE
+	static const UINT			k_timerLatency = 3;					// frames before timestamps are read back
+	ID3D12QueryHeap*			m_timerHeap = nullptr;				// begin / end timestamp per slot
+	ID3D12Resource*				m_timerReadback = nullptr;			// resolved timestamps
+	UINT64						m_timerFrequency = 0;				// ticks per second of the queue
+	uint64_t					m_timerCpuBegin[k_timerLatency]{};	// Cpu time at Clear (profiler clock)
+	UINT64						m_timerFrame = 0;
+#endif
 };
 
@@ -15,6 +15,8 @@ namespace structure
 		DirectX::XMFLOAT3 Normal;
 		DirectX::XMFLOAT2 TexCoord;
 	};
+
+	struct VertexLayout;	// Vertex_Format.h
 }
 
 
@@ -37,4 +39,8 @@ public:
 	virtual void	Present()									= 0;
 	virtual void*	Device()  { return nullptr; }
 	virtual void*	Context() { return nullptr; }
+	virtual bool	Occluded() { return false; }
+	virtual void	SetVertexLayout(const structure::VertexLayout* layout) { (void)layout; }	// nullptr is Vertex3D
+	virtual void	SetCamera(const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& projection) { (void)view; (void)projection; }	// per frame, view projection is multiplied on the cpu
+	virtual void	SetObjectConstants(const DirectX::XMFLOAT4X4& world, const DirectX::XMFLOAT4& color) { (void)world; (void)color; }	// right before a draw, uploads only dirty blocks
 };
@@ -0,0 +1,208 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Graphics_Memory.cpp
+*		Detail	: Gpu resource accounting per category and video memory budget
+===================================================================================*/
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#endif
+
+#include "Graphics_Memory.h"
+
+namespace
+{
+	const double k_budgetWarningRatio = 0.9;	// warn when tracked memory reaches this part of the budget
+
+	struct Allocation
+	{
+		GraphicsMemory::CATEGORY	Category;
+		uint64_t					Size;
+		const char*					Name;
+	};
+
+	struct MemoryState
+	{
+		std::mutex										Mutex;		// guards everything below
+		std::unordered_map<const void*, Allocation>		Allocations;
+		GraphicsMemory::Statistics						Statistics{};
+		bool											Warned = false;
+	};
+
+	MemoryState& State()
+	{
+		static MemoryState state;
+		return state;
+	}
+
+	//**************************************************
+	/// \brief Debugger output, stderr without debugger api
+	//**************************************************
+	void Print(const char* text)
+	{
+#if defined(_WIN32)
+		OutputDebugStringA(text);
+#else
+		std::fputs(text, stderr);
+#endif
+	}
+
+	//**************************************************
+	/// \brief Warn once each time tracked memory crosses the warning line
+	//**************************************************
+	void CheckBudget(MemoryState& state)
+	{
+		const GraphicsMemory::Statistics& statistics = state.Statistics;
+		if (statistics.Budget == 0)
+			return;
+
+		bool over = double(statistics.Total) >= double(statistics.Budget) * k_budgetWarningRatio;
+		if (over && !state.Warned)
+		{
+			char text[160];
+			std::snprintf(
+				text, sizeof(text),
+				"[GraphicsMemory] tracked %.1f MB of %.1f MB budget, eviction is close\n",
+				double(statistics.Total) / (1024.0 * 1024.0),
+				double(statistics.Budget) / (1024.0 * 1024.0)
+			);
+			Print(text);
+		}
+		state.Warned = over;
+	}
+}
+
+/* Track */
+void GraphicsMemory::Track(const void* resource, const CATEGORY category, const uint64_t size, const char* name)
+{
+	if (!resource)
+		return;
+
+	MemoryState& state = State();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+
+	Statistics& statistics = state.Statistics;
+	auto it = state.Allocations.find(resource);
+	if (it != state.Allocations.end())
+	{// Same pointer tracked twice, replace the old record
+		const size_t index = (size_t)it->second.Category;
+		statistics.Current[index]	-= it->second.Size;
+		statistics.Count[index]		-= 1;
+		statistics.Total			-= it->second.Size;
+	}
+	state.Allocations[resource] = Allocation{ category, size, name };
+
+	const size_t index = (size_t)category;
+	statistics.Current[index]	+= size;
+	statistics.Count[index]		+= 1;
+	statistics.Total			+= size;
+	statistics.Peak[index]		= (std::max)(statistics.Peak[index], statistics.Current[index]);
+	statistics.TotalPeak		= (std::max)(statistics.TotalPeak, statistics.Total);
+
+	CheckBudget(state);
+}
+
+/* Untrack */
+void GraphicsMemory::Untrack(const void* resource)
+{
+	if (!resource)
+		return;
+
+	MemoryState& state = State();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+
+	auto it = state.Allocations.find(resource);
+	if (it == state.Allocations.end())
+		return;
+
+	Statistics& statistics = state.Statistics;
+	const size_t index = (size_t)it->second.Category;
+	statistics.Current[index]	-= it->second.Size;
+	statistics.Count[index]		-= 1;
+	statistics.Total			-= it->second.Size;
+	state.Allocations.erase(it);
+
+	CheckBudget(state);
+}
+
+/* Set budget */
+void GraphicsMemory::SetBudget(const uint64_t budget, const uint64_t processUsage)
+{
+	MemoryState& state = State();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+
+	state.Statistics.Budget			= budget;
+	state.Statistics.ProcessUsage	= processUsage;
+	CheckBudget(state);
+}
+
+/* Over budget */
+bool GraphicsMemory::OverBudget()
+{
+	MemoryState& state = State();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+	return state.Warned;
+}
+
+/* Get statistics */
+GraphicsMemory::Statistics GraphicsMemory::GetStatistics()
+{
+	MemoryState& state = State();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+	return state.Statistics;
+}
+
+/* Report leaks */
+size_t GraphicsMemory::ReportLeaks()
+{
+	MemoryState& state = State();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+
+	const Statistics& statistics = state.Statistics;
+	char text[256];
+	for (size_t i = 0; i < (size_t)CATEGORY::NUM; ++i)
+	{
+		std::snprintf(
+			text, sizeof(text),
+			"[GraphicsMemory] %-14s current %10llu bytes, peak %10llu bytes\n",
+			GraphicsMemory::CategoryName(CATEGORY(i)),
+			(unsigned long long)statistics.Current[i],
+			(unsigned long long)statistics.Peak[i]
+		);
+		Print(text);
+	}
+
+	for (const auto& pair : state.Allocations)
+	{
+		std::snprintf(
+			text, sizeof(text),
+			"[GraphicsMemory] leak %p %s (%s) %llu bytes\n",
+			pair.first,
+			pair.second.Name ? pair.second.Name : "unnamed",
+			GraphicsMemory::CategoryName(pair.second.Category),
+			(unsigned long long)pair.second.Size
+		);
+		Print(text);
+	}
+
+	return state.Allocations.size();
+}
+
+/* Category name */
+const char* GraphicsMemory::CategoryName(const CATEGORY category)
+{
+	switch (category)
+	{
+	case CATEGORY::GEOMETRY:		return "Geometry";
+	case CATEGORY::CONSTANTS:		return "Constants";
+	case CATEGORY::RENDER_TARGETS:	return "RenderTargets";
+	case CATEGORY::TEXTURES:		return "Textures";
+	case CATEGORY::OTHER:			return "Other";
+	default:						return "Unknown";
+	}
+}
@@ -0,0 +1,119 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Graphics_Memory.h
+*		Detail	: Gpu resource accounting per category and video memory budget
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "Graphics_Interface.h"
+
+//**************************************************
+/// \brief Untrack and release a tracked resource
+///
+/// \return none
+//**************************************************
+#define SAFE_RELEASE_TRACKED(p)\
+	GraphicsMemory::Untrack(p);\
+	SAFE_RELEASE(p)\
+
+class GraphicsMemory
+{
+public:
+	//**************************************************
+	/// \brief What the memory is used for
+	//**************************************************
+	enum class CATEGORY
+	{
+		GEOMETRY,		// vertex and index buffers
+		CONSTANTS,		// constant buffers
+		RENDER_TARGETS,	// back buffers and depth buffers
+		TEXTURES,		// shader resources
+		OTHER,			// queries, readback
+		NUM
+	};
+
+	//**************************************************
+	/// \brief Snapshot of tracked memory (bytes)
+	//**************************************************
+	struct Statistics
+	{
+		uint64_t	Current[(size_t)CATEGORY::NUM];
+		uint64_t	Peak[(size_t)CATEGORY::NUM];
+		uint32_t	Count[(size_t)CATEGORY::NUM];	// live resources
+		uint64_t	Total;
+		uint64_t	TotalPeak;
+		uint64_t	Budget;							// adapter budget, zero if unknown
+		uint64_t	ProcessUsage;					// usage reported by the os for this process
+	};
+
+public:
+	//**************************************************
+	/// \brief Register created resource
+	///
+	/// \param[in] resource	 ->	resource pointer used as the key
+	/// \param[in] category	 ->	usage of the memory
+	/// \param[in] size		 ->	allocation size in bytes
+	/// \param[in] name		 ->	name for the leak report, must be a string literal
+	///
+	/// \return none
+	//**************************************************
+	static void Track(
+		const void* resource,
+		const CATEGORY category,
+		const uint64_t size,
+		const char* name
+	);
+
+	//**************************************************
+	/// \brief Unregister resource before release (nullptr is ignored)
+	///
+	/// \param[in] resource	 ->	resource pointer passed to Track
+	///
+	/// \return none
+	//**************************************************
+	static void Untrack(const void* resource);
+
+	//**************************************************
+	/// \brief Store adapter budget and warn when tracked memory gets close
+	///
+	/// \param[in] budget		 ->	budget from QueryVideoMemoryInfo
+	/// \param[in] processUsage	 ->	current usage from QueryVideoMemoryInfo
+	///
+	/// \return none
+	//**************************************************
+	static void SetBudget(
+		const uint64_t budget,
+		const uint64_t processUsage
+	);
+
+	//**************************************************
+	/// \brief Tracked memory exceeds the warning ratio of the budget
+	///
+	/// \return if close to eviction then true
+	//**************************************************
+	static bool OverBudget();
+
+	//**************************************************
+	/// \brief Get current totals and peaks
+	///
+	/// \return statistics
+	//**************************************************
+	static Statistics GetStatistics();
+
+	//**************************************************
+	/// \brief Print totals, peaks and resources still alive
+	///
+	/// \return number of leaked resources
+	//**************************************************
+	static size_t ReportLeaks();
+
+	//**************************************************
+	/// \brief Name of category
+	///
+	/// \return string literal
+	//**************************************************
+	static const char* CategoryName(const CATEGORY category);
+};
@@ -0,0 +1,244 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Graphics_Null.cpp
+*		Detail	:
+===================================================================================*/
+#include <cstring>
+
+#include "Graphics_Null.h"
+using namespace DirectX;
+using namespace structure;
+
+/* Constructor */
+GraphicsNull::GraphicsNull(const bool record)
+	:m_record(record),
+	m_frame(),
+	m_lastFrame(),
+	m_total(),
+	m_frameCount(0),
+	m_boundVertices(nullptr),
+	m_boundIndices(nullptr),
+	m_boundWorld(),
+	m_boundColor(),
+	m_boundView(),
+	m_boundProjection()
+{
+}
+
+/* Initialize */
+bool GraphicsNull::Init(int width, int height, void* handle)
+{
+	(void)width;
+	(void)height;
+	(void)handle;
+
+	m_frame			= Statistics{};
+	m_lastFrame		= Statistics{};
+	m_total			= Statistics{};
+	m_frameCount	= 0;
+	return true;
+}
+
+/* Uninitialize */
+void GraphicsNull::Uninit()
+{
+	m_commands.clear();
+	m_matrices.clear();
+	m_colors.clear();
+}
+
+/* Clear */
+void GraphicsNull::Clear()
+{
+	m_frame = Statistics{};
+
+	// Bindings do not survive frame boundary, same as a reset command list
+	m_boundVertices = nullptr;
+	m_boundIndices	= nullptr;
+	std::memset(&m_boundWorld, 0, sizeof(m_boundWorld));
+	m_boundColor	= XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f);
+	std::memset(&m_boundView, 0, sizeof(m_boundView));
+	std::memset(&m_boundProjection, 0, sizeof(m_boundProjection));
+
+	m_commands.clear();
+	m_matrices.clear();
+	m_colors.clear();
+}
+
+/* Present */
+void GraphicsNull::Present()
+{
+	m_lastFrame = m_frame;
+
+	m_total.Calls			+= m_frame.Calls;
+	m_total.DrawCalls		+= m_frame.DrawCalls;
+	m_total.Triangles		+= m_frame.Triangles;
+	m_total.StateChanges	+= m_frame.StateChanges;
+	m_total.RedundantStates	+= m_frame.RedundantStates;
+	m_total.VertexBytes		+= m_frame.VertexBytes;
+	m_total.IndexBytes		+= m_frame.IndexBytes;
+	m_total.ConstantBytes	+= m_frame.ConstantBytes;
+	++m_frameCount;
+}
+
+/* Get context pointer */
+void* GraphicsNull::Context()
+{
+	return static_cast<ICommandContext*>(this);
+}
+
+/* Set vertex buffer */
+void GraphicsNull::SetVertexBuffer(const Vertex3D* vertices, unsigned int vertexNum)
+{
+	++m_frame.Calls;
+	m_frame.VertexBytes += uint64_t(vertexNum) * sizeof(Vertex3D);
+	if (m_boundVertices == vertices)
+		++m_frame.RedundantStates;
+	else
+		++m_frame.StateChanges;
+	m_boundVertices = vertices;
+
+	if (m_record)
+		m_commands.push_back(Command{ Command::TYPE::SET_VERTEX_BUFFER, vertices, { vertexNum, 0, 0 }, 0 });
+}
+
+/* Set index buffer */
+void GraphicsNull::SetIndexBuffer(const unsigned int* indices, unsigned int indexNum)
+{
+	++m_frame.Calls;
+	m_frame.IndexBytes += uint64_t(indexNum) * sizeof(unsigned int);
+	if (m_boundIndices == indices)
+		++m_frame.RedundantStates;
+	else
+		++m_frame.StateChanges;
+	m_boundIndices = indices;
+
+	if (m_record)
+		m_commands.push_back(Command{ Command::TYPE::SET_INDEX_BUFFER, indices, { indexNum, 0, 0 }, 0 });
+}
+
+/* Set index buffer (16 bit) */
+void GraphicsNull::SetIndexBuffer(const unsigned short* indices, unsigned int indexNum)
+{
+	++m_frame.Calls;
+	m_frame.IndexBytes += uint64_t(indexNum) * sizeof(unsigned short);
+	if (m_boundIndices == indices)
+		++m_frame.RedundantStates;
+	else
+		++m_frame.StateChanges;
+	m_boundIndices = indices;
+
+	if (m_record)
+		m_commands.push_back(Command{ Command::TYPE::SET_INDEX_BUFFER_16, indices, { indexNum, 0, 0 }, 0 });
+}
+
+/* Set camera */
+void GraphicsNull::SetCamera(const XMFLOAT4X4& view, const XMFLOAT4X4& projection)
+{
+	// Only the precomputed view projection reaches a real backend
+	++m_frame.Calls;
+	m_frame.ConstantBytes += sizeof(XMFLOAT4X4);
+	if (std::memcmp(&m_boundView, &view, sizeof(XMFLOAT4X4)) == 0 && std::memcmp(&m_boundProjection, &projection, sizeof(XMFLOAT4X4)) == 0)
+		++m_frame.RedundantStates;
+	else
+		++m_frame.StateChanges;
+	m_boundView			= view;
+	m_boundProjection	= projection;
+
+	if (m_record)
+	{
+		m_commands.push_back(Command{ Command::TYPE::SET_CAMERA, nullptr, { 0, 0, 0 }, uint32_t(m_matrices.size()) });
+		m_matrices.push_back(view);
+		m_matrices.push_back(projection);
+	}
+}
+
+/* Set object constants */
+void GraphicsNull::SetObjectConstants(const XMFLOAT4X4& world, const XMFLOAT4& color)
+{
+	this->SetWorldMatrix(world);
+	this->SetMaterialColor(color);
+}
+
+/* Set world matrix */
+void GraphicsNull::SetWorldMatrix(const XMFLOAT4X4& world)
+{
+	++m_frame.Calls;
+	m_frame.ConstantBytes += sizeof(XMFLOAT4X4);
+	if (std::memcmp(&m_boundWorld, &world, sizeof(XMFLOAT4X4)) == 0)
+		++m_frame.RedundantStates;
+	else
+		++m_frame.StateChanges;
+	m_boundWorld = world;
+
+	if (m_record)
+	{
+		m_commands.push_back(Command{ Command::TYPE::SET_WORLD_MATRIX, nullptr, { 0, 0, 0 }, uint32_t(m_matrices.size()) });
+		m_matrices.push_back(world);
+	}
+}
+
+/* Set material color */
+void GraphicsNull::SetMaterialColor(const XMFLOAT4& color)
+{
+	++m_frame.Calls;
+	m_frame.ConstantBytes += sizeof(XMFLOAT4);
+	if (std::memcmp(&m_boundColor, &color, sizeof(XMFLOAT4)) == 0)
+		++m_frame.RedundantStates;
+	else
+		++m_frame.StateChanges;
+	m_boundColor = color;
+
+	if (m_record)
+	{
+		m_commands.push_back(Command{ Command::TYPE::SET_MATERIAL_COLOR, nullptr, { 0, 0, 0 }, uint32_t(m_colors.size()) });
+		m_colors.push_back(color);
+	}
+}
+
+/* Draw indexed */
+void GraphicsNull::DrawIndexed(unsigned int indexNum, unsigned int startIndex, int baseVertex)
+{
+	++m_frame.Calls;
+	++m_frame.DrawCalls;
+	m_frame.Triangles += indexNum / 3;
+
+	if (m_record)
+		m_commands.push_back(Command{ Command::TYPE::DRAW_INDEXED, nullptr, { indexNum, startIndex, uint32_t(baseVertex) }, 0 });
+}
+
+/* Replay */
+void GraphicsNull::Replay(IGraphics* graphics) const
+{
+	ICommandContext* context = (ICommandContext*)graphics->Context();
+	for (const Command& command : m_commands)
+	{
+		switch (command.Type)
+		{
+		case Command::TYPE::SET_VERTEX_BUFFER:
+			context->SetVertexBuffer((const Vertex3D*)command.Data, command.Args[0]);
+			break;
+		case Command::TYPE::SET_INDEX_BUFFER:
+			context->SetIndexBuffer((const unsigned int*)command.Data, command.Args[0]);
+			break;
+		case Command::TYPE::SET_INDEX_BUFFER_16:
+			context->SetIndexBuffer((const unsigned short*)command.Data, command.Args[0]);
+			break;
+		case Command::TYPE::SET_WORLD_MATRIX:
+			context->SetWorldMatrix(m_matrices[command.ConstantIndex]);
+			break;
+		case Command::TYPE::SET_MATERIAL_COLOR:
+			context->SetMaterialColor(m_colors[command.ConstantIndex]);
+			break;
+		case Command::TYPE::SET_CAMERA:
+			graphics->SetCamera(m_matrices[command.ConstantIndex], m_matrices[command.ConstantIndex + 1]);
+			break;
+		case Command::TYPE::DRAW_INDEXED:
+			context->DrawIndexed(command.Args[0], command.Args[1], int(command.Args[2]));
+			break;
+		default:
+			break;
+		}
+	}
+}
@@ -0,0 +1,142 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Graphics_Null.h
+*		Detail	: Backend without device work, counts and records submitted commands
+===================================================================================*/
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Graphics_CommandContext.h"
+
+class GraphicsNull final : public IGraphics, public ICommandContext
+{
+public:
+	//**************************************************
+	/// \brief Submission counters of one frame
+	//**************************************************
+	struct Statistics
+	{
+		uint64_t	Calls;				// every context call
+		uint64_t	DrawCalls;			// DrawIndexed calls
+		uint64_t	Triangles;			// triangles submitted by draws
+		uint64_t	StateChanges;		// set calls which changed the bound state
+		uint64_t	RedundantStates;	// set calls binding what was already bound
+		uint64_t	VertexBytes;		// bytes referenced by vertex buffer binds
+		uint64_t	IndexBytes;			// bytes referenced by index buffer binds
+		uint64_t	ConstantBytes;		// bytes of constant updates
+	};
+
+	//**************************************************
+	/// \brief Recorded command
+	//**************************************************
+	struct Command
+	{
+		enum class TYPE : uint8_t
+		{
+			SET_VERTEX_BUFFER,
+			SET_INDEX_BUFFER,
+			SET_INDEX_BUFFER_16,
+			SET_WORLD_MATRIX,
+			SET_MATERIAL_COLOR,
+			SET_CAMERA,
+			DRAW_INDEXED,
+		};
+
+		TYPE		Type;
+		const void*	Data;		// buffer pointer (bind commands)
+		uint32_t	Args[3];	// element count, or index count / start index / base vertex
+		uint32_t	ConstantIndex;	// index into recorded matrices or colors, camera is view then projection
+	};
+
+public:
+	//**************************************************
+	/// \brief Constructor
+	///
+	/// \param[in] record	 ->	keep the command stream of the frame
+	///
+	/// \return none
+	//**************************************************
+	explicit GraphicsNull(const bool record = false);
+
+	bool Init(int width, int height, void* handle) override;
+	void Uninit() override;
+
+	//**************************************************
+	/// \brief Begin frame, reset frame counters and recording
+	///
+	/// \return none
+	//**************************************************
+	void Clear() override;
+
+	//**************************************************
+	/// \brief End frame, accumulate frame counters into totals
+	///
+	/// \return none
+	//**************************************************
+	void Present() override;
+
+	//**************************************************
+	/// \brief Get context pointer
+	///
+	/// \return ICommandContext pointer
+	//**************************************************
+	void* Context() override;
+
+	//**************************************************
+	/// \brief Set camera, view projection is multiplied here once
+	///        Recorded and counted as one state change
+	///
+	/// \return none
+	//**************************************************
+	void SetCamera(const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& projection) override;
+
+	//**************************************************
+	/// \brief Same as SetWorldMatrix and SetMaterialColor
+	///
+	/// \return none
+	//**************************************************
+	void SetObjectConstants(const DirectX::XMFLOAT4X4& world, const DirectX::XMFLOAT4& color) override;
+
+	void SetVertexBuffer(const structure::Vertex3D* vertices, unsigned int vertexNum) override;
+	void SetIndexBuffer(const unsigned int* indices, unsigned int indexNum) override;
+	void SetIndexBuffer(const unsigned short* indices, unsigned int indexNum) override;
+	void SetWorldMatrix(const DirectX::XMFLOAT4X4& world) override;
+	void SetMaterialColor(const DirectX::XMFLOAT4& color) override;
+	void DrawIndexed(unsigned int indexNum, unsigned int startIndex, int baseVertex) override;
+
+	//**************************************************
+	/// \brief Replay recorded commands of the last frame
+	///        Buffers referenced by the commands must still be alive
+	///
+	/// \param[in] graphics	 ->	destination backend, Context() is ICommandContext
+	///
+	/// \return none
+	//**************************************************
+	void Replay(IGraphics* graphics) const;
+
+	void SetRecording(const bool record) { m_record = record; }
+
+	const Statistics& FrameStatistics() const { return m_lastFrame; }
+	const Statistics& TotalStatistics() const { return m_total; }
+	uint64_t FrameCount() const { return m_frameCount; }
+	const std::vector<Command>& Commands() const { return m_commands; }
+
+private:
+	bool								m_record;
+	Statistics							m_frame;		// counters of current frame
+	Statistics							m_lastFrame;	// counters of last presented frame
+	Statistics							m_total;		// counters since Init
+	uint64_t							m_frameCount;
+	const void*							m_boundVertices;
+	const void*							m_boundIndices;
+	DirectX::XMFLOAT4X4					m_boundWorld;
+	DirectX::XMFLOAT4					m_boundColor;
+	DirectX::XMFLOAT4X4					m_boundView;
+	DirectX::XMFLOAT4X4					m_boundProjection;
+	std::vector<Command>				m_commands;		// recorded stream of current frame
+	std::vector<DirectX::XMFLOAT4X4>	m_matrices;		// constant data of recorded stream
+	std::vector<DirectX::XMFLOAT4>		m_colors;
+};
+
@@ -0,0 +1,510 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Graphics_Software.cpp
+*		Detail	:
+===================================================================================*/
+#include <algorithm>
+#include <cmath>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define GRAPHICS_SOFTWARE_SSE
+#endif
+
+#include "Graphics_Software.h"
+#include "Memory_Tracker.h"
+#include "Profiler.h"
+using namespace DirectX;
+using namespace structure;
+
+static const float		k_clearColor[4]{ 0.0f, 0.5f, 0.0f, 1.0f };	// same as hardware backends
+static const float		k_maxDepth = 1.0f;							// depth clear value
+static const float		k_minimumW = 1e-5f;							// clip plane in front of the eye, keeps 1 / w finite
+
+//**************************************************
+/// \brief Pack normalized color to B8G8R8A8
+///
+/// \return packed color
+//**************************************************
+static inline uint32_t PackColor(float r, float g, float b, float a)
+{
+	auto toByte = [](float v) { return uint32_t((std::min)((std::max)(v, 0.0f), 1.0f) * 255.0f + 0.5f); };
+	return (toByte(a) << 24) | (toByte(r) << 16) | (toByte(g) << 8) | toByte(b);
+}
+
+/* Constructor */
+GraphicsSoftware::GraphicsSoftware()
+	:m_width(0),
+	m_height(0),
+	m_stride(0),
+	m_tileCountX(0),
+	m_tileCountY(0),
+	m_windowHandle(nullptr),
+	m_vertices(nullptr),
+	m_vertexNum(0),
+	m_indices(nullptr),
+	m_indexNum(0),
+	m_indices16(false),
+	m_world(),
+	m_viewProjection(),
+	m_materialColor(1.0f, 1.0f, 1.0f, 1.0f)
+{
+	XMStoreFloat4x4(&m_world, XMMatrixIdentity());
+	XMStoreFloat4x4(&m_viewProjection, XMMatrixIdentity());
+}
+
+/* Initialize */
+bool GraphicsSoftware::Init(int width, int height, void* handle)
+{
+	if (width <= 0 || height <= 0)
+		return false;
+
+	m_width			= width;
+	m_height		= height;
+	m_stride		= (width + 3) & ~3;	// 4 pixels are processed at once
+	m_tileCountX	= (width + k_tileSize - 1) / k_tileSize;
+	m_tileCountY	= (height + k_tileSize - 1) / k_tileSize;
+	m_windowHandle	= handle;
+
+	m_color.assign(size_t(m_stride) * m_height, 0);
+	m_depth.assign(size_t(m_stride) * m_height, k_maxDepth);
+	m_bins.resize(size_t(m_tileCountX) * m_tileCountY);
+	for (std::vector<uint32_t>& bin : m_bins)
+		bin.reserve(k_binReserve);	// bins grow rarely once busy tiles exceed this
+
+	return true;	// Success
+}
+
+/* Uninitialize */
+void GraphicsSoftware::Uninit()
+{
+	m_bins.clear();
+	m_triangles.clear();
+	m_transformed.clear();
+	m_depth.clear();
+	m_color.clear();
+}
+
+/* Clear */
+void GraphicsSoftware::Clear()
+{
+	PROFILE_SCOPE("GraphicsSoftware::Clear");
+
+	const uint32_t clearColor = PackColor(k_clearColor[0], k_clearColor[1], k_clearColor[2], k_clearColor[3]);
+	std::fill(m_color.begin(), m_color.end(), clearColor);
+	std::fill(m_depth.begin(), m_depth.end(), k_maxDepth);
+
+	m_materialColor = XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f);
+
+	// Keep capacity so steady state frames do not allocate
+	m_triangles.clear();
+	for (std::vector<uint32_t>& bin : m_bins)
+		bin.clear();
+}
+
+/* Present */
+void GraphicsSoftware::Present()
+{
+	PROFILE_SCOPE("GraphicsSoftware::Present");
+	MEMORY_TAG("GraphicsSoftware::Present");
+
+	// Tiles do not share pixels, so they are shaded without any synchronization
+	m_threadPool.ParallelFor(m_bins.size(), [this](size_t tileIndex)
+	{
+		this->RasterizeTile(tileIndex);
+	});
+
+	this->Blit();
+}
+
+/* Get context pointer */
+void* GraphicsSoftware::Context()
+{
+	return static_cast<ICommandContext*>(this);
+}
+
+/* Set camera */
+void GraphicsSoftware::SetCamera(const XMFLOAT4X4& view, const XMFLOAT4X4& projection)
+{
+	XMStoreFloat4x4(&m_viewProjection, XMMatrixMultiply(XMLoadFloat4x4(&view), XMLoadFloat4x4(&projection)));
+}
+
+/* Set object constants */
+void GraphicsSoftware::SetObjectConstants(const XMFLOAT4X4& world, const XMFLOAT4& color)
+{
+	this->SetWorldMatrix(world);
+	this->SetMaterialColor(color);
+}
+
+/* Set vertex buffer */
+void GraphicsSoftware::SetVertexBuffer(const Vertex3D* vertices, unsigned int vertexNum)
+{
+	m_vertices	= vertices;
+	m_vertexNum	= vertexNum;
+}
+
+/* Set index buffer */
+void GraphicsSoftware::SetIndexBuffer(const unsigned int* indices, unsigned int indexNum)
+{
+	m_indices	= indices;
+	m_indexNum	= indexNum;
+	m_indices16	= false;
+}
+
+/* Set index buffer (16 bit) */
+void GraphicsSoftware::SetIndexBuffer(const unsigned short* indices, unsigned int indexNum)
+{
+	m_indices	= indices;
+	m_indexNum	= indexNum;
+	m_indices16	= true;
+}
+
+/* Set world matrix */
+void GraphicsSoftware::SetWorldMatrix(const XMFLOAT4X4& world)
+{
+	m_world = world;
+}
+
+/* Set material color */
+void GraphicsSoftware::SetMaterialColor(const XMFLOAT4& color)
+{
+	m_materialColor = color;
+}
+
+/* Draw indexed */
+void GraphicsSoftware::DrawIndexed(unsigned int indexNum, unsigned int startIndex, int baseVertex)
+{
+	if (!m_vertices || !m_indices || startIndex + indexNum > m_indexNum)
+		return;
+
+	// Vertex shader
+	XMMATRIX transform = XMMatrixMultiply(XMLoadFloat4x4(&m_world), XMLoadFloat4x4(&m_viewProjection));
+	m_transformed.resize(m_vertexNum);
+	for (unsigned int i = 0; i < m_vertexNum; ++i)
+	{
+		XMVECTOR position = XMVectorSetW(XMLoadFloat3(&m_vertices[i].Position), 1.0f);
+		XMFLOAT4 clip;
+		XMStoreFloat4(&clip, XMVector4Transform(position, transform));
+
+		ClipVertex& out = m_transformed[i];
+		out.X		= clip.x;
+		out.Y		= clip.y;
+		out.Z		= clip.z;
+		out.W		= clip.w;
+		out.Color	= XMFLOAT3(	// pixel shader outputs the normal as color
+			m_vertices[i].Normal.x * m_materialColor.x,
+			m_vertices[i].Normal.y * m_materialColor.y,
+			m_vertices[i].Normal.z * m_materialColor.z
+		);
+	}
+
+	// Primitive assembly
+	if (m_indices16)
+		this->AssembleTriangles((const unsigned short*)m_indices + startIndex, indexNum, baseVertex);
+	else
+		this->AssembleTriangles((const unsigned int*)m_indices + startIndex, indexNum, baseVertex);
+}
+
+// Primitive assembly of 16 or 32 bit indices
+template<typename INDEX>
+void GraphicsSoftware::AssembleTriangles(const INDEX* indices, const unsigned int indexNum, const int baseVertex)
+{
+	for (unsigned int i = 0; i + 2 < indexNum; i += 3)
+	{
+		long long i0 = (long long)indices[i + 0] + baseVertex;
+		long long i1 = (long long)indices[i + 1] + baseVertex;
+		long long i2 = (long long)indices[i + 2] + baseVertex;
+		if (i0 < 0 || i1 < 0 || i2 < 0 || i0 >= m_vertexNum || i1 >= m_vertexNum || i2 >= m_vertexNum)
+			continue;
+
+		this->BinTriangle(m_transformed[size_t(i0)], m_transformed[size_t(i1)], m_transformed[size_t(i2)]);
+	}
+}
+
+// Clip against the near plane and bin the pieces
+void GraphicsSoftware::BinTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2)
+{
+	// Distance to z = 0 (near plane of the hardware backends) and to w = k_minimumW
+	auto inside = [](const ClipVertex& v) { return v.Z >= 0.0f && v.W >= k_minimumW; };
+	if (inside(v0) && inside(v1) && inside(v2))
+	{
+		this->SetupTriangle(v0, v1, v2);
+		return;
+	}
+
+	// Sutherland-Hodgman, each plane adds at most one vertex
+	ClipVertex polygon[5]{ v0, v1, v2 };
+	ClipVertex clipped[5];
+	int vertexNum = 3;
+	for (int plane = 0; plane < 2 && vertexNum > 0; ++plane)
+	{
+		auto distance = [plane](const ClipVertex& v) { return plane == 0 ? v.Z : v.W - k_minimumW; };
+
+		int clippedNum = 0;
+		for (int i = 0; i < vertexNum; ++i)
+		{
+			const ClipVertex& a	= polygon[i];
+			const ClipVertex& b	= polygon[(i + 1) % vertexNum];
+			const float da		= distance(a);
+			const float db		= distance(b);
+			if (da >= 0.0f)
+				clipped[clippedNum++] = a;
+			if ((da >= 0.0f) != (db >= 0.0f))
+			{
+				const float t = da / (da - db);
+				ClipVertex& v	= clipped[clippedNum++];
+				v.X				= a.X + (b.X - a.X) * t;
+				v.Y				= a.Y + (b.Y - a.Y) * t;
+				v.Z				= a.Z + (b.Z - a.Z) * t;
+				v.W				= a.W + (b.W - a.W) * t;
+				v.Color			= XMFLOAT3(a.Color.x + (b.Color.x - a.Color.x) * t, a.Color.y + (b.Color.y - a.Color.y) * t, a.Color.z + (b.Color.z - a.Color.z) * t);
+				if (plane == 0)
+					v.Z = 0.0f;	// exactly on the plane despite rounding
+				else
+					v.W = (std::max)(v.W, k_minimumW);
+			}
+		}
+
+		std::copy(clipped, clipped + clippedNum, polygon);
+		vertexNum = clippedNum;
+	}
+
+	// Fan keeps the winding of the input triangle
+	for (int i = 1; i + 1 < vertexNum; ++i)
+		this->SetupTriangle(polygon[0], polygon[i], polygon[i + 1]);
+}
+
+// Setup triangle and bin into tiles
+void GraphicsSoftware::SetupTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2)
+{
+	const ClipVertex* v[3]{ &v0, &v1, &v2 };
+
+	Triangle triangle;
+	float x[3], y[3];
+	for (int i = 0; i < 3; ++i)
+	{// Viewport transform
+		float invW = 1.0f / v[i]->W;
+		x[i] = ( v[i]->X * invW * 0.5f + 0.5f) * float(m_width);
+		y[i] = (-v[i]->Y * invW * 0.5f + 0.5f) * float(m_height);
+		triangle.Z[i]		= v[i]->Z * invW;
+		triangle.InvW[i]	= invW;
+		triangle.Color[i]	= XMFLOAT3(v[i]->Color.x * invW, v[i]->Color.y * invW, v[i]->Color.z * invW);
+	}
+
+	// Frustum reject
+	float minX = (std::min)({ x[0], x[1], x[2] });
+	float maxX = (std::max)({ x[0], x[1], x[2] });
+	float minY = (std::min)({ y[0], y[1], y[2] });
+	float maxY = (std::max)({ y[0], y[1], y[2] });
+	if (maxX < 0.0f || maxY < 0.0f || minX >= float(m_width) || minY >= float(m_height))
+		return;
+	if ((std::max)({ triangle.Z[0], triangle.Z[1], triangle.Z[2] }) < 0.0f || (std::min)({ triangle.Z[0], triangle.Z[1], triangle.Z[2] }) > 1.0f)
+		return;
+
+	// Edge i is opposite to vertex i, so E_i(vertex i) equals the doubled area
+	for (int i = 0; i < 3; ++i)
+	{
+		int a = (i + 1) % 3;
+		int b = (i + 2) % 3;
+		triangle.EdgeA[i] = y[a] - y[b];
+		triangle.EdgeB[i] = x[b] - x[a];
+		triangle.EdgeC[i] = -(triangle.EdgeA[i] * x[a] + triangle.EdgeB[i] * y[a]);
+	}
+
+	float area = triangle.EdgeA[0] * x[0] + triangle.EdgeB[0] * y[0] + triangle.EdgeC[0];
+	if (area == 0.0f)
+		return;
+
+	if (area < 0.0f)
+	{// Cull none, flip so inside is always positive
+		for (int i = 0; i < 3; ++i)
+		{
+			triangle.EdgeA[i] = -triangle.EdgeA[i];
+			triangle.EdgeB[i] = -triangle.EdgeB[i];
+			triangle.EdgeC[i] = -triangle.EdgeC[i];
+		}
+		area = -area;
+	}
+
+	for (int i = 0; i < 3; ++i)
+		triangle.TopLeft[i] = triangle.EdgeA[i] > 0.0f || (triangle.EdgeA[i] == 0.0f && triangle.EdgeB[i] > 0.0f);
+
+	// Clamp before converting, far outside coordinates do not fit in int
+	auto clamp = [](float value, int maximum) { return int((std::min)((std::max)(value, 0.0f), float(maximum))); };
+	triangle.InvArea	= 1.0f / area;
+	triangle.MinX		= clamp(std::floor(minX), m_width - 1);
+	triangle.MinY		= clamp(std::floor(minY), m_height - 1);
+	triangle.MaxX		= clamp(std::ceil(maxX), m_width - 1);
+	triangle.MaxY		= clamp(std::ceil(maxY), m_height - 1);
+
+	uint32_t triangleIndex = uint32_t(m_triangles.size());
+	m_triangles.push_back(triangle);
+
+	for (int ty = triangle.MinY / k_tileSize; ty <= triangle.MaxY / k_tileSize; ++ty)
+	{
+		for (int tx = triangle.MinX / k_tileSize; tx <= triangle.MaxX / k_tileSize; ++tx)
+		{
+			m_bins[size_t(ty) * m_tileCountX + tx].push_back(triangleIndex);
+		}
+	}
+}
+
+// Rasterize tile
+void GraphicsSoftware::RasterizeTile(const size_t tileIndex)
+{
+	PROFILE_SCOPE("GraphicsSoftware::RasterizeTile");
+	MEMORY_TAG("GraphicsSoftware::RasterizeTile");
+
+	const int tileX0 = int(tileIndex % m_tileCountX) * k_tileSize;
+	const int tileY0 = int(tileIndex / m_tileCountX) * k_tileSize;
+	const int tileX1 = (std::min)(tileX0 + k_tileSize, m_width) - 1;
+	const int tileY1 = (std::min)(tileY0 + k_tileSize, m_height) - 1;
+
+	for (uint32_t triangleIndex : m_bins[tileIndex])
+	{
+		const Triangle& t = m_triangles[triangleIndex];
+		const int minX = (std::max)(t.MinX, tileX0) & ~3;	// align to 4 pixel quad, tiles are multiple of 4 wide
+		const int maxX = (std::min)(t.MaxX, tileX1);
+		const int minY = (std::max)(t.MinY, tileY0);
+		const int maxY = (std::min)(t.MaxY, tileY1);
+
+#if defined(GRAPHICS_SOFTWARE_SSE)
+		const __m128 laneOffset = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+		const __m128i laneIndex = _mm_set_epi32(3, 2, 1, 0);
+		const __m128 zero		= _mm_setzero_ps();
+		const __m128 one		= _mm_set1_ps(1.0f);
+		const __m128 scale		= _mm_set1_ps(255.0f);
+		const __m128 invArea	= _mm_set1_ps(t.InvArea);
+		__m128 edgeA[3], topLeft[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			edgeA[i]	= _mm_set1_ps(t.EdgeA[i]);
+			topLeft[i]	= _mm_castsi128_ps(_mm_set1_epi32(t.TopLeft[i] ? -1 : 0));
+		}
+
+		for (int y = minY; y <= maxY; ++y)
+		{
+			const float py = float(y) + 0.5f;
+			float*		depthRow = &m_depth[size_t(y) * m_stride];
+			uint32_t*	colorRow = &m_color[size_t(y) * m_stride];
+
+			for (int x = minX; x <= maxX; x += 4)
+			{
+				__m128 px = _mm_add_ps(_mm_set1_ps(float(x)), laneOffset);
+
+				// Edge functions of 4 pixels
+				__m128 e[3];
+				__m128 mask = _mm_castsi128_ps(_mm_cmplt_epi32(laneIndex, _mm_set1_epi32(maxX - x + 1)));
+				for (int i = 0; i < 3; ++i)
+				{
+					e[i] = _mm_add_ps(_mm_mul_ps(edgeA[i], px), _mm_set1_ps(t.EdgeB[i] * py + t.EdgeC[i]));
+					__m128 inside = _mm_or_ps(_mm_cmpgt_ps(e[i], zero), _mm_and_ps(topLeft[i], _mm_cmpeq_ps(e[i], zero)));
+					mask = _mm_and_ps(mask, inside);
+				}
+				if (_mm_movemask_ps(mask) == 0)
+					continue;
+
+				// Barycentric weights
+				__m128 l0 = _mm_mul_ps(e[0], invArea);
+				__m128 l1 = _mm_mul_ps(e[1], invArea);
+				__m128 l2 = _mm_mul_ps(e[2], invArea);
+				auto interpolate = [&](float a0, float a1, float a2)
+				{
+					return _mm_add_ps(_mm_add_ps(_mm_mul_ps(l0, _mm_set1_ps(a0)), _mm_mul_ps(l1, _mm_set1_ps(a1))), _mm_mul_ps(l2, _mm_set1_ps(a2)));
+				};
+
+				// Depth test (LESS)
+				__m128 z		= interpolate(t.Z[0], t.Z[1], t.Z[2]);
+				__m128 depth	= _mm_loadu_ps(depthRow + x);
+				mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmplt_ps(z, depth), _mm_cmpge_ps(z, zero)));
+				if (_mm_movemask_ps(mask) == 0)
+					continue;
+				_mm_storeu_ps(depthRow + x, _mm_or_ps(_mm_and_ps(mask, z), _mm_andnot_ps(mask, depth)));
+
+				// Perspective correct color
+				__m128 w = _mm_div_ps(one, interpolate(t.InvW[0], t.InvW[1], t.InvW[2]));
+				auto channel = [&](__m128 value)
+				{
+					value = _mm_min_ps(_mm_max_ps(_mm_mul_ps(value, w), zero), one);
+					return _mm_cvtps_epi32(_mm_mul_ps(value, scale));
+				};
+				__m128i r = channel(interpolate(t.Color[0].x, t.Color[1].x, t.Color[2].x));
+				__m128i g = channel(interpolate(t.Color[0].y, t.Color[1].y, t.Color[2].y));
+				__m128i b = channel(interpolate(t.Color[0].z, t.Color[1].z, t.Color[2].z));
+				__m128i color = _mm_or_si128(
+					_mm_or_si128(_mm_set1_epi32(int(0xff000000)), _mm_slli_epi32(r, 16)),
+					_mm_or_si128(_mm_slli_epi32(g, 8), b)
+				);
+
+				__m128i* target = (__m128i*)(colorRow + x);
+				__m128i old		= _mm_loadu_si128(target);
+				__m128i blend	= _mm_castps_si128(mask);
+				_mm_storeu_si128(target, _mm_or_si128(_mm_and_si128(blend, color), _mm_andnot_si128(blend, old)));
+			}
+		}
+#else
+		for (int y = minY; y <= maxY; ++y)
+		{
+			const float py = float(y) + 0.5f;
+			for (int x = minX; x <= maxX; ++x)
+			{
+				const float px = float(x) + 0.5f;
+				float e[3];
+				bool inside = true;
+				for (int i = 0; i < 3; ++i)
+				{
+					e[i] = t.EdgeA[i] * px + t.EdgeB[i] * py + t.EdgeC[i];
+					inside = inside && (e[i] > 0.0f || (e[i] == 0.0f && t.TopLeft[i]));
+				}
+				if (!inside)
+					continue;
+
+				float l0 = e[0] * t.InvArea, l1 = e[1] * t.InvArea, l2 = e[2] * t.InvArea;
+				float z = l0 * t.Z[0] + l1 * t.Z[1] + l2 * t.Z[2];
+				float& depth = m_depth[size_t(y) * m_stride + x];
+				if (!(z < depth) || z < 0.0f)
+					continue;
+				depth = z;
+
+				float w = 1.0f / (l0 * t.InvW[0] + l1 * t.InvW[1] + l2 * t.InvW[2]);
+				m_color[size_t(y) * m_stride + x] = PackColor(
+					(l0 * t.Color[0].x + l1 * t.Color[1].x + l2 * t.Color[2].x) * w,
+					(l0 * t.Color[0].y + l1 * t.Color[1].y + l2 * t.Color[2].y) * w,
+					(l0 * t.Color[0].z + l1 * t.Color[1].z + l2 * t.Color[2].z) * w,
+					1.0f
+				);
+			}
+		}
+#endif
+	}
+}
+
+// Copy color target to window
+void GraphicsSoftware::Blit()
+{
+#if defined(_WIN32)
+	if (!m_windowHandle)
+		return;
+
+	HWND hWnd	= (HWND)m_windowHandle;
+	HDC hdc		= GetDC(hWnd);
+	if (!hdc)
+		return;
+
+	BITMAPINFO info{};
+	info.bmiHeader.biSize			= sizeof(BITMAPINFOHEADER);
+	info.bmiHeader.biWidth			= m_stride;
+	info.bmiHeader.biHeight			= -m_height;	// top down
+	info.bmiHeader.biPlanes			= 1;
+	info.bmiHeader.biBitCount		= 32;
+	info.bmiHeader.biCompression	= BI_RGB;
+	SetDIBitsToDevice(hdc, 0, 0, m_width, m_height, 0, 0, 0, m_height, m_color.data(), &info, DIB_RGB_COLORS);
+
+	ReleaseDC(hWnd, hdc);
+#endif
+}
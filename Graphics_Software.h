@@ -0,0 +1,201 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Graphics_Software.h
+*		Detail	: Tile based cpu rasterizer, renders without gpu or window
+===================================================================================*/
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Graphics_CommandContext.h"
+#include "Thread_Pool.h"
+
+class GraphicsSoftware final : public IGraphics, public ICommandContext
+{
+public:
+	//**************************************************
+	/// \brief Constructor
+	///
+	/// \return none
+	//**************************************************
+	GraphicsSoftware();
+
+	//**************************************************
+	/// \brief Initialize software rasterizer
+	///
+	/// \param[in] width	 ->	render target width
+	/// \param[in] height	 ->	render target height
+	/// \param[in] handle	 ->	window handle to show the image (nullptr is headless)
+	///
+	/// \return Success is true
+	//**************************************************
+	bool Init(int width, int height, void* handle) override;
+
+	//**************************************************
+	/// \brief Uninitialize software rasterizer
+	///
+	/// \return none
+	//**************************************************
+	void Uninit() override;
+
+	//**************************************************
+	/// \brief Clear color and depth target
+	///
+	/// \return none
+	//**************************************************
+	void Clear() override;
+
+	//**************************************************
+	/// \brief Rasterize binned triangles then show the image
+	///
+	/// \return none
+	//**************************************************
+	void Present() override;
+
+	//**************************************************
+	/// \brief Get context pointer
+	///
+	/// \return ICommandContext pointer
+	//**************************************************
+	void* Context() override;
+
+	//**************************************************
+	/// \brief Set camera, view projection is multiplied here once
+	///
+	/// \return none
+	//**************************************************
+	void SetCamera(const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& projection) override;
+
+	//**************************************************
+	/// \brief Same as SetWorldMatrix and SetMaterialColor
+	///
+	/// \return none
+	//**************************************************
+	void SetObjectConstants(const DirectX::XMFLOAT4X4& world, const DirectX::XMFLOAT4& color) override;
+
+	void SetVertexBuffer(const structure::Vertex3D* vertices, unsigned int vertexNum) override;
+	void SetIndexBuffer(const unsigned int* indices, unsigned int indexNum) override;
+	void SetIndexBuffer(const unsigned short* indices, unsigned int indexNum) override;
+	void SetWorldMatrix(const DirectX::XMFLOAT4X4& world) override;
+	void SetMaterialColor(const DirectX::XMFLOAT4& color) override;
+	void DrawIndexed(unsigned int indexNum, unsigned int startIndex, int baseVertex) override;
+
+	//**************************************************
+	/// \brief Color target, B8G8R8A8 rows of Stride() pixels
+	///
+	/// \return pixel pointer
+	//**************************************************
+	const uint32_t* ColorBuffer() const { return m_color.data(); }
+
+	//**************************************************
+	/// \brief Depth target, rows of Stride() floats
+	///
+	/// \return depth pointer
+	//**************************************************
+	const float* DepthBuffer() const { return m_depth.data(); }
+
+	int Width()  const { return m_width; }
+	int Height() const { return m_height; }
+	int Stride() const { return m_stride; }
+
+private:
+	//**************************************************
+	/// \brief Triangle after vertex transform and edge setup
+	//**************************************************
+	struct Triangle
+	{
+		float				EdgeA[3];		// edge function E(x, y) = A * x + B * y + C
+		float				EdgeB[3];
+		float				EdgeC[3];
+		bool				TopLeft[3];		// pixel on the edge is covered
+		float				Z[3];			// depth of each vertex
+		float				InvW[3];		// 1 / w for perspective correction
+		DirectX::XMFLOAT3	Color[3];		// color / w
+		float				InvArea;
+		int					MinX, MinY, MaxX, MaxY;
+	};
+
+	//**************************************************
+	/// \brief Vertex in clip space
+	//**************************************************
+	struct ClipVertex
+	{
+		float				X, Y, Z, W;
+		DirectX::XMFLOAT3	Color;
+	};
+
+	//**************************************************
+	/// \brief Clip triangle against the near plane, then setup the pieces
+	///
+	/// \return none
+	//**************************************************
+	void BinTriangle(
+		const ClipVertex& v0,
+		const ClipVertex& v1,
+		const ClipVertex& v2
+	);
+
+	//**************************************************
+	/// \brief Setup triangle in front of the near plane and put into the tiles it overlaps
+	///
+	/// \return none
+	//**************************************************
+	void SetupTriangle(
+		const ClipVertex& v0,
+		const ClipVertex& v1,
+		const ClipVertex& v2
+	);
+
+	//**************************************************
+	/// \brief Primitive assembly of 16 or 32 bit indices
+	///
+	/// \return none
+	//**************************************************
+	template<typename INDEX>
+	void AssembleTriangles(
+		const INDEX* indices,
+		const unsigned int indexNum,
+		const int baseVertex
+	);
+
+	//**************************************************
+	/// \brief Rasterize all triangles of one tile
+	///
+	/// \param[in] tileIndex	 ->	index of tile
+	///
+	/// \return none
+	//**************************************************
+	void RasterizeTile(const size_t tileIndex);
+
+	//**************************************************
+	/// \brief Copy color target to the window
+	///
+	/// \return none
+	//**************************************************
+	void Blit();
+
+	static const int					k_tileSize = 64;		// tile width and height in pixels
+	static const size_t					k_binReserve = 1024;	// triangles per tile reserved at Init
+
+	int									m_width;
+	int									m_height;
+	int									m_stride;				// row pitch in pixels (multiple of 4)
+	int									m_tileCountX;
+	int									m_tileCountY;
+	void*								m_windowHandle;
+	std::vector<uint32_t>				m_color;				// color target
+	std::vector<float>					m_depth;				// depth target
+	std::vector<Triangle>				m_triangles;			// triangles of current frame
+	std::vector<std::vector<uint32_t>>	m_bins;					// triangle indices per tile in submission order
+	std::vector<ClipVertex>				m_transformed;			// vertex shader output of current draw
+	const structure::Vertex3D*			m_vertices;
+	unsigned int						m_vertexNum;
+	const void*							m_indices;
+	unsigned int						m_indexNum;
+	bool								m_indices16;			// bound index buffer is 16 bit
+	DirectX::XMFLOAT4X4					m_world;
+	DirectX::XMFLOAT4X4					m_viewProjection;
+	DirectX::XMFLOAT4					m_materialColor;		// multiplied to the pixel color
+	ThreadPool							m_threadPool;
+};
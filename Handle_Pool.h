@@ -0,0 +1,223 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Handle_Pool.h
+*		Detail	: 32 bit generational handles into dense structure of arrays pools
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace structure
+{
+	//**************************************************
+	/// \brief Generation in the high bits, slot in the low bits, 0 is invalid
+	///        TAG only separates handle types, it is never instantiated
+	//**************************************************
+	template<class TAG>
+	struct Handle
+	{
+		uint32_t	Value = 0;
+
+		bool IsValid() const							{ return Value != 0; }
+		bool operator==(const Handle& other) const		{ return Value == other.Value; }
+		bool operator!=(const Handle& other) const		{ return Value != other.Value; }
+	};
+}
+
+//**************************************************
+/// \brief Slots map handles to dense columns, destroy moves the last element into the hole
+///        Create, Destroy, IsValid and Get are O(1), columns are contiguous for bulk work
+///        Do not use bool columns (std::vector<bool> has no element pointers)
+///
+///        The generation has 12 bits and skips 0, so it wraps after 4095 reuses of a slot.
+///        A handle kept across that many Destroy / Create pairs of its slot validates
+///        again and refers to the new element. Holders of long lived handles must drop
+///        them when the element is destroyed, the generation only catches recent misuse
+//**************************************************
+template<class TAG, class... COLUMNS>
+class HandlePool
+{
+public:
+	using Handle = structure::Handle<TAG>;
+
+	template<size_t I>
+	using Column = typename std::tuple_element<I, std::tuple<COLUMNS...>>::type;
+
+	static const uint32_t	k_indexBits			= 20;							// up to about one million live slots
+	static const uint32_t	k_generationMask	= (1u << (32 - k_indexBits)) - 1;	// 4095 generations per slot
+	static const uint32_t	k_indexMask			= (1u << k_indexBits) - 1;
+	static const uint32_t	k_invalid			= UINT32_MAX;
+
+public:
+	HandlePool()
+		:m_freeHead(k_invalid)
+	{
+	}
+
+	//**************************************************
+	/// \brief Add an element
+	///
+	/// \param[in] values	 ->	one value per column
+	///
+	/// \return handle, invalid when every slot is used
+	//**************************************************
+	Handle Create(const COLUMNS&... values)
+	{
+		uint32_t slot = m_freeHead;
+		if (slot != k_invalid)
+		{
+			m_freeHead = m_dense[slot];
+		}
+		else
+		{
+			if (m_generations.size() > k_indexMask)
+				return Handle{};
+
+			slot = uint32_t(m_generations.size());
+			m_generations.push_back(1);
+			m_dense.push_back(0);
+		}
+
+		m_dense[slot] = uint32_t(m_slots.size());
+		m_slots.push_back(slot);
+		this->PushColumns(std::index_sequence_for<COLUMNS...>(), values...);
+
+		return Handle{ (m_generations[slot] << k_indexBits) | slot };
+	}
+
+	//**************************************************
+	/// \brief Remove an element, every handle to it becomes invalid
+	///
+	/// \return if the handle was valid then true
+	//**************************************************
+	bool Destroy(const Handle handle)
+	{
+		if (!this->IsValid(handle))
+			return false;
+
+		const uint32_t slot = handle.Value & k_indexMask;
+		const uint32_t dense = m_dense[slot];
+		const uint32_t last = uint32_t(m_slots.size() - 1);
+		if (dense != last)
+		{
+			this->MoveColumns(std::index_sequence_for<COLUMNS...>(), dense, last);
+			m_slots[dense] = m_slots[last];
+			m_dense[m_slots[dense]] = dense;
+		}
+		this->PopColumns(std::index_sequence_for<COLUMNS...>());
+		m_slots.pop_back();
+
+		// Generation 0 is never handed out, so the zero handle stays invalid
+		uint32_t generation = (m_generations[slot] + 1) & k_generationMask;
+		m_generations[slot] = generation ? generation : 1;
+		m_dense[slot] = m_freeHead;
+		m_freeHead = slot;
+		return true;
+	}
+
+	//**************************************************
+	/// \brief Handle refers to a live element
+	///
+	/// \return if valid then true
+	//**************************************************
+	bool IsValid(const Handle handle) const
+	{
+		const uint32_t slot = handle.Value & k_indexMask;
+		return handle.Value != 0 && slot < m_generations.size() && m_generations[slot] == (handle.Value >> k_indexBits) && m_dense[slot] < m_slots.size() && m_slots[m_dense[slot]] == slot;
+	}
+
+	//**************************************************
+	/// \brief Element of column I
+	///
+	/// \return pointer valid until the next Create or Destroy, nullptr for invalid handles
+	//**************************************************
+	template<size_t I>
+	Column<I>* Get(const Handle handle)
+	{
+		return this->IsValid(handle) ? &std::get<I>(m_columns)[m_dense[handle.Value & k_indexMask]] : nullptr;
+	}
+	template<size_t I>
+	const Column<I>* Get(const Handle handle) const
+	{
+		return this->IsValid(handle) ? &std::get<I>(m_columns)[m_dense[handle.Value & k_indexMask]] : nullptr;
+	}
+
+	//**************************************************
+	/// \brief Dense column for bulk iteration, Size() elements in no particular order
+	///
+	/// \return first element
+	//**************************************************
+	template<size_t I>
+	Column<I>* Data()					{ return std::get<I>(m_columns).data(); }
+	template<size_t I>
+	const Column<I>* Data() const		{ return std::get<I>(m_columns).data(); }
+
+	//**************************************************
+	/// \brief Handle of the element at a dense index
+	///
+	/// \return handle
+	//**************************************************
+	Handle HandleAt(const size_t dense) const
+	{
+		const uint32_t slot = m_slots[dense];
+		return Handle{ (m_generations[slot] << k_indexBits) | slot };
+	}
+
+	//**************************************************
+	/// \brief Destroy every element, handles of older elements stay invalid
+	///
+	/// \return none
+	//**************************************************
+	void Clear()
+	{
+		while (!m_slots.empty())
+			this->Destroy(this->HandleAt(m_slots.size() - 1));
+	}
+
+	void	Reserve(const size_t count)
+	{
+		m_slots.reserve(count);
+		this->ReserveColumns(std::index_sequence_for<COLUMNS...>(), count);
+	}
+	size_t	Size() const		{ return m_slots.size(); }
+	bool	Empty() const		{ return m_slots.empty(); }
+
+private:
+	template<size_t... I>
+	void PushColumns(std::index_sequence<I...>, const COLUMNS&... values)
+	{
+		int expand[]{ 0, (std::get<I>(m_columns).push_back(values), 0)... };
+		(void)expand;
+	}
+
+	template<size_t... I>
+	void MoveColumns(std::index_sequence<I...>, const uint32_t to, const uint32_t from)
+	{
+		int expand[]{ 0, (std::get<I>(m_columns)[to] = std::move(std::get<I>(m_columns)[from]), 0)... };
+		(void)expand;
+	}
+
+	template<size_t... I>
+	void PopColumns(std::index_sequence<I...>)
+	{
+		int expand[]{ 0, (std::get<I>(m_columns).pop_back(), 0)... };
+		(void)expand;
+	}
+
+	template<size_t... I>
+	void ReserveColumns(std::index_sequence<I...>, const size_t count)
+	{
+		int expand[]{ 0, (std::get<I>(m_columns).reserve(count), 0)... };
+		(void)expand;
+	}
+
+	std::vector<uint32_t>					m_generations;	// per slot
+	std::vector<uint32_t>					m_dense;		// per slot, dense index or next free slot
+	std::vector<uint32_t>					m_slots;		// per dense element
+	std::tuple<std::vector<COLUMNS>...>		m_columns;
+	uint32_t								m_freeHead;
+};
@@ -0,0 +1,183 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Memory_FrameArena.cpp
+*		Detail	: Per thread bump allocation for transient data of a frame
+===================================================================================*/
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+#include "Memory_FrameArena.h"
+
+namespace
+{
+	const size_t	k_sharedBlockBytes	= 256 * 1024;	// Shared arena, per thread and frame
+	const uint32_t	k_sharedFrameNum	= 3;			// written, read by the render thread, in flight
+
+	// Slots are process wide so a thread has the same index in every arena
+	std::atomic<uint32_t>	s_threadNum{ 0 };
+	thread_local uint32_t	t_slot = UINT32_MAX;
+
+	//**************************************************
+	/// \brief Slot of calling thread, claimed on first allocation
+	//**************************************************
+	inline uint32_t GetThreadSlot()
+	{
+		if (t_slot == UINT32_MAX)
+			t_slot = (std::min)(s_threadNum.fetch_add(1, std::memory_order_relaxed), FrameArena::k_threadCapacity - 1);
+
+		return t_slot;
+	}
+
+	//**************************************************
+	/// \brief Round address up to a power of two
+	//**************************************************
+	inline uintptr_t AlignUp(const uintptr_t value, const size_t alignment)
+	{
+		return (value + (alignment - 1)) & ~uintptr_t(alignment - 1);
+	}
+}
+
+const uint32_t FrameArena::k_threadCapacity;
+const uint32_t FrameArena::k_frameCapacity;
+
+/* Constructor */
+FrameArena::FrameArena(const size_t blockBytes, const uint32_t frameNum)
+	:m_blocks(),
+	m_blockBytes((std::max)(blockBytes, size_t(64))),
+	m_frameNum((std::min)((std::max)(frameNum, 1u), k_frameCapacity)),
+	m_frame(0),
+	m_lastBytes(0),
+	m_peakBytes(0)
+{
+	m_blocks.resize(size_t(m_frameNum) * k_threadCapacity, Block{});
+}
+
+/* Destructor */
+FrameArena::~FrameArena()
+{
+	for (Block& block : m_blocks)
+	{
+		while (block.Overflows)
+		{
+			Overflow* next = block.Overflows->Next;
+			::operator delete(block.Overflows);
+			block.Overflows = next;
+		}
+		::operator delete(block.Memory);
+	}
+}
+
+/* Allocate */
+void* FrameArena::Allocate(const size_t bytes, const size_t alignment)
+{
+	const uint32_t slot = GetThreadSlot();
+	Block& block = m_blocks[size_t(m_frame) * k_threadCapacity + slot];
+
+	// Threads past the capacity share one block
+	std::unique_lock<std::mutex> lock(m_sharedMutex, std::defer_lock);
+	if (slot == k_threadCapacity - 1)
+		lock.lock();
+
+	if (!block.Memory)
+	{
+		block.Memory	= static_cast<uint8_t*>(::operator new(m_blockBytes));
+		block.Capacity	= m_blockBytes;
+	}
+
+	const uintptr_t base	= reinterpret_cast<uintptr_t>(block.Memory);
+	const uintptr_t aligned	= AlignUp(base + block.Offset, alignment);
+	const size_t end		= size_t(aligned - base) + bytes;
+	if (end > block.Capacity)
+	{
+		block.Requested += bytes + alignment;
+		return FrameArena::AllocateOverflow(block, bytes, alignment);
+	}
+
+	block.Requested	+= end - block.Offset;
+	block.Offset	= end;
+	return reinterpret_cast<void*>(aligned);
+}
+
+/* Next frame */
+void FrameArena::NextFrame()
+{
+	uint64_t bytes = 0;
+	for (uint32_t t = 0; t < k_threadCapacity; ++t)
+		bytes += m_blocks[size_t(m_frame) * k_threadCapacity + t].Requested;
+
+	m_lastBytes	= bytes;
+	m_peakBytes	= (std::max)(m_peakBytes, bytes);
+
+	// The oldest frame is no longer read by anyone
+	m_frame = (m_frame + 1) % m_frameNum;
+	for (uint32_t t = 0; t < k_threadCapacity; ++t)
+		this->Rewind(m_blocks[size_t(m_frame) * k_threadCapacity + t]);
+}
+
+/* Get statistics */
+FrameArena::Statistics FrameArena::GetStatistics() const
+{
+	Statistics statistics{};
+	statistics.Bytes		= m_lastBytes;
+	statistics.PeakBytes	= m_peakBytes;
+	for (const Block& block : m_blocks)
+	{
+		statistics.Capacity			+= block.Capacity;
+		statistics.Overflows		+= block.OverflowNum;
+		statistics.OverflowBytes	+= block.OverflowBytes;
+		statistics.Grows			+= block.GrowNum;
+	}
+	return statistics;
+}
+
+/* Shared arena */
+FrameArena& FrameArena::Shared()
+{
+	static FrameArena arena(k_sharedBlockBytes, k_sharedFrameNum);
+	return arena;
+}
+
+// Allocate overflow
+void* FrameArena::AllocateOverflow(Block& block, const size_t bytes, const size_t alignment)
+{
+	// Header first, the allocation after it at the requested alignment
+	const size_t header = AlignUp(sizeof(Overflow), alignment);
+	Overflow* overflow	= static_cast<Overflow*>(::operator new(header + bytes + alignment));
+	overflow->Next		= block.Overflows;
+	block.Overflows		= overflow;
+
+	++block.OverflowNum;
+	block.OverflowBytes += bytes;
+
+	const uintptr_t memory = reinterpret_cast<uintptr_t>(overflow) + sizeof(Overflow);
+	return reinterpret_cast<void*>(AlignUp(memory, alignment));
+}
+
+// Rewind
+void FrameArena::Rewind(Block& block)
+{
+	while (block.Overflows)
+	{
+		Overflow* next = block.Overflows->Next;
+		::operator delete(block.Overflows);
+		block.Overflows = next;
+	}
+
+	// The same frame again fits without the heap
+	if (block.Requested > block.Capacity)
+	{
+		size_t capacity = block.Capacity;
+		while (capacity < block.Requested)
+			capacity *= 2;
+
+		::operator delete(block.Memory);
+		block.Memory	= static_cast<uint8_t*>(::operator new(capacity));
+		block.Capacity	= capacity;
+		++block.GrowNum;
+	}
+
+	block.Offset	= 0;
+	block.Requested	= 0;
+}
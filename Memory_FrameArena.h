@@ -0,0 +1,180 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Memory_FrameArena.h
+*		Detail	: Per thread bump allocation for transient data of a frame
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+//**************************************************
+/// \brief Every thread bumps a pointer in its own block, NextFrame rewinds the blocks
+///        Memory stays valid for frameNum - 1 further frames, so the render thread
+///        can read what the update thread wrote last frame. A block that overflowed
+///        grows when its frame comes around again, steady state frames never allocate
+//**************************************************
+class FrameArena
+{
+public:
+	static const uint32_t k_threadCapacity	= 64;	// threads beyond this share the last slot under a lock
+	static const uint32_t k_frameCapacity	= 4;
+
+	//**************************************************
+	/// \brief Usage over all threads
+	//**************************************************
+	struct Statistics
+	{
+		uint64_t	Bytes;			// requested in last completed frame
+		uint64_t	PeakBytes;		// largest frame since start
+		uint64_t	Capacity;		// bytes of the blocks of every frame
+		uint64_t	Overflows;		// allocations served by the heap since start
+		uint64_t	OverflowBytes;
+		uint64_t	Grows;			// blocks replaced by larger ones since start
+	};
+
+public:
+	//**************************************************
+	/// \brief Constructor, blocks are allocated on the first use of each thread
+	///
+	/// \param[in] blockBytes	 ->	initial block size per thread and frame
+	/// \param[in] frameNum		 ->	frames in flight (1 to k_frameCapacity)
+	///
+	/// \return none
+	//**************************************************
+	FrameArena(
+		const size_t blockBytes,
+		const uint32_t frameNum
+	);
+
+	//**************************************************
+	/// \brief Destructor, release blocks and overflow memory
+	///
+	/// \return none
+	//**************************************************
+	~FrameArena();
+
+	FrameArena(const FrameArena&)				= delete;
+	FrameArena& operator=(const FrameArena&)	= delete;
+
+	//**************************************************
+	/// \brief Allocate from the block of the calling thread, never freed individually
+	///
+	/// \param[in] bytes		 ->	size
+	/// \param[in] alignment	 ->	power of two
+	///
+	/// \return memory valid until frameNum NextFrame calls later
+	//**************************************************
+	void* Allocate(
+		const size_t bytes,
+		const size_t alignment
+	);
+
+	template<class T>
+	T* Allocate(const size_t count)	{ return static_cast<T*>(this->Allocate(count * sizeof(T), alignof(T))); }
+
+	//**************************************************
+	/// \brief Close the frame and rewind the blocks of the oldest one
+	///        No thread may allocate during the call
+	///
+	/// \return none
+	//**************************************************
+	void NextFrame();
+
+	//**************************************************
+	/// \brief Usage, call between frames
+	///
+	/// \return statistics
+	//**************************************************
+	Statistics GetStatistics() const;
+
+	uint32_t FrameNum() const	{ return m_frameNum; }
+
+	//**************************************************
+	/// \brief Process wide arena, advanced by Application::Draw
+	///
+	/// \return frame arena
+	//**************************************************
+	static FrameArena& Shared();
+
+private:
+	//**************************************************
+	/// \brief Heap memory of an allocation that did not fit, freed on rewind
+	//**************************************************
+	struct Overflow
+	{
+		Overflow*	Next;
+	};
+
+	//**************************************************
+	/// \brief Bump block of one thread in one frame, only the owner writes it
+	//**************************************************
+	struct alignas(64) Block
+	{
+		uint8_t*	Memory;
+		size_t		Capacity;
+		size_t		Offset;
+		size_t		Requested;		// bytes asked for this frame, overflow included
+		Overflow*	Overflows;
+		uint64_t	OverflowNum;	// since start
+		uint64_t	OverflowBytes;
+		uint64_t	GrowNum;
+	};
+
+	//**************************************************
+	/// \brief Serve an allocation from the heap and remember it
+	///
+	/// \return memory
+	//**************************************************
+	static void* AllocateOverflow(
+		Block& block,
+		const size_t bytes,
+		const size_t alignment
+	);
+
+	//**************************************************
+	/// \brief Free overflow memory and grow the block to what the frame needed
+	///
+	/// \return none
+	//**************************************************
+	void Rewind(Block& block);
+
+	std::vector<Block>	m_blocks;		// frame major, k_threadCapacity per frame
+	size_t				m_blockBytes;
+	uint32_t			m_frameNum;
+	uint32_t			m_frame;		// frame being written
+	uint64_t			m_lastBytes;
+	uint64_t			m_peakBytes;
+	std::mutex			m_sharedMutex;	// guards the last slot
+};
+
+//**************************************************
+/// \brief Standard allocator adapter, deallocate does nothing
+///        Growing containers leave their old storage in the arena, reserve when the size is known
+//**************************************************
+template<class T>
+class FrameAllocator
+{
+public:
+	using value_type = T;
+
+	FrameAllocator()											: m_arena(&FrameArena::Shared()) {}
+	explicit FrameAllocator(FrameArena& arena)					: m_arena(&arena) {}
+	template<class U> FrameAllocator(const FrameAllocator<U>& other)	: m_arena(other.Arena()) {}
+
+	T*		allocate(const size_t count)		{ return m_arena->Allocate<T>(count); }
+	void	deallocate(T*, const size_t)		{}
+
+	FrameArena*	Arena() const	{ return m_arena; }
+
+	template<class U> bool operator==(const FrameAllocator<U>& other) const	{ return m_arena == other.Arena(); }
+	template<class U> bool operator!=(const FrameAllocator<U>& other) const	{ return m_arena != other.Arena(); }
+
+private:
+	FrameArena*	m_arena;
+};
+
+template<class T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
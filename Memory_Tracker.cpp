@@ -0,0 +1,359 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Memory_Tracker.cpp
+*		Detail	: Heap allocation counting per frame, tag and thread
+===================================================================================*/
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#include <Windows.h>
+#endif
+
+#include "Memory_Tracker.h"
+
+namespace
+{
+	//**************************************************
+	/// \brief Counters of one thread, only the owner increments them
+	//**************************************************
+	struct ThreadSlot
+	{
+		std::atomic<uint64_t>	Count[MemoryTracker::k_tagCapacity];
+		std::atomic<uint64_t>	Bytes[MemoryTracker::k_tagCapacity];
+		MemoryTracker::Counter	Base[MemoryTracker::k_tagCapacity];		// totals at last NextFrame
+		MemoryTracker::Counter	Frame[MemoryTracker::k_tagCapacity];	// last completed frame
+	};
+
+	// Everything is static storage, the hook must never allocate
+	ThreadSlot						s_threads[MemoryTracker::k_threadCapacity];
+	std::atomic<uint32_t>			s_threadNum{ 0 };
+	std::atomic<const char*>		s_tagNames[MemoryTracker::k_tagCapacity];
+	std::atomic<uint32_t>			s_tagNum{ 1 };
+	std::atomic<bool>				s_strict{ false };
+	std::atomic<uint64_t>			s_violations{ 0 };
+	std::atomic<const char*>		s_firstViolationTag{ nullptr };
+	uint64_t						s_frameViolationBase = 0;
+	std::mutex						s_mutex;	// guards registration and Base / Frame
+
+	thread_local uint32_t			t_slot	= UINT32_MAX;
+	thread_local uint32_t			t_tag	= 0;
+
+	//**************************************************
+	/// \brief Slot of calling thread, claimed on first allocation
+	//**************************************************
+	inline ThreadSlot& GetThreadSlot()
+	{
+		if (t_slot == UINT32_MAX)
+			t_slot = (std::min)(s_threadNum.fetch_add(1, std::memory_order_relaxed), MemoryTracker::k_threadCapacity - 1);
+
+		return s_threads[t_slot];
+	}
+
+	//**************************************************
+	/// \brief Debugger output, stderr without debugger api
+	//**************************************************
+	void Print(const char* text)
+	{
+#if defined(_WIN32)
+		OutputDebugStringA(text);
+#else
+		std::fputs(text, stderr);
+#endif
+	}
+
+#if defined(__cpp_aligned_new)
+	//**************************************************
+	/// \brief Heap block of over aligned types, released by FreeAligned only
+	//**************************************************
+	void* AllocateAligned(const size_t size, const std::align_val_t alignment)
+	{
+#if defined(_WIN32)
+		return _aligned_malloc(size ? size : 1, size_t(alignment));
+#else
+		void* memory = nullptr;
+		return posix_memalign(&memory, (std::max)(size_t(alignment), sizeof(void*)), size ? size : 1) == 0 ? memory : nullptr;
+#endif
+	}
+
+	void FreeAligned(void* memory)
+	{
+#if defined(_WIN32)
+		_aligned_free(memory);
+#else
+		std::free(memory);
+#endif
+	}
+#endif
+}
+
+const uint32_t MemoryTracker::k_tagCapacity;
+const uint32_t MemoryTracker::k_threadCapacity;
+
+//**************************************************
+/// \brief Global allocation hooks, count every heap allocation of the process
+//**************************************************
+void* operator new(size_t size)
+{
+	MemoryTracker::OnAllocate(size);
+
+	void* memory = std::malloc(size ? size : 1);
+	if (!memory)
+		throw std::bad_alloc();
+	return memory;
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	MemoryTracker::OnAllocate(size);
+	return std::malloc(size ? size : 1);
+}
+void* operator new[](size_t size)									{ return ::operator new(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept	{ return ::operator new(size, std::nothrow); }
+void operator delete(void* memory) noexcept							{ std::free(memory); }
+void operator delete[](void* memory) noexcept						{ std::free(memory); }
+void operator delete(void* memory, size_t) noexcept					{ std::free(memory); }
+void operator delete[](void* memory, size_t) noexcept				{ std::free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept	{ std::free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+
+#if defined(__cpp_aligned_new)
+// Over aligned types (alignas above the default new alignment) come here from C++17 on
+void* operator new(size_t size, std::align_val_t alignment)
+{
+	MemoryTracker::OnAllocate(size);
+
+	void* memory = AllocateAligned(size, alignment);
+	if (!memory)
+		throw std::bad_alloc();
+	return memory;
+}
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	MemoryTracker::OnAllocate(size);
+	return AllocateAligned(size, alignment);
+}
+void* operator new[](size_t size, std::align_val_t alignment)										{ return ::operator new(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept		{ return ::operator new(size, alignment, std::nothrow); }
+void operator delete(void* memory, std::align_val_t) noexcept										{ FreeAligned(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept									{ FreeAligned(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept								{ FreeAligned(memory); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept							{ FreeAligned(memory); }
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept				{ FreeAligned(memory); }
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept			{ FreeAligned(memory); }
+#endif
+
+/* On allocate */
+void MemoryTracker::OnAllocate(const size_t size)
+{
+	ThreadSlot& slot = GetThreadSlot();
+	const uint32_t tag = t_tag;
+	slot.Count[tag].fetch_add(1, std::memory_order_relaxed);
+	slot.Bytes[tag].fetch_add(size, std::memory_order_relaxed);
+
+	if (s_strict.load(std::memory_order_relaxed))
+	{
+		s_violations.fetch_add(1, std::memory_order_relaxed);
+
+		const char* expected = nullptr;
+		const char* name = tag ? s_tagNames[tag].load(std::memory_order_relaxed) : "Untagged";
+		s_firstViolationTag.compare_exchange_strong(expected, name, std::memory_order_relaxed);
+	}
+}
+
+/* Register tag */
+uint32_t MemoryTracker::RegisterTag(const char* name)
+{
+	std::lock_guard<std::mutex> lock(s_mutex);
+
+	const uint32_t tagNum = s_tagNum.load(std::memory_order_relaxed);
+	for (uint32_t i = 1; i < tagNum; ++i)
+	{
+		if (std::strcmp(s_tagNames[i].load(std::memory_order_relaxed), name) == 0)
+			return i;
+	}
+
+	if (tagNum >= k_tagCapacity)
+		return 0;	// counted as untagged
+
+	s_tagNames[tagNum].store(name, std::memory_order_relaxed);
+	s_tagNum.store(tagNum + 1, std::memory_order_release);
+	return tagNum;
+}
+
+/* Set tag */
+uint32_t MemoryTracker::SetTag(const uint32_t tag)
+{
+	uint32_t previous = t_tag;
+	t_tag = tag;
+	return previous;
+}
+
+/* Next frame */
+bool MemoryTracker::NextFrame()
+{
+	std::lock_guard<std::mutex> lock(s_mutex);
+
+	const uint32_t threadNum	= (std::min)(s_threadNum.load(std::memory_order_relaxed), k_threadCapacity);
+	const uint32_t tagNum		= s_tagNum.load(std::memory_order_acquire);
+	for (uint32_t t = 0; t < threadNum; ++t)
+	{
+		ThreadSlot& slot = s_threads[t];
+		for (uint32_t i = 0; i < tagNum; ++i)
+		{
+			Counter total{ slot.Count[i].load(std::memory_order_relaxed), slot.Bytes[i].load(std::memory_order_relaxed) };
+			slot.Frame[i].Count	= total.Count - slot.Base[i].Count;
+			slot.Frame[i].Bytes	= total.Bytes - slot.Base[i].Bytes;
+			slot.Base[i]		= total;
+		}
+	}
+
+	const uint64_t violations = s_violations.load(std::memory_order_relaxed);
+	const bool clean = (violations == s_frameViolationBase);
+	s_frameViolationBase = violations;
+	return clean;
+}
+
+/* Set strict */
+void MemoryTracker::SetStrict(const bool enable)
+{
+	s_strict.store(enable, std::memory_order_relaxed);
+}
+
+/* Violations */
+uint64_t MemoryTracker::Violations()
+{
+	return s_violations.load(std::memory_order_relaxed);
+}
+
+/* First violation tag */
+const char* MemoryTracker::FirstViolationTag()
+{
+	return s_firstViolationTag.load(std::memory_order_relaxed);
+}
+
+/* Last frame */
+MemoryTracker::Counter MemoryTracker::LastFrame()
+{
+	std::lock_guard<std::mutex> lock(s_mutex);
+
+	Counter counter{};
+	const uint32_t threadNum	= (std::min)(s_threadNum.load(std::memory_order_relaxed), k_threadCapacity);
+	const uint32_t tagNum		= s_tagNum.load(std::memory_order_acquire);
+	for (uint32_t t = 0; t < threadNum; ++t)
+	{
+		for (uint32_t i = 0; i < tagNum; ++i)
+		{
+			counter.Count += s_threads[t].Frame[i].Count;
+			counter.Bytes += s_threads[t].Frame[i].Bytes;
+		}
+	}
+	return counter;
+}
+
+/* Total */
+MemoryTracker::Counter MemoryTracker::Total()
+{
+	Counter counter{};
+	const uint32_t threadNum = (std::min)(s_threadNum.load(std::memory_order_relaxed), k_threadCapacity);
+	for (uint32_t t = 0; t < threadNum; ++t)
+	{
+		for (uint32_t i = 0; i < k_tagCapacity; ++i)
+		{
+			counter.Count += s_threads[t].Count[i].load(std::memory_order_relaxed);
+			counter.Bytes += s_threads[t].Bytes[i].load(std::memory_order_relaxed);
+		}
+	}
+	return counter;
+}
+
+/* Get tag statistics */
+size_t MemoryTracker::GetTagStatistics(Statistics* statistics, const size_t capacity)
+{
+	std::lock_guard<std::mutex> lock(s_mutex);
+
+	const uint32_t threadNum	= (std::min)(s_threadNum.load(std::memory_order_relaxed), k_threadCapacity);
+	const uint32_t tagNum		= s_tagNum.load(std::memory_order_acquire);
+	for (uint32_t i = 0; i < tagNum && i < capacity; ++i)
+	{
+		Statistics& entry	= statistics[i];
+		entry				= Statistics{};
+		entry.Name			= i ? s_tagNames[i].load(std::memory_order_relaxed) : "Untagged";
+		entry.Index			= i;
+		for (uint32_t t = 0; t < threadNum; ++t)
+		{
+			entry.Frame.Count	+= s_threads[t].Frame[i].Count;
+			entry.Frame.Bytes	+= s_threads[t].Frame[i].Bytes;
+			entry.Total.Count	+= s_threads[t].Count[i].load(std::memory_order_relaxed);
+			entry.Total.Bytes	+= s_threads[t].Bytes[i].load(std::memory_order_relaxed);
+		}
+	}
+	return tagNum;
+}
+
+/* Get thread statistics */
+size_t MemoryTracker::GetThreadStatistics(Statistics* statistics, const size_t capacity)
+{
+	std::lock_guard<std::mutex> lock(s_mutex);
+
+	const uint32_t threadNum	= (std::min)(s_threadNum.load(std::memory_order_relaxed), k_threadCapacity);
+	const uint32_t tagNum		= s_tagNum.load(std::memory_order_acquire);
+	for (uint32_t t = 0; t < threadNum && t < capacity; ++t)
+	{
+		Statistics& entry	= statistics[t];
+		entry				= Statistics{};
+		entry.Index			= t;
+		for (uint32_t i = 0; i < tagNum; ++i)
+		{
+			entry.Frame.Count	+= s_threads[t].Frame[i].Count;
+			entry.Frame.Bytes	+= s_threads[t].Frame[i].Bytes;
+			entry.Total.Count	+= s_threads[t].Count[i].load(std::memory_order_relaxed);
+			entry.Total.Bytes	+= s_threads[t].Bytes[i].load(std::memory_order_relaxed);
+		}
+	}
+	return threadNum;
+}
+
+/* Report */
+void MemoryTracker::Report()
+{
+	Statistics statistics[(std::max)(k_tagCapacity, k_threadCapacity)];
+	char text[160];
+
+	size_t tagNum = (std::min)(MemoryTracker::GetTagStatistics(statistics, k_tagCapacity), size_t(k_tagCapacity));
+	for (size_t i = 0; i < tagNum; ++i)
+	{
+		if (statistics[i].Total.Count == 0)
+			continue;
+
+		std::snprintf(
+			text, sizeof(text),
+			"[MemoryTracker] tag %-20s frame %6llu allocs %10llu bytes, total %10llu allocs\n",
+			statistics[i].Name,
+			(unsigned long long)statistics[i].Frame.Count,
+			(unsigned long long)statistics[i].Frame.Bytes,
+			(unsigned long long)statistics[i].Total.Count
+		);
+		Print(text);
+	}
+
+	size_t threadNum = (std::min)(MemoryTracker::GetThreadStatistics(statistics, k_threadCapacity), size_t(k_threadCapacity));
+	for (size_t i = 0; i < threadNum; ++i)
+	{
+		std::snprintf(
+			text, sizeof(text),
+			"[MemoryTracker] thread %-17u frame %6llu allocs %10llu bytes, total %10llu allocs\n",
+			statistics[i].Index,
+			(unsigned long long)statistics[i].Frame.Count,
+			(unsigned long long)statistics[i].Frame.Bytes,
+			(unsigned long long)statistics[i].Total.Count
+		);
+		Print(text);
+	}
+}
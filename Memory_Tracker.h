@@ -0,0 +1,169 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Memory_Tracker.h
+*		Detail	: Heap allocation counting per frame, tag and thread
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#define MEMORY_CONCAT_INNER(a, b)	a##b
+#define MEMORY_CONCAT(a, b)			MEMORY_CONCAT_INNER(a, b)
+
+//**************************************************
+/// \brief Attribute heap allocations of the current scope to a subsystem
+///        name must be a string literal
+//**************************************************
+#define MEMORY_TAG(name)\
+	static const uint32_t MEMORY_CONCAT(memoryTagIndex, __LINE__) = MemoryTracker::RegisterTag(name);\
+	MemoryTag MEMORY_CONCAT(memoryTag, __LINE__)(MEMORY_CONCAT(memoryTagIndex, __LINE__))
+
+class MemoryTracker
+{
+public:
+	static const uint32_t k_tagCapacity		= 32;	// tag 0 is "Untagged"
+	static const uint32_t k_threadCapacity	= 64;	// threads beyond this share the last slot
+
+	//**************************************************
+	/// \brief Number of allocations and requested bytes
+	//**************************************************
+	struct Counter
+	{
+		uint64_t	Count;
+		uint64_t	Bytes;
+	};
+
+	//**************************************************
+	/// \brief Allocations of one tag or one thread
+	//**************************************************
+	struct Statistics
+	{
+		const char*	Name;		// tag name, nullptr for threads
+		uint32_t	Index;		// tag index or thread slot
+		Counter		Frame;		// last completed frame
+		Counter		Total;		// since start
+	};
+
+public:
+	//**************************************************
+	/// \brief Called by the global operator new
+	///
+	/// \param[in] size	 ->	requested bytes
+	///
+	/// \return none
+	//**************************************************
+	static void OnAllocate(const size_t size);
+
+	//**************************************************
+	/// \brief Register tag name, same name returns same index
+	///
+	/// \param[in] name	 ->	tag name, must be a string literal
+	///
+	/// \return tag index (0 when capacity is exceeded)
+	//**************************************************
+	static uint32_t RegisterTag(const char* name);
+
+	//**************************************************
+	/// \brief Change tag of calling thread, used by MemoryTag
+	///
+	/// \param[in] tag	 ->	new tag index
+	///
+	/// \return previous tag index
+	//**************************************************
+	static uint32_t SetTag(const uint32_t tag);
+
+	//**************************************************
+	/// \brief Close frame and compute per frame counters
+	///
+	/// \return if strict mode saw an allocation in this frame then false
+	//**************************************************
+	static bool NextFrame();
+
+	//**************************************************
+	/// \brief Every allocation while enabled is a violation
+	///        enable after warmup to enforce allocation free steady state
+	///
+	/// \param[in] enable	 ->	strict mode
+	///
+	/// \return none
+	//**************************************************
+	static void SetStrict(const bool enable);
+
+	//**************************************************
+	/// \brief Allocations made in strict mode
+	///
+	/// \return violation count
+	//**************************************************
+	static uint64_t Violations();
+
+	//**************************************************
+	/// \brief Tag of the first allocation made in strict mode
+	///
+	/// \return tag name (nullptr if none)
+	//**************************************************
+	static const char* FirstViolationTag();
+
+	//**************************************************
+	/// \brief Allocations of last completed frame over all threads
+	///
+	/// \return counter
+	//**************************************************
+	static Counter LastFrame();
+
+	//**************************************************
+	/// \brief Allocations since start over all threads
+	///
+	/// \return counter
+	//**************************************************
+	static Counter Total();
+
+	//**************************************************
+	/// \brief Copy statistics of registered tags
+	///
+	/// \param[out] statistics ->	destination array
+	/// \param[in]  capacity   ->	destination array size
+	///
+	/// \return number of tags (may exceed capacity)
+	//**************************************************
+	static size_t GetTagStatistics(
+		Statistics* statistics,
+		const size_t capacity
+	);
+
+	//**************************************************
+	/// \brief Copy statistics of threads that allocated
+	///
+	/// \param[out] statistics ->	destination array
+	/// \param[in]  capacity   ->	destination array size
+	///
+	/// \return number of threads (may exceed capacity)
+	//**************************************************
+	static size_t GetThreadStatistics(
+		Statistics* statistics,
+		const size_t capacity
+	);
+
+	//**************************************************
+	/// \brief Print last frame per tag and per thread
+	///
+	/// \return none
+	//**************************************************
+	static void Report();
+};
+
+//**************************************************
+/// \brief Set tag between construction and destruction
+//**************************************************
+class MemoryTag
+{
+public:
+	explicit MemoryTag(const uint32_t tag) : m_previous(MemoryTracker::SetTag(tag)) {}
+	~MemoryTag() { MemoryTracker::SetTag(m_previous); }
+
+	MemoryTag(const MemoryTag&)				= delete;
+	MemoryTag& operator=(const MemoryTag&)	= delete;
+
+private:
+	uint32_t	m_previous;
+};
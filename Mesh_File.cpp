@@ -0,0 +1,256 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Mesh_File.cpp
+*		Detail	: Versioned binary mesh container read through a memory mapped file
+===================================================================================*/
+#include <algorithm>
+#include <cfloat>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Mesh_File.h"
+using namespace structure;
+
+static_assert(sizeof(MeshFile::Header) == 88, "mesh file header layout changed, bump k_version");
+static_assert(sizeof(MeshFile::Submesh) == 40, "mesh file submesh layout changed, bump k_version");
+
+const uint32_t MeshFile::k_magic;
+const uint16_t MeshFile::k_version;
+const uint32_t MeshFile::k_streamAlignment;
+
+namespace
+{
+#if !defined(_WIN32)
+	//**************************************************
+	/// \brief Wide file name to the locale encoding
+	//**************************************************
+	std::string NarrowFileName(const wchar_t* fileName)
+	{
+		std::string name(std::wcslen(fileName) * MB_CUR_MAX + 1, '\0');
+		size_t length = std::wcstombs(&name[0], fileName, name.size());
+		name.resize(length == size_t(-1) ? 0 : length);
+		return name;
+	}
+#endif
+
+	//**************************************************
+	/// \brief Open file for binary writing with a wide name
+	//**************************************************
+	FILE* CreateWriteFile(const wchar_t* fileName)
+	{
+#if defined(_WIN32)
+		return _wfopen(fileName, L"wb");
+#else
+		std::string name = NarrowFileName(fileName);
+		return name.empty() ? nullptr : std::fopen(name.c_str(), "wb");
+#endif
+	}
+
+	uint64_t Align(const uint64_t offset)
+	{
+		return (offset + MeshFile::k_streamAlignment - 1) & ~uint64_t(MeshFile::k_streamAlignment - 1);
+	}
+
+	//**************************************************
+	/// \brief Stream lies inside the file and is aligned
+	//**************************************************
+	bool ValidStream(const uint64_t offset, const uint64_t bytes, const uint64_t fileSize)
+	{
+		return offset % MeshFile::k_streamAlignment == 0 && offset <= fileSize && bytes <= fileSize - offset;
+	}
+}
+
+/* Constructor */
+MeshFile::MeshFile()
+	:m_data(nullptr),
+	m_size(0)
+{
+}
+
+/* Destructor */
+MeshFile::~MeshFile()
+{
+	this->Close();
+}
+
+/* Open */
+bool MeshFile::Open(const wchar_t* fileName)
+{
+	this->Close();
+	if (!fileName)
+		return false;
+
+#if defined(_WIN32)
+	HANDLE file = CreateFileW(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size{};
+	HANDLE mapping = nullptr;
+	if (GetFileSizeEx(file, &size) && size.QuadPart >= LONGLONG(sizeof(Header)))
+		mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping)
+	{
+		m_data = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		m_size = size_t(size.QuadPart);
+		CloseHandle(mapping);	// the view keeps the mapping alive
+	}
+	CloseHandle(file);
+#else
+	int file = open(NarrowFileName(fileName).c_str(), O_RDONLY);
+	if (file < 0)
+		return false;
+
+	struct stat status{};
+	if (fstat(file, &status) == 0 && status.st_size >= off_t(sizeof(Header)))
+	{
+		void* view = mmap(nullptr, size_t(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		if (view != MAP_FAILED)
+		{
+			m_data = (const uint8_t*)view;
+			m_size = size_t(status.st_size);
+		}
+	}
+	close(file);
+#endif
+
+	if (!m_data)
+	{
+		m_size = 0;
+		return false;
+	}
+
+	// Validate everything the stream accessors rely on
+	const Header* header = this->GetHeader();
+	bool valid =
+		header->Magic == k_magic &&
+		header->Version == k_version &&
+		header->HeaderSize == sizeof(Header) &&
+		header->FileSize == m_size &&
+		header->VertexFormat == VERTEX::VERTEX3D &&
+		header->VertexStride == sizeof(Vertex3D) &&
+		(header->IndexSize == sizeof(uint16_t) || header->IndexSize == sizeof(uint32_t));
+	valid = valid &&
+		ValidStream(header->VertexOffset, uint64_t(header->VertexNum) * header->VertexStride, m_size) &&
+		ValidStream(header->IndexOffset, uint64_t(header->IndexNum) * header->IndexSize, m_size) &&
+		ValidStream(header->SubmeshOffset, uint64_t(header->SubmeshNum) * sizeof(Submesh), m_size);
+
+	for (uint32_t i = 0; valid && i < header->SubmeshNum; ++i)
+	{
+		const Submesh& submesh = this->Submeshes()[i];
+		valid = uint64_t(submesh.StartIndex) + submesh.IndexNum <= header->IndexNum;
+	}
+
+	if (!valid)
+		this->Close();
+	return valid;
+}
+
+/* Close */
+void MeshFile::Close()
+{
+	if (!m_data)
+		return;
+
+#if defined(_WIN32)
+	UnmapViewOfFile(m_data);
+#else
+	munmap((void*)m_data, m_size);
+#endif
+	m_data = nullptr;
+	m_size = 0;
+}
+
+/* Write */
+bool MeshFile::Write(const wchar_t* fileName, const MeshData& mesh, const MeshIndex::Buffer& indexBuffer)
+{
+	Header header{};
+	header.Magic			= k_magic;
+	header.Version			= k_version;
+	header.HeaderSize		= sizeof(Header);
+	header.VertexFormat		= VERTEX::VERTEX3D;
+	header.VertexStride		= sizeof(Vertex3D);
+	header.VertexNum		= uint32_t(mesh.Vertices.size());
+	header.IndexSize		= indexBuffer.IndexSize();
+	header.IndexNum			= indexBuffer.IndexNum();
+	header.SubmeshNum		= uint32_t(indexBuffer.Chunks.size());
+	header.VertexOffset		= Align(sizeof(Header));
+	header.IndexOffset		= Align(header.VertexOffset + uint64_t(header.VertexNum) * header.VertexStride);
+	header.SubmeshOffset	= Align(header.IndexOffset + uint64_t(header.IndexNum) * header.IndexSize);
+	header.FileSize			= header.SubmeshOffset + uint64_t(header.SubmeshNum) * sizeof(Submesh);
+
+	std::fill(std::begin(header.BoundsMin), std::end(header.BoundsMin), FLT_MAX);
+	std::fill(std::begin(header.BoundsMax), std::end(header.BoundsMax), -FLT_MAX);
+	for (const Vertex3D& vertex : mesh.Vertices)
+	{
+		const float position[3]{ vertex.Position.x, vertex.Position.y, vertex.Position.z };
+		for (int k = 0; k < 3; ++k)
+		{
+			header.BoundsMin[k] = (std::min)(header.BoundsMin[k], position[k]);
+			header.BoundsMax[k] = (std::max)(header.BoundsMax[k], position[k]);
+		}
+	}
+
+	std::vector<Submesh> submeshes(header.SubmeshNum);
+	for (size_t i = 0; i < submeshes.size(); ++i)
+	{
+		const MeshIndex::Chunk& chunk = indexBuffer.Chunks[i];
+		Submesh& submesh		= submeshes[i];
+		submesh.StartIndex		= chunk.StartIndex;
+		submesh.IndexNum		= chunk.IndexNum;
+		submesh.BaseVertex		= chunk.BaseVertex;
+		submesh.MaterialIndex	= 0;
+		std::fill(std::begin(submesh.BoundsMin), std::end(submesh.BoundsMin), FLT_MAX);
+		std::fill(std::begin(submesh.BoundsMax), std::end(submesh.BoundsMax), -FLT_MAX);
+		for (uint32_t j = chunk.StartIndex; j < chunk.StartIndex + chunk.IndexNum; ++j)
+		{
+			const uint32_t index = uint32_t(chunk.BaseVertex) + (indexBuffer.Is16Bit ? indexBuffer.Indices16[j] : indexBuffer.Indices32[j]);
+			if (index >= header.VertexNum)
+				return false;
+
+			const DirectX::XMFLOAT3& position = mesh.Vertices[index].Position;
+			const float value[3]{ position.x, position.y, position.z };
+			for (int k = 0; k < 3; ++k)
+			{
+				submesh.BoundsMin[k] = (std::min)(submesh.BoundsMin[k], value[k]);
+				submesh.BoundsMax[k] = (std::max)(submesh.BoundsMax[k], value[k]);
+			}
+		}
+	}
+
+	FILE* file = CreateWriteFile(fileName);
+	if (!file)
+		return false;
+
+	// Zero padding between the aligned streams
+	const uint8_t padding[k_streamAlignment]{};
+	auto write = [&](const void* data, uint64_t bytes, uint64_t nextOffset)
+	{
+		bool result = std::fwrite(data, 1, size_t(bytes), file) == size_t(bytes);
+		long position = std::ftell(file);
+		if (result && position >= 0 && uint64_t(position) < nextOffset)
+			result = std::fwrite(padding, 1, size_t(nextOffset - uint64_t(position)), file) == size_t(nextOffset - uint64_t(position));
+		return result;
+	};
+
+	bool result =
+		write(&header, sizeof(Header), header.VertexOffset) &&
+		write(mesh.Vertices.data(), uint64_t(header.VertexNum) * header.VertexStride, header.IndexOffset) &&
+		write(indexBuffer.Data(), indexBuffer.ByteSize(), header.SubmeshOffset) &&
+		write(submeshes.data(), submeshes.size() * sizeof(Submesh), header.FileSize);
+
+	result = (std::fclose(file) == 0) && result;
+	return result;
+}
@@ -0,0 +1,115 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Mesh_File.h
+*		Detail	: Versioned binary mesh container read through a memory mapped file
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "Mesh_Index.h"
+#include "Mesh_Optimizer.h"
+
+class MeshFile
+{
+public:
+	//**************************************************
+	/// \brief Vertex stream encoding
+	//**************************************************
+	enum class VERTEX : uint32_t
+	{
+		VERTEX3D,	// structure::Vertex3D
+		NUM
+	};
+
+	//**************************************************
+	/// \brief File header, offsets are from the file start
+	//**************************************************
+	struct Header
+	{
+		uint32_t	Magic;			// k_magic
+		uint16_t	Version;		// k_version
+		uint16_t	HeaderSize;		// sizeof(Header)
+		uint64_t	FileSize;
+		VERTEX		VertexFormat;
+		uint32_t	VertexStride;
+		uint32_t	VertexNum;
+		uint32_t	IndexSize;		// 2 or 4
+		uint32_t	IndexNum;
+		uint32_t	SubmeshNum;
+		uint64_t	VertexOffset;	// k_streamAlignment aligned
+		uint64_t	IndexOffset;
+		uint64_t	SubmeshOffset;
+		float		BoundsMin[3];
+		float		BoundsMax[3];
+	};
+
+	//**************************************************
+	/// \brief Draw range, one per DrawIndexed
+	//**************************************************
+	struct Submesh
+	{
+		uint32_t	StartIndex;
+		uint32_t	IndexNum;
+		int32_t		BaseVertex;
+		uint32_t	MaterialIndex;
+		float		BoundsMin[3];
+		float		BoundsMax[3];
+	};
+
+	static const uint32_t k_magic				= 0x4853454d;	// "MESH"
+	static const uint16_t k_version				= 1;
+	static const uint32_t k_streamAlignment		= 64;
+
+public:
+	MeshFile();
+	~MeshFile();
+
+	MeshFile(const MeshFile&)				= delete;
+	MeshFile& operator=(const MeshFile&)	= delete;
+
+	//**************************************************
+	/// \brief Map file and validate header and stream ranges
+	///        Streams are used in place, nothing is parsed or copied
+	///
+	/// \param[in] fileName	 ->	mesh file
+	///
+	/// \return Success is true
+	//**************************************************
+	bool Open(const wchar_t* fileName);
+
+	//**************************************************
+	/// \brief Unmap file, stream pointers become invalid
+	///
+	/// \return none
+	//**************************************************
+	void Close();
+
+	const Header*	GetHeader() const	{ return (const Header*)m_data; }
+	const void*		Vertices() const	{ return m_data + this->GetHeader()->VertexOffset; }
+	const void*		Indices() const		{ return m_data + this->GetHeader()->IndexOffset; }
+	const Submesh*	Submeshes() const	{ return (const Submesh*)(m_data + this->GetHeader()->SubmeshOffset); }
+	uint32_t		VertexBytes() const	{ return this->GetHeader()->VertexNum * this->GetHeader()->VertexStride; }
+	uint32_t		IndexBytes() const	{ return this->GetHeader()->IndexNum * this->GetHeader()->IndexSize; }
+	bool			IsOpen() const		{ return m_data != nullptr; }
+
+	//**************************************************
+	/// \brief Write mesh, one submesh per index chunk
+	///
+	/// \param[in] fileName		 ->	destination
+	/// \param[in] mesh			 ->	vertices (indices are taken from indexBuffer)
+	/// \param[in] indexBuffer	 ->	16 or 32 bit indices from MeshIndex::Build
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool Write(
+		const wchar_t* fileName,
+		const structure::MeshData& mesh,
+		const MeshIndex::Buffer& indexBuffer
+	);
+
+private:
+	const uint8_t*	m_data;		// mapped view, handles are closed once mapped
+	size_t			m_size;
+};
@@ -0,0 +1,1035 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Mesh_Importer.cpp
+*		Detail	: Parallel OBJ and glTF 2.0 (json and binary) import
+===================================================================================*/
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cwctype>
+#include <string>
+
+#include "Mesh_Importer.h"
+#include "Thread_Pool.h"
+using namespace structure;
+
+const size_t MeshImporter::k_chunkSize;
+
+namespace
+{
+	const size_t	k_vertexBlock	= 4096;		// vertices or triangles per conversion job
+	const int		k_maxJsonDepth	= 64;
+	const int		k_maxDigits		= 19;		// decimal digits that fit in uint64
+
+	const double k_pow10[]
+	{
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+	};
+
+	//**************************************************
+	/// \brief Eight ascii digits in one 64 bit word
+	//**************************************************
+	inline bool IsEightDigits(const char* text)
+	{
+		uint64_t value;
+		std::memcpy(&value, text, sizeof(value));
+		return (((value & 0xf0f0f0f0f0f0f0f0ull) | (((value + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) >> 4)) == 0x3333333333333333ull);
+	}
+
+	//**************************************************
+	/// \brief Value of eight ascii digits, pairwise combine in one register
+	//**************************************************
+	inline uint32_t ParseEightDigits(const char* text)
+	{
+		uint64_t value;
+		std::memcpy(&value, text, sizeof(value));
+		value = (value & 0x0f0f0f0f0f0f0f0full) * 2561 >> 8;
+		value = (value & 0x00ff00ff00ff00ffull) * 6553601 >> 16;
+		return uint32_t((value & 0x0000ffff0000ffffull) * 42949672960001ull >> 32);
+	}
+
+	inline bool IsDigit(const char c)	{ return c >= '0' && c <= '9'; }
+	inline bool IsSpace(const char c)	{ return c == ' ' || c == '\t' || c == '\r'; }
+
+	inline const char* SkipSpace(const char* text, const char* end)
+	{
+		while (text < end && IsSpace(*text))
+			++text;
+		return text;
+	}
+
+	inline const char* LineEnd(const char* text, const char* end)
+	{
+		const char* found = (const char*)std::memchr(text, '\n', size_t(end - text));
+		return found ? found : end;
+	}
+
+	//**************************************************
+	/// \brief Digits into mantissa, the ones beyond k_maxDigits only scale
+	//**************************************************
+	inline const char* ParseDigits(const char* text, const char* end, uint64_t* mantissa, int* digits, int* dropped)
+	{
+		while (end - text >= 8 && IsEightDigits(text))
+		{
+			if (*digits + 8 <= k_maxDigits)
+			{
+				*mantissa	= *mantissa * 100000000ull + ParseEightDigits(text);
+				*digits		+= (*mantissa != 0) ? 8 : 0;
+			}
+			else
+			{
+				break;
+			}
+			text += 8;
+		}
+		for (; text < end && IsDigit(*text); ++text)
+		{
+			if (*digits < k_maxDigits)
+			{
+				*mantissa = *mantissa * 10 + uint64_t(*text - '0');
+				*digits += (*mantissa != 0) ? 1 : 0;	// leading zeros do not use precision
+			}
+			else
+			{
+				++*dropped;
+			}
+		}
+		return text;
+	}
+
+	//**************************************************
+	/// \brief Face index, positive is 1 based and negative relative to the end
+	///        Indices outside int32 become -2 and fail validation
+	//**************************************************
+	inline const char* ParseIndex(const char* text, const char* end, const uint32_t countBefore, int32_t* index)
+	{
+		bool negative = (text < end && *text == '-');
+		if (negative || (text < end && *text == '+'))
+			++text;
+		if (text >= end || !IsDigit(*text))
+			return nullptr;
+
+		int64_t value = 0;
+		for (; text < end && IsDigit(*text); ++text)
+			value = (std::min)(value * 10 + (*text - '0'), int64_t(INT32_MAX));
+
+		const int64_t resolved = negative ? int64_t(countBefore) - value : value - 1;
+		*index = (resolved < 0 || resolved > INT32_MAX) ? -2 : int32_t(resolved);
+		return text;
+	}
+
+	//**************************************************
+	/// \brief Element counts of an obj chunk
+	//**************************************************
+	struct ObjCount
+	{
+		uint32_t	Position;
+		uint32_t	TexCoord;
+		uint32_t	Normal;
+		uint32_t	Triangle;
+	};
+
+	//**************************************************
+	/// \brief Resolved 0 based indices of a face corner, -1 is absent
+	//**************************************************
+	struct ObjCorner
+	{
+		int32_t		Position;
+		int32_t		TexCoord;
+		int32_t		Normal;
+	};
+
+	enum class OBJ_LINE
+	{
+		POSITION,
+		TEXCOORD,
+		NORMAL,
+		FACE,
+		OTHER
+	};
+
+	//**************************************************
+	/// \brief Line keyword, text is moved after it
+	//**************************************************
+	OBJ_LINE ClassifyLine(const char*& text, const char* lineEnd)
+	{
+		text = SkipSpace(text, lineEnd);
+		if (lineEnd - text < 2)
+			return OBJ_LINE::OTHER;
+
+		if (text[0] == 'f' && IsSpace(text[1]))
+		{
+			text += 2;
+			return OBJ_LINE::FACE;
+		}
+		if (text[0] != 'v')
+			return OBJ_LINE::OTHER;
+
+		if (IsSpace(text[1]))
+		{
+			text += 2;
+			return OBJ_LINE::POSITION;
+		}
+		if (lineEnd - text >= 3 && IsSpace(text[2]))
+		{
+			OBJ_LINE type = text[1] == 't' ? OBJ_LINE::TEXCOORD : (text[1] == 'n' ? OBJ_LINE::NORMAL : OBJ_LINE::OTHER);
+			text += 3;
+			return type;
+		}
+		return OBJ_LINE::OTHER;
+	}
+
+	//**************************************************
+	/// \brief Corner tokens of a face line
+	//**************************************************
+	uint32_t CountCorners(const char* text, const char* lineEnd)
+	{
+		uint32_t count = 0;
+		for (;;)
+		{
+			text = SkipSpace(text, lineEnd);
+			if (text >= lineEnd || *text == '#')
+				return count;
+
+			++count;
+			while (text < lineEnd && !IsSpace(*text))
+				++text;
+		}
+	}
+
+	//**************************************************
+	/// \brief Floats of a vertex line, missing optional values are zero
+	//**************************************************
+	bool ParseFloats(const char* text, const char* lineEnd, float* values, const int count, const int required)
+	{
+		for (int i = 0; i < count; ++i)
+		{
+			double value = 0.0;
+			const char* next = MeshImporter::ParseNumber(SkipSpace(text, lineEnd), lineEnd, &value);
+			if (!next && i < required)
+				return false;
+
+			text		= next ? next : text;
+			values[i]	= float(value);
+		}
+		return true;
+	}
+
+	//**************************************************
+	/// \brief Parsed json value, children are linked by Next
+	//**************************************************
+	struct JsonValue
+	{
+		enum class TYPE : uint8_t
+		{
+			NUL,
+			BOOLEAN,
+			NUMBER,
+			STRING,
+			ARRAY,
+			OBJECT,
+		};
+
+		TYPE		Type;
+		double		Number;		// number, or 1 / 0 for boolean
+		const char*	Text;		// string contents, escapes are kept
+		uint32_t	Length;
+		const char*	Key;		// member name inside an object
+		uint32_t	KeyLength;
+		uint32_t	First;		// first child
+		uint32_t	Next;		// next sibling
+		uint32_t	Count;		// number of children
+	};
+
+	//**************************************************
+	/// \brief Minimal json document, values are views into the source text
+	//**************************************************
+	class JsonDocument
+	{
+	public:
+		static const uint32_t k_none = UINT32_MAX;
+
+		bool Parse(const char* text, const size_t size)
+		{
+			m_values.clear();
+			m_values.reserve(size / 16 + 16);
+
+			uint32_t root = k_none;
+			const char* end = text + size;
+			text = this->ParseValue(text, end, 0, &root);
+			return text && this->SkipWhitespace(text, end) == end;
+		}
+
+		uint32_t Find(const uint32_t object, const char* key) const
+		{
+			if (object == k_none || m_values[object].Type != JsonValue::TYPE::OBJECT)
+				return k_none;
+
+			const size_t length = std::strlen(key);
+			for (uint32_t child = m_values[object].First; child != k_none; child = m_values[child].Next)
+			{
+				if (m_values[child].KeyLength == length && std::memcmp(m_values[child].Key, key, length) == 0)
+					return child;
+			}
+			return k_none;
+		}
+
+		uint32_t At(const uint32_t array, const uint32_t index) const
+		{
+			if (array == k_none || m_values[array].Type != JsonValue::TYPE::ARRAY)
+				return k_none;
+
+			uint32_t child = m_values[array].First;
+			for (uint32_t i = 0; i < index && child != k_none; ++i)
+				child = m_values[child].Next;
+			return child;
+		}
+
+		double Number(const uint32_t value, const double fallback) const
+		{
+			return (value != k_none && m_values[value].Type == JsonValue::TYPE::NUMBER) ? m_values[value].Number : fallback;
+		}
+
+		// Non negative integer, fallback when missing or out of range
+		uint64_t Unsigned(const uint32_t value, const uint64_t fallback) const
+		{
+			const double number = this->Number(value, -1.0);
+			return (number >= 0.0 && number < 9007199254740992.0 && number == std::floor(number)) ? uint64_t(number) : fallback;
+		}
+
+		bool Equals(const uint32_t value, const char* text) const
+		{
+			return value != k_none && m_values[value].Type == JsonValue::TYPE::STRING &&
+				m_values[value].Length == std::strlen(text) && std::memcmp(m_values[value].Text, text, m_values[value].Length) == 0;
+		}
+
+		const JsonValue& operator[](const uint32_t value) const { return m_values[value]; }
+
+	private:
+		const char* SkipWhitespace(const char* text, const char* end) const
+		{
+			while (text < end && (*text == ' ' || *text == '\t' || *text == '\r' || *text == '\n'))
+				++text;
+			return text;
+		}
+
+		const char* ParseString(const char* text, const char* end, const char** contents, uint32_t* length) const
+		{
+			if (text >= end || *text != '"')
+				return nullptr;
+
+			const char* start = ++text;
+			while (text < end && *text != '"')
+				text += (*text == '\\') ? 2 : 1;
+			if (text >= end)
+				return nullptr;
+
+			*contents	= start;
+			*length		= uint32_t(text - start);
+			return text + 1;
+		}
+
+		// Values are referenced by index, m_values grows while children are parsed
+		const char* ParseValue(const char* text, const char* end, const int depth, uint32_t* index)
+		{
+			text = this->SkipWhitespace(text, end);
+			if (text >= end || depth > k_maxJsonDepth)
+				return nullptr;
+
+			const uint32_t self = uint32_t(m_values.size());
+			m_values.push_back(JsonValue{ JsonValue::TYPE::NUL, 0.0, nullptr, 0, nullptr, 0, k_none, k_none, 0 });
+			*index = self;
+
+			if (*text == '{' || *text == '[')
+			{
+				const bool object	= (*text == '{');
+				const char close	= object ? '}' : ']';
+				m_values[self].Type	= object ? JsonValue::TYPE::OBJECT : JsonValue::TYPE::ARRAY;
+
+				text = this->SkipWhitespace(text + 1, end);
+				if (text < end && *text == close)
+					return text + 1;
+
+				uint32_t last = k_none;
+				for (;;)
+				{
+					const char* key		= nullptr;
+					uint32_t keyLength	= 0;
+					if (object)
+					{
+						text = this->ParseString(this->SkipWhitespace(text, end), end, &key, &keyLength);
+						if (!text)
+							return nullptr;
+						text = this->SkipWhitespace(text, end);
+						if (text >= end || *text != ':')
+							return nullptr;
+						++text;
+					}
+
+					uint32_t child = k_none;
+					text = this->ParseValue(text, end, depth + 1, &child);
+					if (!text)
+						return nullptr;
+
+					m_values[child].Key			= key;
+					m_values[child].KeyLength	= keyLength;
+					if (last == k_none)
+						m_values[self].First = child;
+					else
+						m_values[last].Next = child;
+					last = child;
+					++m_values[self].Count;
+
+					text = this->SkipWhitespace(text, end);
+					if (text < end && *text == ',')
+					{
+						++text;
+						continue;
+					}
+					if (text < end && *text == close)
+						return text + 1;
+					return nullptr;
+				}
+			}
+
+			if (*text == '"')
+			{
+				m_values[self].Type = JsonValue::TYPE::STRING;
+				return this->ParseString(text, end, &m_values[self].Text, &m_values[self].Length);
+			}
+
+			static const char* const k_literals[]{ "true", "false", "null" };
+			for (int i = 0; i < 3; ++i)
+			{
+				const size_t length = std::strlen(k_literals[i]);
+				if (size_t(end - text) >= length && std::memcmp(text, k_literals[i], length) == 0)
+				{
+					m_values[self].Type		= i < 2 ? JsonValue::TYPE::BOOLEAN : JsonValue::TYPE::NUL;
+					m_values[self].Number	= i == 0 ? 1.0 : 0.0;
+					return text + length;
+				}
+			}
+
+			m_values[self].Type = JsonValue::TYPE::NUMBER;
+			return MeshImporter::ParseNumber(text, end, &m_values[self].Number);
+		}
+
+		std::vector<JsonValue>	m_values;
+	};
+
+	const uint32_t JsonDocument::k_none;
+
+	//**************************************************
+	/// \brief Bytes of one glTF buffer
+	//**************************************************
+	struct GltfBuffer
+	{
+		const uint8_t*	Data;
+		size_t			Size;
+	};
+
+	//**************************************************
+	/// \brief Resolved accessor, elements are Stride bytes apart
+	//**************************************************
+	struct GltfAccessor
+	{
+		const uint8_t*	Data;
+		size_t			Count;
+		size_t			Stride;
+		uint32_t		ComponentType;
+		uint32_t		ComponentNum;
+		bool			Normalized;
+	};
+
+	enum GLTF_COMPONENT : uint32_t
+	{
+		GLTF_BYTE			= 5120,
+		GLTF_UNSIGNED_BYTE	= 5121,
+		GLTF_SHORT			= 5122,
+		GLTF_UNSIGNED_SHORT	= 5123,
+		GLTF_UNSIGNED_INT	= 5125,
+		GLTF_FLOAT			= 5126,
+	};
+
+	const uint32_t k_glbMagic		= 0x46546c67;	// "glTF"
+	const uint32_t k_glbJsonChunk	= 0x4e4f534a;	// "JSON"
+	const uint32_t k_glbBinaryChunk	= 0x004e4942;	// "BIN"
+	const uint32_t k_gltfTriangles	= 4;
+
+	uint32_t ComponentSize(const uint32_t componentType)
+	{
+		switch (componentType)
+		{
+		case GLTF_BYTE:
+		case GLTF_UNSIGNED_BYTE:	return 1;
+		case GLTF_SHORT:
+		case GLTF_UNSIGNED_SHORT:	return 2;
+		case GLTF_UNSIGNED_INT:
+		case GLTF_FLOAT:			return 4;
+		default:					return 0;
+		}
+	}
+
+	float ReadComponent(const uint8_t* data, const uint32_t componentType, const bool normalized)
+	{
+		switch (componentType)
+		{
+		case GLTF_FLOAT:			{ float v;		std::memcpy(&v, data, 4); return v; }
+		case GLTF_UNSIGNED_BYTE:	{ float v = float(data[0]); return normalized ? v / 255.0f : v; }
+		case GLTF_UNSIGNED_SHORT:	{ uint16_t v;	std::memcpy(&v, data, 2); return normalized ? float(v) / 65535.0f : float(v); }
+		case GLTF_BYTE:				{ float v = float(int8_t(data[0])); return normalized ? (std::max)(v / 127.0f, -1.0f) : v; }
+		case GLTF_SHORT:			{ int16_t v;	std::memcpy(&v, data, 2); return normalized ? (std::max)(float(v) / 32767.0f, -1.0f) : float(v); }
+		case GLTF_UNSIGNED_INT:		{ uint32_t v;	std::memcpy(&v, data, 4); return float(v); }
+		default:					return 0.0f;
+		}
+	}
+
+	uint32_t ReadIndex(const uint8_t* data, const uint32_t componentType)
+	{
+		switch (componentType)
+		{
+		case GLTF_UNSIGNED_BYTE:	return data[0];
+		case GLTF_UNSIGNED_SHORT:	{ uint16_t v; std::memcpy(&v, data, 2); return v; }
+		default:					{ uint32_t v; std::memcpy(&v, data, 4); return v; }
+		}
+	}
+
+	//**************************************************
+	/// \brief Accessor with range validation, sparse accessors are not supported
+	//**************************************************
+	bool ReadAccessor(const JsonDocument& json, const uint32_t indexValue, const std::vector<GltfBuffer>& buffers, GltfAccessor* accessor)
+	{
+		const uint32_t root			= 0;
+		const uint64_t index		= json.Unsigned(indexValue, UINT64_MAX);
+		const uint32_t value		= index < UINT32_MAX ? json.At(json.Find(root, "accessors"), uint32_t(index)) : JsonDocument::k_none;
+		const uint64_t viewIndex	= json.Unsigned(json.Find(value, "bufferView"), UINT64_MAX);
+		if (value == JsonDocument::k_none || viewIndex >= UINT32_MAX || json.Find(value, "sparse") != JsonDocument::k_none)
+			return false;
+
+		const uint32_t view			= json.At(json.Find(root, "bufferViews"), uint32_t(viewIndex));
+		const uint64_t bufferIndex	= json.Unsigned(json.Find(view, "buffer"), UINT64_MAX);
+		if (view == JsonDocument::k_none || bufferIndex >= buffers.size())
+			return false;
+
+		const uint32_t type = json.Find(value, "type");
+		accessor->ComponentNum	= json.Equals(type, "SCALAR") ? 1 : json.Equals(type, "VEC2") ? 2 : json.Equals(type, "VEC3") ? 3 : json.Equals(type, "VEC4") ? 4 : 0;
+		accessor->ComponentType	= uint32_t(json.Unsigned(json.Find(value, "componentType"), 0));
+		accessor->Normalized	= json.Number(json.Find(value, "normalized"), 0.0) != 0.0;
+
+		const GltfBuffer& buffer	= buffers[size_t(bufferIndex)];
+		const uint64_t elementSize	= uint64_t(ComponentSize(accessor->ComponentType)) * accessor->ComponentNum;
+		const uint64_t count		= json.Unsigned(json.Find(value, "count"), UINT64_MAX);
+		const uint64_t viewOffset	= json.Unsigned(json.Find(view, "byteOffset"), 0);
+		const uint64_t viewLength	= json.Unsigned(json.Find(view, "byteLength"), UINT64_MAX);
+		const uint64_t offset		= json.Unsigned(json.Find(value, "byteOffset"), 0);
+		const uint64_t stride		= json.Unsigned(json.Find(view, "byteStride"), elementSize);
+		if (elementSize == 0 || stride < elementSize || count > buffer.Size || viewOffset > buffer.Size || viewLength > buffer.Size - viewOffset)
+			return false;
+		if (count && (offset > viewLength || (count - 1) * stride + elementSize > viewLength - offset))
+			return false;
+
+		accessor->Data		= buffer.Data + viewOffset + offset;
+		accessor->Count		= size_t(count);
+		accessor->Stride	= size_t(stride);
+		return true;
+	}
+
+	//**************************************************
+	/// \brief Decode base64 payload of a data uri
+	//**************************************************
+	bool DecodeBase64(const char* text, const size_t length, std::vector<uint8_t>* data)
+	{
+		data->clear();
+		data->reserve(length / 4 * 3);
+
+		uint32_t bits = 0;
+		int bitNum = 0;
+		for (size_t i = 0; i < length && text[i] != '='; ++i)
+		{
+			const char c = text[i];
+			int value =
+				(c >= 'A' && c <= 'Z') ? c - 'A' :
+				(c >= 'a' && c <= 'z') ? c - 'a' + 26 :
+				(c >= '0' && c <= '9') ? c - '0' + 52 :
+				(c == '+') ? 62 : (c == '/') ? 63 : -1;
+			if (value < 0)
+				return false;
+
+			bits = (bits << 6) | uint32_t(value);
+			bitNum += 6;
+			if (bitNum >= 8)
+			{
+				bitNum -= 8;
+				data->push_back(uint8_t(bits >> bitNum));
+			}
+		}
+		return true;
+	}
+
+#if !defined(_WIN32)
+	//**************************************************
+	/// \brief Wide file name to the locale encoding
+	//**************************************************
+	std::string NarrowFileName(const wchar_t* fileName)
+	{
+		std::string name(std::wcslen(fileName) * MB_CUR_MAX + 1, '\0');
+		size_t length = std::wcstombs(&name[0], fileName, name.size());
+		name.resize(length == size_t(-1) ? 0 : length);
+		return name;
+	}
+#endif
+}
+
+/* Load */
+bool MeshImporter::Load(const wchar_t* fileName, MeshData* mesh)
+{
+	if (!fileName)
+		return false;
+
+	std::wstring extension(fileName);
+	size_t dot = extension.find_last_of(L'.');
+	extension = (dot == std::wstring::npos) ? L"" : extension.substr(dot);
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](wchar_t c) { return wchar_t(std::towlower(c)); });
+
+	std::vector<uint8_t> data;
+	if (!MeshImporter::ReadFile(fileName, &data))
+		return false;
+
+	if (extension == L".obj")
+		return MeshImporter::ParseObj((const char*)data.data(), data.size(), mesh);
+	if (extension == L".gltf" || extension == L".glb")
+		return MeshImporter::ParseGltf(data.data(), data.size(), fileName, mesh);
+	return false;
+}
+
+/* Parse obj */
+bool MeshImporter::ParseObj(const char* text, const size_t size, MeshData* mesh)
+{
+	mesh->Vertices.clear();
+	mesh->Indices.clear();
+
+	// Chunks end on line boundaries
+	std::vector<size_t> boundary{ 0 };
+	while (boundary.back() < size)
+	{
+		size_t next = (std::min)(boundary.back() + k_chunkSize, size);
+		const char* lineEnd = LineEnd(text + next, text + size);
+		boundary.push_back((std::min)(size_t(lineEnd - text) + 1, size));
+	}
+	const size_t chunkNum = boundary.size() - 1;
+
+	// Pass 1, element counts per chunk
+	std::vector<ObjCount> offset(chunkNum + 1, ObjCount{});
+	ThreadPool::Shared().ParallelFor(chunkNum, [&](size_t chunk)
+	{
+		ObjCount& count = offset[chunk + 1];
+		const char* end = text + boundary[chunk + 1];
+		for (const char* line = text + boundary[chunk]; line < end;)
+		{
+			const char* lineEnd = LineEnd(line, end);
+			switch (ClassifyLine(line, lineEnd))
+			{
+			case OBJ_LINE::POSITION:	++count.Position;	break;
+			case OBJ_LINE::TEXCOORD:	++count.TexCoord;	break;
+			case OBJ_LINE::NORMAL:		++count.Normal;		break;
+			case OBJ_LINE::FACE:
+				{
+					uint32_t corners = CountCorners(line, lineEnd);
+					count.Triangle += corners >= 3 ? corners - 2 : 0;
+				}
+				break;
+			default:
+				break;
+			}
+			line = lineEnd + 1;
+		}
+	});
+
+	// Each chunk writes its own slice of preallocated arrays
+	for (size_t chunk = 0; chunk < chunkNum; ++chunk)
+	{
+		offset[chunk + 1].Position	+= offset[chunk].Position;
+		offset[chunk + 1].TexCoord	+= offset[chunk].TexCoord;
+		offset[chunk + 1].Normal	+= offset[chunk].Normal;
+		offset[chunk + 1].Triangle	+= offset[chunk].Triangle;
+	}
+	const ObjCount total = offset[chunkNum];
+	if (total.Triangle == 0)
+		return false;
+
+	std::vector<float>		positions(size_t(total.Position) * 3);
+	std::vector<float>		texCoords(size_t(total.TexCoord) * 2);
+	std::vector<float>		normals(size_t(total.Normal) * 3);
+	std::vector<ObjCorner>	corners(size_t(total.Triangle) * 3);
+	std::atomic<bool>		failed{ false };
+
+	// Pass 2, parse into the slices
+	ThreadPool::Shared().ParallelFor(chunkNum, [&](size_t chunk)
+	{
+		ObjCount count = offset[chunk];
+		const char* end = text + boundary[chunk + 1];
+		for (const char* line = text + boundary[chunk]; line < end && !failed.load(std::memory_order_relaxed);)
+		{
+			const char* lineEnd = LineEnd(line, end);
+			bool valid = true;
+			switch (ClassifyLine(line, lineEnd))
+			{
+			case OBJ_LINE::POSITION:
+				valid = ParseFloats(line, lineEnd, &positions[size_t(count.Position++) * 3], 3, 3);
+				break;
+			case OBJ_LINE::TEXCOORD:
+				{
+					float* texCoord = &texCoords[size_t(count.TexCoord++) * 2];
+					valid = ParseFloats(line, lineEnd, texCoord, 2, 1);
+					texCoord[1] = 1.0f - texCoord[1];	// bottom left origin to top left
+				}
+				break;
+			case OBJ_LINE::NORMAL:
+				valid = ParseFloats(line, lineEnd, &normals[size_t(count.Normal++) * 3], 3, 3);
+				break;
+			case OBJ_LINE::FACE:
+				{// Fan around the first corner
+					ObjCorner first{}, previous{};
+					uint32_t cornerNum = 0;
+					for (const char* token = SkipSpace(line, lineEnd); valid && token < lineEnd && *token != '#'; token = SkipSpace(token, lineEnd))
+					{
+						ObjCorner corner{ -1, -1, -1 };
+						token = ParseIndex(token, lineEnd, count.Position, &corner.Position);
+						if (token && token < lineEnd && *token == '/')
+						{
+							++token;
+							if (token < lineEnd && *token != '/')
+								token = ParseIndex(token, lineEnd, count.TexCoord, &corner.TexCoord);
+							if (token && token < lineEnd && *token == '/')
+								token = ParseIndex(token + 1, lineEnd, count.Normal, &corner.Normal);
+						}
+						valid = token && (token == lineEnd || IsSpace(*token) || *token == '#');
+						if (!valid)
+							break;
+
+						if (cornerNum >= 2)
+						{
+							ObjCorner* triangle = &corners[size_t(count.Triangle++) * 3];
+							triangle[0] = first;
+							triangle[1] = previous;
+							triangle[2] = corner;
+						}
+						first		= cornerNum == 0 ? corner : first;
+						previous	= corner;
+						++cornerNum;
+					}
+				}
+				break;
+			default:
+				break;
+			}
+
+			if (!valid)
+				failed.store(true, std::memory_order_relaxed);
+			line = lineEnd + 1;
+		}
+	});
+	if (failed)
+		return false;
+
+	// Corner vertices, welded afterwards
+	mesh->Vertices.resize(size_t(total.Triangle) * 3);
+	ThreadPool::Shared().ParallelFor((total.Triangle + k_vertexBlock - 1) / k_vertexBlock, [&](size_t block)
+	{
+		const size_t last = (std::min)((block + 1) * k_vertexBlock, size_t(total.Triangle));
+		for (size_t t = block * k_vertexBlock; t < last; ++t)
+		{
+			Vertex3D* vertex = &mesh->Vertices[t * 3];
+			for (int k = 0; k < 3; ++k)
+			{
+				const ObjCorner& corner = corners[t * 3 + k];
+				if (corner.Position < 0 || uint32_t(corner.Position) >= total.Position ||
+					corner.TexCoord < -1 || (corner.TexCoord >= 0 && uint32_t(corner.TexCoord) >= total.TexCoord) ||
+					corner.Normal < -1 || (corner.Normal >= 0 && uint32_t(corner.Normal) >= total.Normal))
+				{
+					failed.store(true, std::memory_order_relaxed);
+					return;
+				}
+
+				const float* position	= &positions[size_t(corner.Position) * 3];
+				vertex[k].Position		= DirectX::XMFLOAT3(position[0], position[1], position[2]);
+				vertex[k].TexCoord		= corner.TexCoord < 0 ? DirectX::XMFLOAT2(0.0f, 0.0f) : DirectX::XMFLOAT2(texCoords[size_t(corner.TexCoord) * 2], texCoords[size_t(corner.TexCoord) * 2 + 1]);
+				if (corner.Normal >= 0)
+				{
+					const float* normal	= &normals[size_t(corner.Normal) * 3];
+					vertex[k].Normal	= DirectX::XMFLOAT3(normal[0], normal[1], normal[2]);
+				}
+			}
+
+			for (int k = 0; k < 3; ++k)
+			{
+				if (corners[t * 3 + k].Normal >= 0)
+					continue;
+
+				DirectX::XMVECTOR p0 = DirectX::XMLoadFloat3(&vertex[0].Position);
+				DirectX::XMVECTOR e1 = DirectX::XMVectorSubtract(DirectX::XMLoadFloat3(&vertex[1].Position), p0);
+				DirectX::XMVECTOR e2 = DirectX::XMVectorSubtract(DirectX::XMLoadFloat3(&vertex[2].Position), p0);
+				DirectX::XMStoreFloat3(&vertex[k].Normal, DirectX::XMVector3Normalize(DirectX::XMVector3Cross(e1, e2)));
+			}
+		}
+	});
+	if (failed)
+	{
+		mesh->Vertices.clear();
+		return false;
+	}
+
+	mesh->Indices.resize(mesh->Vertices.size());
+	for (size_t i = 0; i < mesh->Indices.size(); ++i)
+		mesh->Indices[i] = uint32_t(i);
+
+	MeshOptimizer::Weld(mesh);
+	return true;
+}
+
+/* Parse gltf */
+bool MeshImporter::ParseGltf(const uint8_t* data, const size_t size, const wchar_t* fileName, MeshData* mesh)
+{
+	mesh->Vertices.clear();
+	mesh->Indices.clear();
+
+	// Binary container, json chunk then optional binary chunk
+	const char* jsonText	= (const char*)data;
+	size_t jsonSize			= size;
+	GltfBuffer binary{ nullptr, 0 };
+	uint32_t header[5]{};
+	if (size >= sizeof(header))
+		std::memcpy(header, data, sizeof(header));
+	if (header[0] == k_glbMagic)
+	{
+		if (header[1] != 2 || header[2] > size || header[4] != k_glbJsonChunk || header[3] > size - sizeof(header))
+			return false;
+
+		jsonText	= (const char*)data + sizeof(header);
+		jsonSize	= header[3];
+
+		const size_t binaryOffset = sizeof(header) + jsonSize;
+		uint32_t chunk[2]{};
+		if (size_t(header[2]) >= binaryOffset + sizeof(chunk))
+		{
+			std::memcpy(chunk, data + binaryOffset, sizeof(chunk));
+			if (chunk[1] == k_glbBinaryChunk && chunk[0] <= header[2] - binaryOffset - sizeof(chunk))
+				binary = GltfBuffer{ data + binaryOffset + sizeof(chunk), chunk[0] };
+		}
+	}
+
+	JsonDocument json;
+	if (!json.Parse(jsonText, jsonSize))
+		return false;
+	const uint32_t root = 0;
+
+	// Buffers, glb binary chunk, data uri or file next to the gltf
+	std::vector<std::vector<uint8_t>> storage;
+	std::vector<GltfBuffer> buffers;
+	const uint32_t bufferArray = json.Find(root, "buffers");
+	const uint32_t bufferNum = bufferArray == JsonDocument::k_none ? 0 : json[bufferArray].Count;
+	storage.resize(bufferNum);
+	for (uint32_t i = 0; i < bufferNum; ++i)
+	{
+		const uint32_t buffer	= json.At(bufferArray, i);
+		const uint32_t uri		= json.Find(buffer, "uri");
+		const uint64_t byteLength	= json.Unsigned(json.Find(buffer, "byteLength"), 0);
+		if (uri == JsonDocument::k_none)
+		{
+			if (i != 0 || !binary.Data || binary.Size < byteLength)
+				return false;
+			buffers.push_back(binary);
+			continue;
+		}
+
+		const std::string path(json[uri].Text, json[uri].Length);
+		const size_t comma = path.find(',');
+		if (path.compare(0, 5, "data:") == 0)
+		{
+			if (comma == std::string::npos || path.rfind(";base64", comma) == std::string::npos ||
+				!DecodeBase64(path.data() + comma + 1, path.size() - comma - 1, &storage[i]))
+				return false;
+		}
+		else
+		{
+			std::wstring name(fileName ? fileName : L"");
+			size_t slash = name.find_last_of(L"/\\");
+			name = (slash == std::wstring::npos) ? std::wstring() : name.substr(0, slash + 1);
+			name.append(path.begin(), path.end());
+			if (!fileName || !MeshImporter::ReadFile(name.c_str(), &storage[i]))
+				return false;
+		}
+
+		if (storage[i].size() < byteLength)
+			return false;
+		buffers.push_back(GltfBuffer{ storage[i].data(), storage[i].size() });
+	}
+
+	// Every triangle primitive of every mesh
+	const uint32_t meshArray = json.Find(root, "meshes");
+	for (uint32_t meshIndex = 0; meshArray != JsonDocument::k_none && meshIndex < json[meshArray].Count; ++meshIndex)
+	{
+		const uint32_t primitives = json.Find(json.At(meshArray, meshIndex), "primitives");
+		for (uint32_t primitiveIndex = 0; primitives != JsonDocument::k_none && primitiveIndex < json[primitives].Count; ++primitiveIndex)
+		{
+			const uint32_t primitive	= json.At(primitives, primitiveIndex);
+			const uint32_t attributes	= json.Find(primitive, "attributes");
+			if (json.Unsigned(json.Find(primitive, "mode"), k_gltfTriangles) != k_gltfTriangles)
+				continue;
+
+			GltfAccessor position{}, normal{}, texCoord{}, index{};
+			const uint32_t normalValue		= json.Find(attributes, "NORMAL");
+			const uint32_t texCoordValue	= json.Find(attributes, "TEXCOORD_0");
+			const uint32_t indexValue		= json.Find(primitive, "indices");
+			if (!ReadAccessor(json, json.Find(attributes, "POSITION"), buffers, &position) ||
+				position.ComponentType != GLTF_FLOAT || position.ComponentNum != 3)
+				return false;
+			if (normalValue != JsonDocument::k_none && (!ReadAccessor(json, normalValue, buffers, &normal) || normal.Count != position.Count || normal.ComponentNum != 3))
+				return false;
+			if (texCoordValue != JsonDocument::k_none && (!ReadAccessor(json, texCoordValue, buffers, &texCoord) || texCoord.Count != position.Count || texCoord.ComponentNum != 2))
+				return false;
+			if (indexValue != JsonDocument::k_none && (!ReadAccessor(json, indexValue, buffers, &index) || index.ComponentNum != 1 || index.ComponentType == GLTF_FLOAT))
+				return false;
+
+			const size_t baseVertex	= mesh->Vertices.size();
+			const size_t baseIndex	= mesh->Indices.size();
+			const size_t indexNum	= indexValue != JsonDocument::k_none ? index.Count / 3 * 3 : position.Count / 3 * 3;
+			mesh->Vertices.resize(baseVertex + position.Count);
+			mesh->Indices.resize(baseIndex + indexNum);
+
+			std::atomic<bool> failed{ false };
+			const size_t vertexBlockNum	= (position.Count + k_vertexBlock - 1) / k_vertexBlock;
+			const size_t indexBlockNum	= (indexNum + k_vertexBlock - 1) / k_vertexBlock;
+			ThreadPool::Shared().ParallelFor(vertexBlockNum + indexBlockNum, [&](size_t block)
+			{
+				if (block < vertexBlockNum)
+				{
+					const size_t last = (std::min)((block + 1) * k_vertexBlock, position.Count);
+					for (size_t v = block * k_vertexBlock; v < last; ++v)
+					{
+						Vertex3D& vertex = mesh->Vertices[baseVertex + v];
+						std::memcpy(&vertex.Position, position.Data + v * position.Stride, sizeof(vertex.Position));
+
+						const uint32_t normalSize = ComponentSize(normal.ComponentType);
+						vertex.Normal = normal.Data ? DirectX::XMFLOAT3(
+							ReadComponent(normal.Data + v * normal.Stride, normal.ComponentType, normal.Normalized),
+							ReadComponent(normal.Data + v * normal.Stride + normalSize, normal.ComponentType, normal.Normalized),
+							ReadComponent(normal.Data + v * normal.Stride + normalSize * 2, normal.ComponentType, normal.Normalized)) : DirectX::XMFLOAT3(0.0f, 0.0f, 0.0f);
+
+						const uint32_t texCoordSize = ComponentSize(texCoord.ComponentType);
+						vertex.TexCoord = texCoord.Data ? DirectX::XMFLOAT2(
+							ReadComponent(texCoord.Data + v * texCoord.Stride, texCoord.ComponentType, texCoord.Normalized),
+							ReadComponent(texCoord.Data + v * texCoord.Stride + texCoordSize, texCoord.ComponentType, texCoord.Normalized)) : DirectX::XMFLOAT2(0.0f, 0.0f);
+					}
+					return;
+				}
+
+				const size_t first	= (block - vertexBlockNum) * k_vertexBlock;
+				const size_t last	= (std::min)(first + k_vertexBlock, indexNum);
+				for (size_t i = first; i < last; ++i)
+				{
+					const uint32_t value = index.Data ? ReadIndex(index.Data + i * index.Stride, index.ComponentType) : uint32_t(i);
+					if (value >= position.Count)
+						failed.store(true, std::memory_order_relaxed);
+					mesh->Indices[baseIndex + i] = uint32_t(baseVertex) + value;
+				}
+			});
+			if (failed)
+				return false;
+		}
+	}
+
+	return !mesh->Indices.empty();
+}
+
+/* Parse number */
+const char* MeshImporter::ParseNumber(const char* text, const char* end, double* value)
+{
+	const bool negative = (text < end && *text == '-');
+	if (text < end && (*text == '-' || *text == '+'))
+		++text;
+
+	uint64_t mantissa	= 0;
+	int digits			= 0;
+	int dropped			= 0;	// integer digits beyond precision scale up
+	const char* start	= text;
+	text = ParseDigits(text, end, &mantissa, &digits, &dropped);
+
+	int exponent = dropped;
+	bool hasDigits = (text != start);
+	if (text < end && *text == '.')
+	{
+		const char* fraction = ++text;
+		int fractionDropped = 0;
+		text		= ParseDigits(text, end, &mantissa, &digits, &fractionDropped);
+		exponent	-= int(text - fraction) - fractionDropped;
+		hasDigits	= hasDigits || (text != fraction);
+	}
+	if (!hasDigits)
+		return nullptr;
+
+	if (text < end && (*text == 'e' || *text == 'E'))
+	{
+		const char* mark = text++;
+		const bool negativeExponent = (text < end && *text == '-');
+		if (text < end && (*text == '-' || *text == '+'))
+			++text;
+
+		if (text < end && IsDigit(*text))
+		{
+			int power = 0;
+			for (; text < end && IsDigit(*text); ++text)
+				power = (std::min)(power * 10 + (*text - '0'), 100000);
+			exponent += negativeExponent ? -power : power;
+		}
+		else
+		{
+			text = mark;	// not an exponent
+		}
+	}
+
+	double result = double(mantissa);
+	if (mantissa != 0)
+	{
+		if (exponent >= 0 && exponent <= 22)
+			result *= k_pow10[exponent];
+		else if (exponent < 0 && exponent >= -22)
+			result /= k_pow10[-exponent];
+		else
+			result *= std::pow(10.0, double(exponent));
+	}
+
+	*value = negative ? -result : result;
+	return text;
+}
+
+/* Read file */
+bool MeshImporter::ReadFile(const wchar_t* fileName, std::vector<uint8_t>* data)
+{
+#if defined(_WIN32)
+	FILE* file = _wfopen(fileName, L"rb");
+#else
+	FILE* file = std::fopen(NarrowFileName(fileName).c_str(), "rb");
+#endif
+	if (!file)
+		return false;
+
+	bool result = false;
+	if (std::fseek(file, 0, SEEK_END) == 0)
+	{
+		long size = std::ftell(file);
+		if (size >= 0 && std::fseek(file, 0, SEEK_SET) == 0)
+		{
+			data->resize(size_t(size));
+			result = std::fread(data->data(), 1, data->size(), file) == data->size();
+		}
+	}
+
+	std::fclose(file);
+	return result;
+}
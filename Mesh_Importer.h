@@ -0,0 +1,93 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Mesh_Importer.h
+*		Detail	: Parallel OBJ and glTF 2.0 (json and binary) import
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Mesh_Optimizer.h"
+
+class MeshImporter
+{
+public:
+	static const size_t k_chunkSize = 1 << 20;	// bytes of obj text per parse job
+
+public:
+	//**************************************************
+	/// \brief Import by extension (.obj .gltf .glb)
+	///        Output is structure::Vertex3D, VertexFormat::Pack converts to packed
+	///
+	/// \param[in]  fileName ->	source file
+	/// \param[out] mesh	 ->	welded triangle list
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool Load(
+		const wchar_t* fileName,
+		structure::MeshData* mesh
+	);
+
+	//**************************************************
+	/// \brief Parse OBJ text on ThreadPool::Shared
+	///        Polygons are fan triangulated, missing normals are flat, v is flipped
+	///
+	/// \param[in]  text	 ->	file contents
+	/// \param[in]  size	 ->	bytes of text
+	/// \param[out] mesh	 ->	welded triangle list
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool ParseObj(
+		const char* text,
+		const size_t size,
+		structure::MeshData* mesh
+	);
+
+	//**************************************************
+	/// \brief Parse glTF json or glb, every triangle primitive of every mesh
+	///        Node transforms are not applied, primitives are in mesh space
+	///        Missing normals are zero
+	///
+	/// \param[in]  data	 ->	file contents
+	/// \param[in]  size	 ->	bytes of data
+	/// \param[in]  fileName ->	resolves external buffer uris (may be nullptr)
+	/// \param[out] mesh	 ->	triangle list
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool ParseGltf(
+		const uint8_t* data,
+		const size_t size,
+		const wchar_t* fileName,
+		structure::MeshData* mesh
+	);
+
+	//**************************************************
+	/// \brief Decimal number, 8 digits at a time (SWAR)
+	///
+	/// \param[in]  text	 ->	first character
+	/// \param[in]  end		 ->	end of text
+	/// \param[out] value	 ->	parsed number
+	///
+	/// \return pointer after the number, nullptr when there is none
+	//**************************************************
+	static const char* ParseNumber(
+		const char* text,
+		const char* end,
+		double* value
+	);
+
+	//**************************************************
+	/// \brief Read whole file
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool ReadFile(
+		const wchar_t* fileName,
+		std::vector<uint8_t>* data
+	);
+};
@@ -0,0 +1,144 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Mesh_Index.cpp
+*		Detail	: 16 bit index buffers, split into chunks when a mesh is too large
+===================================================================================*/
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define MESH_INDEX_SSE
+#endif
+
+#include "Mesh_Index.h"
+
+static const uint32_t k_maxRange16 = 0xffff;	// largest index - base vertex of a 16 bit chunk
+
+const uint32_t MeshIndex::k_minChunkTriangles;
+
+/* Build */
+bool MeshIndex::Build(const uint32_t* indices, const size_t indexNum, Buffer* buffer)
+{
+	buffer->Indices16.clear();
+	buffer->Indices32.clear();
+	buffer->Chunks.clear();
+	buffer->Is16Bit = false;
+
+	uint32_t minimum = 0, maximum = 0;
+	MeshIndex::Range(indices, indexNum, &minimum, &maximum);
+
+	if (maximum - minimum <= k_maxRange16)
+	{// Whole mesh fits
+		buffer->Indices16.resize(indexNum);
+		MeshIndex::Narrow(indices, buffer->Indices16.data(), indexNum, minimum);
+		buffer->Chunks.push_back(Chunk{ 0, (uint32_t)indexNum, (int32_t)minimum });
+		buffer->Is16Bit = true;
+		return true;
+	}
+
+	// Split in submission order, a triangle starts a new chunk when it would exceed the 16 bit range
+	std::vector<Chunk> chunks;
+	uint32_t low = UINT32_MAX, high = 0, start = 0;
+	for (size_t i = 0; i + 2 < indexNum; i += 3)
+	{
+		uint32_t triangleLow	= (std::min)((std::min)(indices[i], indices[i + 1]), indices[i + 2]);
+		uint32_t triangleHigh	= (std::max)((std::max)(indices[i], indices[i + 1]), indices[i + 2]);
+		uint32_t newLow			= (std::min)(low, triangleLow);
+		uint32_t newHigh		= (std::max)(high, triangleHigh);
+		if (newHigh - newLow > k_maxRange16 && (uint32_t)i > start)
+		{
+			chunks.push_back(Chunk{ start, (uint32_t)i - start, (int32_t)low });
+			start	= (uint32_t)i;
+			newLow	= triangleLow;
+			newHigh	= triangleHigh;
+		}
+		low		= newLow;
+		high	= newHigh;
+	}
+	if (indexNum > start)
+		chunks.push_back(Chunk{ start, (uint32_t)indexNum - start, (int32_t)low });
+
+	// A triangle spanning more than 65536 vertices, or chunks too small to pay for their draw calls
+	bool fits = true;
+	for (const Chunk& chunk : chunks)
+	{
+		uint32_t chunkLow = 0, chunkHigh = 0;
+		MeshIndex::Range(indices + chunk.StartIndex, chunk.IndexNum, &chunkLow, &chunkHigh);
+		fits = fits && (chunkHigh - chunkLow <= k_maxRange16);
+	}
+	const size_t triangleNum = indexNum / 3;
+	if (!fits || triangleNum < chunks.size() * k_minChunkTriangles)
+	{
+		buffer->Indices32.assign(indices, indices + indexNum);
+		buffer->Chunks.push_back(Chunk{ 0, (uint32_t)indexNum, 0 });
+		return false;
+	}
+
+	buffer->Indices16.resize(indexNum);
+	for (const Chunk& chunk : chunks)
+		MeshIndex::Narrow(indices + chunk.StartIndex, buffer->Indices16.data() + chunk.StartIndex, chunk.IndexNum, (uint32_t)chunk.BaseVertex);
+
+	buffer->Chunks	= std::move(chunks);
+	buffer->Is16Bit	= true;
+	return true;
+}
+
+/* Narrow */
+void MeshIndex::Narrow(const uint32_t* indices, uint16_t* narrowed, const size_t count, const uint32_t baseVertex)
+{
+	size_t i = 0;
+#if defined(MESH_INDEX_SSE)
+	// packs_epi32 saturates signed, bias into signed range and back
+	const __m128i base	= _mm_set1_epi32((int)(baseVertex + 0x8000));
+	const __m128i bias	= _mm_set1_epi16((short)(0x8000));
+	for (; i + 8 <= count; i += 8)
+	{
+		__m128i low		= _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(indices + i)), base);
+		__m128i high	= _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(indices + i + 4)), base);
+		_mm_storeu_si128((__m128i*)(narrowed + i), _mm_add_epi16(_mm_packs_epi32(low, high), bias));
+	}
+#endif
+	for (; i < count; ++i)
+		narrowed[i] = uint16_t(indices[i] - baseVertex);
+}
+
+/* Range */
+void MeshIndex::Range(const uint32_t* indices, const size_t count, uint32_t* minimum, uint32_t* maximum)
+{
+	uint32_t low = UINT32_MAX, high = 0;
+	size_t i = 0;
+#if defined(MESH_INDEX_SSE)
+	if (count >= 4)
+	{// SSE2 has no unsigned compare, flip the sign bit and compare signed
+		const __m128i sign = _mm_set1_epi32((int)(0x80000000u));
+		__m128i lowVector	= _mm_xor_si128(_mm_loadu_si128((const __m128i*)indices), sign);
+		__m128i highVector	= lowVector;
+		for (i = 4; i + 4 <= count; i += 4)
+		{
+			__m128i value	= _mm_xor_si128(_mm_loadu_si128((const __m128i*)(indices + i)), sign);
+			__m128i less	= _mm_cmplt_epi32(value, lowVector);
+			__m128i greater	= _mm_cmpgt_epi32(value, highVector);
+			lowVector		= _mm_or_si128(_mm_and_si128(less, value), _mm_andnot_si128(less, lowVector));
+			highVector		= _mm_or_si128(_mm_and_si128(greater, value), _mm_andnot_si128(greater, highVector));
+		}
+
+		alignas(16) uint32_t lows[4], highs[4];
+		_mm_store_si128((__m128i*)lows, _mm_xor_si128(lowVector, sign));
+		_mm_store_si128((__m128i*)highs, _mm_xor_si128(highVector, sign));
+		for (int lane = 0; lane < 4; ++lane)
+		{
+			low		= (std::min)(low, lows[lane]);
+			high	= (std::max)(high, highs[lane]);
+		}
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		low		= (std::min)(low, indices[i]);
+		high	= (std::max)(high, indices[i]);
+	}
+
+	*minimum = count ? low : 0;
+	*maximum = high;
+}
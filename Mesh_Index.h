@@ -0,0 +1,83 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Mesh_Index.h
+*		Detail	: 16 bit index buffers, split into chunks when a mesh is too large
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class MeshIndex
+{
+public:
+	//**************************************************
+	/// \brief Draw range, 16 bit indices are relative to BaseVertex
+	//**************************************************
+	struct Chunk
+	{
+		uint32_t	StartIndex;
+		uint32_t	IndexNum;
+		int32_t		BaseVertex;
+	};
+
+	//**************************************************
+	/// \brief Index data of one mesh, only one of the arrays is filled
+	//**************************************************
+	struct Buffer
+	{
+		std::vector<uint16_t>	Indices16;
+		std::vector<uint32_t>	Indices32;
+		std::vector<Chunk>		Chunks;		// one DrawIndexed per chunk
+		bool					Is16Bit = false;
+
+		const void*	Data() const		{ return Is16Bit ? (const void*)Indices16.data() : (const void*)Indices32.data(); }
+		uint32_t	IndexNum() const	{ return (uint32_t)(Is16Bit ? Indices16.size() : Indices32.size()); }
+		uint32_t	IndexSize() const	{ return Is16Bit ? sizeof(uint16_t) : sizeof(uint32_t); }
+		uint32_t	ByteSize() const	{ return this->IndexNum() * this->IndexSize(); }
+	};
+
+	static const uint32_t k_minChunkTriangles = 1024;	// smaller chunks cost more in draws than they save
+
+public:
+	//**************************************************
+	/// \brief Choose 16 bit indices when the mesh or its chunks allow it
+	///
+	/// \param[in]  indices		 ->	triangle list
+	/// \param[in]  indexNum	 ->	number of indices (multiple of 3)
+	/// \param[out] buffer		 ->	destination
+	///
+	/// \return if 16 bit was chosen then true
+	//**************************************************
+	static bool Build(
+		const uint32_t* indices,
+		const size_t indexNum,
+		Buffer* buffer
+	);
+
+	//**************************************************
+	/// \brief Subtract base vertex and narrow to 16 bit (SSE2)
+	///        every index minus baseVertex must be in [0, 65535]
+	///
+	/// \return none
+	//**************************************************
+	static void Narrow(
+		const uint32_t* indices,
+		uint16_t* narrowed,
+		const size_t count,
+		const uint32_t baseVertex
+	);
+
+	//**************************************************
+	/// \brief Minimum and maximum index (SSE2)
+	///
+	/// \return none
+	//**************************************************
+	static void Range(
+		const uint32_t* indices,
+		const size_t count,
+		uint32_t* minimum,
+		uint32_t* maximum
+	);
+};
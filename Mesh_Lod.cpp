@@ -0,0 +1,133 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Mesh_Lod.cpp
+*		Detail	: Level of detail chains and per frame selection by screen space error
+===================================================================================*/
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define MESH_LOD_SSE
+#endif
+
+#include "Mesh_Lod.h"
+using namespace structure;
+
+const uint32_t	LodSelector::k_maxLevels;
+const float		LodSelector::k_maxBias = 64.0f;
+
+namespace
+{
+	const float k_minDistance	= 1e-3f;	// camera inside a bounding sphere
+	const float k_budgetRelax	= 0.8f;		// below this fraction of the budget the bias eases off
+}
+
+/* Constructor */
+LodSelector::LodSelector()
+	:m_bias(1.0f)
+{
+}
+
+/* Add mesh */
+uint32_t LodSelector::AddMesh(const LodLevel* levels, const uint32_t levelNum)
+{
+	Chain chain{};
+	chain.LevelNum = (std::min)((std::max)(levelNum, 1u), k_maxLevels);
+	for (uint32_t i = 0; i < chain.LevelNum; ++i)
+	{
+		// Keep errors monotonic so the coarsest acceptable level is well defined
+		chain.Error[i]			= levelNum == 0 ? 0.0f : (std::max)(levels[i].Error, i > 0 ? chain.Error[i - 1] : 0.0f);
+		chain.TriangleNum[i]	= levelNum == 0 ? 0 : levels[i].IndexNum / 3;
+	}
+
+	m_chains.push_back(chain);
+	return uint32_t(m_chains.size() - 1);
+}
+
+/* Select */
+uint64_t LodSelector::Select(const Camera& camera, const Instances& instances)
+{
+	const size_t count = instances.Num;
+	m_levels.resize(count, 0);
+	m_allowed.resize(count);
+
+	// Object space error that projects to PixelError at the sphere's nearest point
+	const float factor = m_settings.PixelError * m_bias / (std::max)(camera.ProjectionScale, 1e-6f);
+	size_t i = 0;
+#if defined(MESH_LOD_SSE)
+	const __m128 cameraX	= _mm_set1_ps(camera.Position.x);
+	const __m128 cameraY	= _mm_set1_ps(camera.Position.y);
+	const __m128 cameraZ	= _mm_set1_ps(camera.Position.z);
+	const __m128 minimum	= _mm_set1_ps(k_minDistance);
+	const __m128 scale		= _mm_set1_ps(factor);
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 dx = _mm_sub_ps(_mm_loadu_ps(instances.CenterX + i), cameraX);
+		__m128 dy = _mm_sub_ps(_mm_loadu_ps(instances.CenterY + i), cameraY);
+		__m128 dz = _mm_sub_ps(_mm_loadu_ps(instances.CenterZ + i), cameraZ);
+		__m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)));
+		distance = _mm_max_ps(_mm_sub_ps(distance, _mm_loadu_ps(instances.Radius + i)), minimum);
+		_mm_storeu_ps(m_allowed.data() + i, _mm_mul_ps(distance, scale));
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		float dx = instances.CenterX[i] - camera.Position.x;
+		float dy = instances.CenterY[i] - camera.Position.y;
+		float dz = instances.CenterZ[i] - camera.Position.z;
+		float distance = std::sqrt(dx * dx + dy * dy + dz * dz) - instances.Radius[i];
+		m_allowed[i] = (std::max)(distance, k_minDistance) * factor;
+	}
+
+	// Coarser only with headroom, finer as soon as the current level is too coarse
+	const float headroom = 1.0f - m_settings.Hysteresis;
+	uint64_t triangleNum = 0;
+	for (i = 0; i < count; ++i)
+	{
+		if (instances.Visible && !instances.Visible[i])
+			continue;
+
+		const Chain& chain		= m_chains[instances.Mesh[i]];
+		const float allowed		= m_allowed[i];
+		uint32_t level			= (std::min)(uint32_t(m_levels[i]), chain.LevelNum - 1);
+
+		uint32_t coarser = level;
+		while (coarser + 1 < chain.LevelNum && chain.Error[coarser + 1] <= allowed * headroom)
+			++coarser;
+
+		if (coarser > level)
+		{
+			level = coarser;
+		}
+		else if (chain.Error[level] > allowed)
+		{
+			while (level > 0 && chain.Error[level] > allowed)
+				--level;
+		}
+
+		m_levels[i]	= uint8_t(level);
+		triangleNum	+= chain.TriangleNum[level];
+	}
+
+	// Triangles shrink with the square of the error scale
+	if (m_settings.TriangleBudget == 0)
+	{
+		m_bias = 1.0f;
+	}
+	else
+	{
+		const float ratio = float(double(triangleNum) / double(m_settings.TriangleBudget));
+		if (ratio > 1.0f || ratio < k_budgetRelax)
+			m_bias = (std::min)((std::max)(m_bias * std::sqrt((std::max)(ratio, 0.25f)), 1.0f), k_maxBias);
+	}
+
+	return triangleNum;
+}
+
+/* Projection scale */
+float LodSelector::ProjectionScale(const float fovY, const float viewportHeight)
+{
+	return viewportHeight * 0.5f / std::tan(fovY * 0.5f);
+}
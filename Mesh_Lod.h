@@ -0,0 +1,137 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Mesh_Lod.h
+*		Detail	: Level of detail chains and per frame selection by screen space error
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Mesh_Optimizer.h"
+
+namespace structure
+{
+	//**************************************************
+	/// \brief Index range of one detail level
+	//**************************************************
+	struct LodLevel
+	{
+		uint32_t	StartIndex;
+		uint32_t	IndexNum;
+		float		Error;		// largest object space deviation from level 0
+	};
+
+	//**************************************************
+	/// \brief Levels share the vertices, finest first, errors grow with the level
+	//**************************************************
+	struct LodMesh : MeshData
+	{
+		std::vector<LodLevel>	Levels;
+	};
+}
+
+class LodSelector
+{
+public:
+	//**************************************************
+	/// \brief Selection tuning
+	//**************************************************
+	struct Settings
+	{
+		float		PixelError		= 1.0f;		// allowed projected error in pixels
+		float		Hysteresis		= 0.25f;	// a coarser level needs this much headroom
+		uint64_t	TriangleBudget	= 0;		// 0 is unlimited
+	};
+
+	//**************************************************
+	/// \brief Viewer of the frame
+	//**************************************************
+	struct Camera
+	{
+		DirectX::XMFLOAT3	Position;
+		float				ProjectionScale;	// pixels per unit at distance 1, see ProjectionScale
+	};
+
+	//**************************************************
+	/// \brief Bounding spheres and meshes of all instances (structure of arrays)
+	//**************************************************
+	struct Instances
+	{
+		const float*	CenterX;
+		const float*	CenterY;
+		const float*	CenterZ;
+		const float*	Radius;
+		const uint32_t*	Mesh;		// index from AddMesh
+		const uint8_t*	Visible;	// non zero is visible, nullptr is all visible
+		size_t			Num;
+	};
+
+	static const uint32_t	k_maxLevels	= 8;
+	static const float		k_maxBias;	// largest error scale applied by the triangle budget
+
+public:
+	LodSelector();
+
+	//**************************************************
+	/// \brief Register the levels of one mesh
+	///
+	/// \param[in] levels	 ->	finest first, at most k_maxLevels are used
+	/// \param[in] levelNum	 ->	number of levels
+	///
+	/// \return mesh index for Instances::Mesh
+	//**************************************************
+	uint32_t AddMesh(
+		const structure::LodLevel* levels,
+		const uint32_t levelNum
+	);
+
+	//**************************************************
+	/// \brief Choose a level for every visible instance
+	///        Invisible instances keep their level, so they come back without popping
+	///        The triangle budget adjusts the error scale used by the next frame
+	///
+	/// \param[in] camera	 ->	viewer
+	/// \param[in] instances ->	same instance order every frame
+	///
+	/// \return triangles of the visible instances at the chosen levels
+	//**************************************************
+	uint64_t Select(
+		const Camera& camera,
+		const Instances& instances
+	);
+
+	//**************************************************
+	/// \brief Pixels per unit at distance 1 of a perspective projection
+	///
+	/// \param[in] fovY				 ->	vertical field of view (radian)
+	/// \param[in] viewportHeight	 ->	height in pixels
+	///
+	/// \return camera projection scale
+	//**************************************************
+	static float ProjectionScale(
+		const float fovY,
+		const float viewportHeight
+	);
+
+	void					SetSettings(const Settings& settings)	{ m_settings = settings; }
+	const Settings&			GetSettings() const						{ return m_settings; }
+	uint32_t				Level(size_t instance) const			{ return m_levels[instance]; }
+	const uint8_t*			Levels() const							{ return m_levels.data(); }
+	float					Bias() const							{ return m_bias; }
+
+private:
+	struct Chain
+	{
+		float		Error[k_maxLevels];
+		uint32_t	TriangleNum[k_maxLevels];
+		uint32_t	LevelNum;
+	};
+
+	std::vector<Chain>		m_chains;
+	std::vector<uint8_t>	m_levels;		// current level per instance
+	std::vector<float>		m_allowed;		// allowed object space error per instance
+	Settings				m_settings;
+	float					m_bias;			// error scale from the triangle budget, 1 or more
+};
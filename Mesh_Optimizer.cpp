@@ -0,0 +1,437 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Mesh_Optimizer.cpp
+*		Detail	: Offline welding, vertex cache, overdraw and vertex fetch optimization
+===================================================================================*/
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "Mesh_Optimizer.h"
+#include "Thread_Pool.h"
+using namespace structure;
+
+namespace
+{
+	const uint32_t	k_maxValence		= 32;		// valence score table size
+	const uint32_t	k_minClusterSize	= 16;		// triangles before a soft cluster boundary
+	const float		k_lastTriangleScore	= 0.75f;	// vertices of the last triangle, discourages strips
+	const float		k_cacheDecayPower	= 1.5f;
+	const float		k_valenceBoostScale	= 2.0f;
+	const float		k_valenceBoostPower	= 0.5f;
+
+	//**************************************************
+	/// \brief Forsyth vertex score by cache position and remaining valence
+	//**************************************************
+	struct ScoreTable
+	{
+		float	Cache[MeshOptimizer::k_cacheSize];
+		float	Valence[k_maxValence];
+
+		ScoreTable()
+		{
+			for (uint32_t i = 0; i < MeshOptimizer::k_cacheSize; ++i)
+			{
+				float scale	= 1.0f - float(i < 3 ? 0 : i - 3) / float(MeshOptimizer::k_cacheSize - 3);
+				Cache[i]	= i < 3 ? k_lastTriangleScore : std::pow(scale, k_cacheDecayPower);
+			}
+			for (uint32_t i = 0; i < k_maxValence; ++i)
+				Valence[i] = i ? k_valenceBoostScale * std::pow(float(i), -k_valenceBoostPower) : 0.0f;
+		}
+	};
+
+	float VertexScore(const int32_t cachePosition, const uint32_t remaining)
+	{
+		static const ScoreTable table;
+
+		if (remaining == 0)
+			return -1.0f;	// no triangle left to emit
+
+		float score = cachePosition < 0 ? 0.0f : table.Cache[cachePosition];
+		return score + table.Valence[(std::min)(remaining, k_maxValence - 1)];
+	}
+
+	//**************************************************
+	/// \brief FIFO cache with timestamps, an entry lives for cacheSize insertions
+	//**************************************************
+	class FifoCache
+	{
+	public:
+		FifoCache(const size_t vertexNum, const uint32_t cacheSize)
+			:m_stamp(vertexNum, 0), m_time(cacheSize + 1), m_cacheSize(cacheSize) {}
+
+		bool Access(const uint32_t vertex)
+		{
+			if (m_time - m_stamp[vertex] <= m_cacheSize)
+				return true;
+
+			m_stamp[vertex] = m_time++;
+			return false;
+		}
+
+		void Reset() { m_time += m_cacheSize + 1; }
+
+	private:
+		std::vector<uint32_t>	m_stamp;	// insertion time of each vertex
+		uint32_t				m_time;
+		uint32_t				m_cacheSize;
+	};
+
+	//**************************************************
+	/// \brief FNV-1a over the vertex bits
+	//**************************************************
+	uint32_t HashVertex(const Vertex3D& vertex)
+	{
+		uint32_t words[sizeof(Vertex3D) / sizeof(uint32_t)];
+		std::memcpy(words, &vertex, sizeof(words));
+
+		uint32_t hash = 2166136261u;
+		for (uint32_t word : words)
+		{
+			hash ^= word;
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+}
+
+const uint32_t MeshOptimizer::k_cacheSize;
+const uint32_t MeshOptimizer::k_statisticsCacheSize;
+
+/* Optimize */
+void MeshOptimizer::Optimize(MeshData* mesh, const Options& options)
+{
+	if (options.Weld)
+		MeshOptimizer::Weld(mesh);
+
+	if (options.VertexCache)
+		MeshOptimizer::OptimizeVertexCache(mesh->Indices.data(), mesh->Indices.size(), mesh->Vertices.size());
+
+	if (options.VertexCache && options.Overdraw)
+		MeshOptimizer::OptimizeOverdraw(mesh->Indices.data(), mesh->Indices.size(), mesh->Vertices.data(), mesh->Vertices.size(), options.OverdrawThreshold);
+
+	if (options.VertexFetch)
+		MeshOptimizer::OptimizeVertexFetch(mesh);
+}
+
+/* Optimize batch */
+void MeshOptimizer::OptimizeBatch(MeshData* const* meshes, const size_t meshNum, const Options& options)
+{
+	ThreadPool::Shared().ParallelFor(meshNum, [&](size_t index)
+	{
+		MeshOptimizer::Optimize(meshes[index], options);
+	});
+}
+
+/* Weld */
+size_t MeshOptimizer::Weld(MeshData* mesh)
+{
+	const size_t vertexNum = mesh->Vertices.size();
+	if (vertexNum == 0)
+		return 0;
+
+	size_t tableSize = 1;
+	while (tableSize < vertexNum * 2)
+		tableSize <<= 1;
+
+	// Open addressing, table holds the first occurrence of each vertex
+	std::vector<uint32_t> table(tableSize, UINT32_MAX);
+	std::vector<uint32_t> remap(vertexNum);
+	std::vector<Vertex3D> unique;
+	unique.reserve(vertexNum);
+	for (size_t i = 0; i < vertexNum; ++i)
+	{
+		const Vertex3D& vertex = mesh->Vertices[i];
+		size_t slot = HashVertex(vertex) & (tableSize - 1);
+		while (table[slot] != UINT32_MAX && std::memcmp(&mesh->Vertices[table[slot]], &vertex, sizeof(Vertex3D)) != 0)
+			slot = (slot + 1) & (tableSize - 1);
+
+		if (table[slot] == UINT32_MAX)
+		{
+			table[slot]	= uint32_t(i);
+			remap[i]	= uint32_t(unique.size());
+			unique.push_back(vertex);
+		}
+		else
+		{
+			remap[i] = remap[table[slot]];
+		}
+	}
+
+	for (uint32_t& index : mesh->Indices)
+		index = remap[index];
+
+	const size_t removed = vertexNum - unique.size();
+	mesh->Vertices = std::move(unique);
+	return removed;
+}
+
+/* Optimize vertex cache */
+void MeshOptimizer::OptimizeVertexCache(uint32_t* indices, const size_t indexNum, const size_t vertexNum)
+{
+	const size_t triangleNum = indexNum / 3;
+	if (triangleNum == 0 || vertexNum == 0)
+		return;
+
+	// Triangles of each vertex, the first remaining[v] entries are not emitted yet
+	std::vector<uint32_t> remaining(vertexNum, 0);
+	for (size_t i = 0; i < triangleNum * 3; ++i)
+		++remaining[indices[i]];
+
+	std::vector<uint32_t> offset(vertexNum + 1, 0);
+	for (size_t v = 0; v < vertexNum; ++v)
+		offset[v + 1] = offset[v] + remaining[v];
+
+	std::vector<uint32_t> adjacency(triangleNum * 3);
+	std::vector<uint32_t> fill(offset.begin(), offset.end() - 1);
+	for (size_t i = 0; i < triangleNum * 3; ++i)
+		adjacency[fill[indices[i]]++] = uint32_t(i / 3);
+
+	std::vector<int32_t>	cachePosition(vertexNum, -1);
+	std::vector<float>		vertexScore(vertexNum);
+	std::vector<float>		triangleScore(triangleNum, 0.0f);
+	std::vector<uint8_t>	emitted(triangleNum, 0);
+	for (size_t v = 0; v < vertexNum; ++v)
+		vertexScore[v] = VertexScore(-1, remaining[v]);
+	for (size_t i = 0; i < triangleNum * 3; ++i)
+		triangleScore[i / 3] += vertexScore[indices[i]];
+
+	std::vector<uint32_t> output(triangleNum * 3);
+	uint32_t cache[k_cacheSize + 3], newCache[k_cacheSize + 3];
+	uint32_t cacheNum	= 0;
+	int64_t best		= -1;
+	size_t cursor		= 0;
+	for (size_t out = 0; out < triangleNum; ++out)
+	{
+		if (best < 0)
+		{// Nothing adjacent to the cache, continue in input order
+			while (emitted[cursor])
+				++cursor;
+			best = int64_t(cursor);
+		}
+
+		const uint32_t* triangle = indices + size_t(best) * 3;
+		std::copy(triangle, triangle + 3, output.data() + out * 3);
+		emitted[size_t(best)] = 1;
+
+		for (int k = 0; k < 3; ++k)
+		{
+			const uint32_t v = triangle[k];
+			uint32_t* list = adjacency.data() + offset[v];
+			uint32_t* found = std::find(list, list + remaining[v], uint32_t(best));
+			if (found != list + remaining[v])
+			{
+				std::swap(*found, list[remaining[v] - 1]);
+				--remaining[v];
+			}
+		}
+
+		// Emitted vertices move to the front, the rest shifts back
+		uint32_t newCacheNum = 0;
+		for (int k = 0; k < 3; ++k)
+		{
+			if (std::find(newCache, newCache + newCacheNum, triangle[k]) == newCache + newCacheNum)
+				newCache[newCacheNum++] = triangle[k];
+		}
+		for (uint32_t i = 0; i < cacheNum; ++i)
+		{
+			if (cache[i] != triangle[0] && cache[i] != triangle[1] && cache[i] != triangle[2])
+				newCache[newCacheNum++] = cache[i];
+		}
+
+		for (uint32_t i = 0; i < newCacheNum; ++i)
+		{
+			const uint32_t v	= newCache[i];
+			cachePosition[v]	= i < k_cacheSize ? int32_t(i) : -1;
+
+			const float score	= VertexScore(cachePosition[v], remaining[v]);
+			const float delta	= score - vertexScore[v];
+			vertexScore[v]		= score;
+			for (uint32_t j = 0; j < remaining[v]; ++j)
+				triangleScore[adjacency[offset[v] + j]] += delta;
+		}
+
+		// Next triangle is the best one touching the cache
+		best = -1;
+		float bestScore = -1.0f;
+		cacheNum = (std::min)(newCacheNum, k_cacheSize);
+		for (uint32_t i = 0; i < cacheNum; ++i)
+		{
+			const uint32_t v = newCache[i];
+			cache[i] = v;
+			for (uint32_t j = 0; j < remaining[v]; ++j)
+			{
+				const uint32_t t = adjacency[offset[v] + j];
+				if (triangleScore[t] > bestScore)
+				{
+					bestScore	= triangleScore[t];
+					best		= int64_t(t);
+				}
+			}
+		}
+	}
+
+	std::copy(output.begin(), output.end(), indices);
+}
+
+/* Optimize overdraw */
+void MeshOptimizer::OptimizeOverdraw(uint32_t* indices, const size_t indexNum, const Vertex3D* vertices, const size_t vertexNum, const float threshold)
+{
+	const size_t triangleNum = indexNum / 3;
+	if (triangleNum < 2 || vertexNum == 0)
+		return;
+
+	// Hard boundaries, all three vertices miss so no reuse crosses them
+	std::vector<uint32_t> hardStart;
+	FifoCache fifo(vertexNum, k_statisticsCacheSize);
+	for (size_t t = 0; t < triangleNum; ++t)
+	{
+		int miss = 0;
+		for (int k = 0; k < 3; ++k)
+			miss += fifo.Access(indices[t * 3 + k]) ? 0 : 1;
+		if (miss == 3 || t == 0)
+			hardStart.push_back(uint32_t(t));
+	}
+	hardStart.push_back(uint32_t(triangleNum));
+
+	// Soft boundaries, cut where the cluster so far is within threshold of the whole cluster ACMR
+	std::vector<uint32_t> clusterStart;
+	for (size_t h = 0; h + 1 < hardStart.size(); ++h)
+	{
+		const uint32_t start	= hardStart[h];
+		const uint32_t end		= hardStart[h + 1];
+
+		uint32_t hardMiss = 0;
+		fifo.Reset();
+		for (uint32_t i = start * 3; i < end * 3; ++i)
+			hardMiss += fifo.Access(indices[i]) ? 0 : 1;
+		const float limit = float(hardMiss) / float(end - start) * threshold;
+
+		uint32_t softStart = start, softMiss = 0;
+		clusterStart.push_back(start);
+		fifo.Reset();
+		for (uint32_t t = start; t + 1 < end; ++t)
+		{
+			for (int k = 0; k < 3; ++k)
+				softMiss += fifo.Access(indices[t * 3 + k]) ? 0 : 1;
+
+			const uint32_t size = t + 1 - softStart;
+			if (size >= k_minClusterSize && float(softMiss) <= limit * float(size))
+			{
+				softStart	= t + 1;
+				softMiss	= 0;
+				clusterStart.push_back(softStart);
+				fifo.Reset();
+			}
+		}
+	}
+	const size_t clusterNum = clusterStart.size();
+	if (clusterNum < 2)
+		return;
+	clusterStart.push_back(uint32_t(triangleNum));
+
+	// Area weighted centroid and normal of each cluster
+	std::vector<float> centroid(clusterNum * 3, 0.0f), normal(clusterNum * 3, 0.0f), area(clusterNum, 0.0f);
+	float meshCentroid[3]{};
+	float meshArea = 0.0f;
+	for (size_t c = 0; c < clusterNum; ++c)
+	{
+		for (uint32_t t = clusterStart[c]; t < clusterStart[c + 1]; ++t)
+		{
+			const DirectX::XMFLOAT3& p0 = vertices[indices[t * 3 + 0]].Position;
+			const DirectX::XMFLOAT3& p1 = vertices[indices[t * 3 + 1]].Position;
+			const DirectX::XMFLOAT3& p2 = vertices[indices[t * 3 + 2]].Position;
+			const float e1[3]{ p1.x - p0.x, p1.y - p0.y, p1.z - p0.z };
+			const float e2[3]{ p2.x - p0.x, p2.y - p0.y, p2.z - p0.z };
+			const float n[3]{ e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+			const float a = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+			centroid[c * 3 + 0] += (p0.x + p1.x + p2.x) * a;
+			centroid[c * 3 + 1] += (p0.y + p1.y + p2.y) * a;
+			centroid[c * 3 + 2] += (p0.z + p1.z + p2.z) * a;
+			normal[c * 3 + 0] += n[0];
+			normal[c * 3 + 1] += n[1];
+			normal[c * 3 + 2] += n[2];
+			area[c] += a;
+		}
+
+		for (int k = 0; k < 3; ++k)
+			meshCentroid[k] += centroid[c * 3 + k];
+		meshArea += area[c];
+
+		const float inverse = area[c] > 0.0f ? 1.0f / (3.0f * area[c]) : 0.0f;
+		for (int k = 0; k < 3; ++k)
+			centroid[c * 3 + k] *= inverse;
+	}
+	for (int k = 0; k < 3; ++k)
+		meshCentroid[k] = meshArea > 0.0f ? meshCentroid[k] / (3.0f * meshArea) : 0.0f;
+
+	// Clusters far out along their normal tend to occlude the rest, draw them first
+	std::vector<float> key(clusterNum);
+	std::vector<uint32_t> order(clusterNum);
+	for (size_t c = 0; c < clusterNum; ++c)
+	{
+		const float* n		= &normal[c * 3];
+		const float length	= std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+		float distance		= 0.0f;
+		for (int k = 0; k < 3; ++k)
+			distance += (centroid[c * 3 + k] - meshCentroid[k]) * n[k];
+
+		key[c]		= length > 0.0f ? distance / length : 0.0f;
+		order[c]	= uint32_t(c);
+	}
+	std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return key[a] > key[b]; });
+
+	std::vector<uint32_t> sorted;
+	sorted.reserve(triangleNum * 3);
+	for (uint32_t c : order)
+		sorted.insert(sorted.end(), indices + clusterStart[c] * 3, indices + clusterStart[c + 1] * 3);
+
+	const float before	= MeshOptimizer::Analyze(indices, triangleNum * 3, vertexNum).ACMR;
+	const float after	= MeshOptimizer::Analyze(sorted.data(), sorted.size(), vertexNum).ACMR;
+	if (after <= before * threshold)
+		std::copy(sorted.begin(), sorted.end(), indices);
+}
+
+/* Optimize vertex fetch */
+void MeshOptimizer::OptimizeVertexFetch(MeshData* mesh)
+{
+	std::vector<uint32_t> remap(mesh->Vertices.size(), UINT32_MAX);
+	std::vector<Vertex3D> ordered;
+	ordered.reserve(mesh->Vertices.size());
+	for (uint32_t& index : mesh->Indices)
+	{
+		if (remap[index] == UINT32_MAX)
+		{
+			remap[index] = uint32_t(ordered.size());
+			ordered.push_back(mesh->Vertices[index]);
+		}
+		index = remap[index];
+	}
+
+	mesh->Vertices = std::move(ordered);
+}
+
+/* Analyze */
+MeshOptimizer::Statistics MeshOptimizer::Analyze(const uint32_t* indices, const size_t indexNum, const size_t vertexNum, const uint32_t cacheSize)
+{
+	Statistics statistics{};
+	statistics.TriangleNum = uint32_t(indexNum / 3);
+	if (statistics.TriangleNum == 0 || vertexNum == 0)
+		return statistics;
+
+	FifoCache fifo(vertexNum, cacheSize);
+	std::vector<uint8_t> referenced(vertexNum, 0);
+	uint32_t miss = 0;
+	for (size_t i = 0; i < size_t(statistics.TriangleNum) * 3; ++i)
+	{
+		miss += fifo.Access(indices[i]) ? 0 : 1;
+		statistics.VertexNum += referenced[indices[i]] ? 0 : 1;
+		referenced[indices[i]] = 1;
+	}
+
+	statistics.ACMR = float(miss) / float(statistics.TriangleNum);
+	statistics.ATVR = float(miss) / float(statistics.VertexNum);
+	return statistics;
+}
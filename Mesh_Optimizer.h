@@ -0,0 +1,141 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Mesh_Optimizer.h
+*		Detail	: Offline welding, vertex cache, overdraw and vertex fetch optimization
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Graphics_Interface.h"
+
+namespace structure
+{
+	//**************************************************
+	/// \brief Indexed triangle list on the cpu
+	//**************************************************
+	struct MeshData
+	{
+		std::vector<Vertex3D>	Vertices;
+		std::vector<uint32_t>	Indices;
+	};
+}
+
+class MeshOptimizer
+{
+public:
+	//**************************************************
+	/// \brief Steps of Optimize
+	//**************************************************
+	struct Options
+	{
+		bool	Weld				= true;		// merge bitwise identical vertices
+		bool	VertexCache			= true;		// Forsyth triangle order
+		bool	Overdraw			= true;		// cluster order, front facing outside first
+		bool	VertexFetch			= true;		// vertices in order of first use
+		float	OverdrawThreshold	= 1.05f;	// allowed ACMR increase of cluster order
+	};
+
+	//**************************************************
+	/// \brief Vertex processing efficiency
+	//**************************************************
+	struct Statistics
+	{
+		float		ACMR;			// transformed vertices per triangle (0.5 is ideal)
+		float		ATVR;			// transformed vertices per referenced vertex (1.0 is ideal)
+		uint32_t	TriangleNum;
+		uint32_t	VertexNum;		// referenced vertices
+	};
+
+	static const uint32_t k_cacheSize			= 32;	// LRU size modeled by Forsyth scoring
+	static const uint32_t k_statisticsCacheSize	= 16;	// FIFO size of Analyze
+
+public:
+	//**************************************************
+	/// \brief Run enabled steps in pipeline order
+	///
+	/// \return none
+	//**************************************************
+	static void Optimize(
+		structure::MeshData* mesh,
+		const Options& options
+	);
+
+	//**************************************************
+	/// \brief Optimize meshes on ThreadPool::Shared, one mesh per job
+	///
+	/// \param[in,out] meshes	 ->	mesh pointers
+	/// \param[in]     meshNum	 ->	number of meshes
+	/// \param[in]     options	 ->	steps
+	///
+	/// \return none
+	//**************************************************
+	static void OptimizeBatch(
+		structure::MeshData* const* meshes,
+		const size_t meshNum,
+		const Options& options
+	);
+
+	//**************************************************
+	/// \brief Merge bitwise identical vertices and remap indices
+	///
+	/// \return number of removed vertices
+	//**************************************************
+	static size_t Weld(structure::MeshData* mesh);
+
+	//**************************************************
+	/// \brief Reorder triangles for the post transform cache (Forsyth)
+	///
+	/// \param[in,out] indices	 ->	triangle list
+	/// \param[in]     indexNum	 ->	number of indices
+	/// \param[in]     vertexNum ->	number of vertices
+	///
+	/// \return none
+	//**************************************************
+	static void OptimizeVertexCache(
+		uint32_t* indices,
+		const size_t indexNum,
+		const size_t vertexNum
+	);
+
+	//**************************************************
+	/// \brief Reorder clusters of a cache optimized list to reduce overdraw
+	///        Clusters are cut where the cache restarts or the local ACMR is
+	///        within threshold, order is kept when ACMR grows by more than threshold
+	///
+	/// \return none
+	//**************************************************
+	static void OptimizeOverdraw(
+		uint32_t* indices,
+		const size_t indexNum,
+		const structure::Vertex3D* vertices,
+		const size_t vertexNum,
+		const float threshold
+	);
+
+	//**************************************************
+	/// \brief Reorder vertices by first use, unreferenced vertices are removed
+	///
+	/// \return none
+	//**************************************************
+	static void OptimizeVertexFetch(structure::MeshData* mesh);
+
+	//**************************************************
+	/// \brief Simulate a FIFO post transform cache
+	///
+	/// \param[in] indices	 ->	triangle list
+	/// \param[in] indexNum	 ->	number of indices
+	/// \param[in] vertexNum ->	number of vertices
+	/// \param[in] cacheSize ->	cache entries
+	///
+	/// \return statistics
+	//**************************************************
+	static Statistics Analyze(
+		const uint32_t* indices,
+		const size_t indexNum,
+		const size_t vertexNum,
+		const uint32_t cacheSize = k_statisticsCacheSize
+	);
+};
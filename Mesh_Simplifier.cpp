@@ -0,0 +1,804 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Mesh_Simplifier.cpp
+*		Detail	: Quadric error edge collapse simplification and LOD chain generation
+===================================================================================*/
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#include "Mesh_Simplifier.h"
+#include "Thread_Pool.h"
+using namespace structure;
+
+const float MeshSimplifier::k_borderWeight = 10.0f;
+
+namespace
+{
+	const uint32_t	k_invalid		= UINT32_MAX;
+	const float		k_flipCosine	= 0.25f;	// a one ring face may turn by about 75 degrees per collapse
+	const float		k_minSliver		= 0.05f;	// twice the area over the longest edge squared
+	const size_t	k_passFraction	= 3;		// cheapest 1/n of the candidates are tried per pass
+
+	//**************************************************
+	/// \brief How a position may move
+	//**************************************************
+	enum class KIND : uint8_t
+	{
+		MANIFOLD,	// collapses onto any neighbor
+		BORDER,		// collapses along its two border edges only
+		SEAM,		// every vertex of the position collapses along its two seam edges together
+		LOCKED,		// seam junction, non manifold or border junction, target only
+		NUM
+	};
+
+	//**************************************************
+	/// \brief How the target of a vertex is picked
+	//**************************************************
+	enum class PICK : uint8_t
+	{
+		CHEAPEST,	// cheapest target, checked when the collapse is applied
+		CHECKED,	// a collapse flipped or made a sliver, cheapest target that can move
+		NONE,		// no target can move until the one ring changes
+		NUM
+	};
+
+	//**************************************************
+	/// \brief Symmetric 4x4 error quadric, sum of squared plane distances
+	//**************************************************
+	struct Quadric
+	{
+		double	A00, A11, A22, A10, A20, A21;
+		double	B0, B1, B2;
+		double	C;
+		double	Weight;
+
+		void AddPlane(const double nx, const double ny, const double nz, const double d, const double weight)
+		{
+			A00 += weight * nx * nx;	A11 += weight * ny * ny;	A22 += weight * nz * nz;
+			A10 += weight * ny * nx;	A20 += weight * nz * nx;	A21 += weight * nz * ny;
+			B0	+= weight * nx * d;		B1	+= weight * ny * d;		B2	+= weight * nz * d;
+			C	+= weight * d * d;
+		}
+
+		void Add(const Quadric& other)
+		{
+			A00 += other.A00;	A11 += other.A11;	A22 += other.A22;
+			A10 += other.A10;	A20 += other.A20;	A21 += other.A21;
+			B0	+= other.B0;	B1	+= other.B1;	B2	+= other.B2;
+			C	+= other.C;
+			Weight += other.Weight;
+		}
+	};
+
+	// Squared distance of the sum of two quadrics at p, averaged by weight
+	double Evaluate(const Quadric& q0, const Quadric& q1, const DirectX::XMFLOAT3& p)
+	{
+		const double x = p.x, y = p.y, z = p.z;
+		const double a00 = q0.A00 + q1.A00, a11 = q0.A11 + q1.A11, a22 = q0.A22 + q1.A22;
+		const double a10 = q0.A10 + q1.A10, a20 = q0.A20 + q1.A20, a21 = q0.A21 + q1.A21;
+		double error =
+			a00 * x * x + a11 * y * y + a22 * z * z +
+			2.0 * (a10 * x * y + a20 * x * z + a21 * y * z) +
+			2.0 * ((q0.B0 + q1.B0) * x + (q0.B1 + q1.B1) * y + (q0.B2 + q1.B2) * z) +
+			q0.C + q1.C;
+
+		const double weight = q0.Weight + q1.Weight;
+		return (std::max)(weight > 0.0 ? error / weight : error, 0.0);
+	}
+
+	//**************************************************
+	/// \brief Collapse of Source onto Target
+	//**************************************************
+	struct Collapse
+	{
+		uint32_t	Source;
+		uint32_t	Target;
+		float		Cost;	// squared distance
+	};
+
+	// Cross product of (b - a) and (c - a)
+	DirectX::XMFLOAT3 Normal(const DirectX::XMFLOAT3& a, const DirectX::XMFLOAT3& b, const DirectX::XMFLOAT3& c)
+	{
+		const float ux = b.x - a.x, uy = b.y - a.y, uz = b.z - a.z;
+		const float vx = c.x - a.x, vy = c.y - a.y, vz = c.z - a.z;
+		return DirectX::XMFLOAT3(uy * vz - uz * vy, uz * vx - ux * vz, ux * vy - uy * vx);
+	}
+
+	float DistanceSq(const DirectX::XMFLOAT3& a, const DirectX::XMFLOAT3& b)
+	{
+		const float x = b.x - a.x, y = b.y - a.y, z = b.z - a.z;
+		return x * x + y * y + z * z;
+	}
+
+	// FNV-1a over the position bits
+	uint32_t HashPosition(const DirectX::XMFLOAT3& position)
+	{
+		uint32_t words[3];
+		std::memcpy(words, &position, sizeof(words));
+
+		uint32_t hash = 2166136261u;
+		for (uint32_t word : words)
+		{
+			hash ^= word;
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	// First vertex with the same position, vertices that differ only in attributes share it
+	void GroupPositions(const Vertex3D* vertices, const size_t vertexNum, std::vector<uint32_t>* group)
+	{
+		size_t tableSize = 1;
+		while (tableSize < vertexNum * 2)
+			tableSize <<= 1;
+
+		std::vector<uint32_t> table(tableSize, k_invalid);
+		group->resize(vertexNum);
+		for (size_t i = 0; i < vertexNum; ++i)
+		{
+			const DirectX::XMFLOAT3& position = vertices[i].Position;
+			size_t slot = HashPosition(position) & (tableSize - 1);
+			while (table[slot] != k_invalid && std::memcmp(&vertices[table[slot]].Position, &position, sizeof(position)) != 0)
+				slot = (slot + 1) & (tableSize - 1);
+
+			if (table[slot] == k_invalid)
+				table[slot] = uint32_t(i);
+			(*group)[i] = table[slot];
+		}
+	}
+
+	//**************************************************
+	/// \brief Working state of one Simplify call, quadrics and links are kept per position
+	//**************************************************
+	class Simplifier
+	{
+	public:
+		Simplifier(const Vertex3D* vertices, const size_t vertexNum, const MeshSimplifier::Options& options)
+			:m_vertices(vertices), m_vertexNum(vertexNum), m_options(options) {}
+
+		float Run(std::vector<uint32_t>* indices)
+		{
+			GroupPositions(m_vertices, m_vertexNum, &m_group);
+			RemoveDegenerates(indices);
+			Classify(*indices);
+			ComputeQuadrics(*indices);
+
+			const size_t	target		= m_options.TargetTriangleNum;
+			const double	maxCost		= double(m_options.TargetError) * double(m_options.TargetError);
+			double			worstCost	= 0.0;
+			size_t			triangleNum	= indices->size() / 3;
+			while (triangleNum > target)
+			{
+				BuildAdjacency(*indices);
+				std::fill(m_lockedGroup.begin(), m_lockedGroup.end(), uint8_t(0));
+				FindCollapses(*indices);
+				if (m_collapses.empty())
+					break;
+
+				// Cheapest first, each pass touches a one ring only once, so the expensive tail is never reached
+				const auto cheaper = [](const Collapse& a, const Collapse& b) { return a.Cost < b.Cost; };
+				const size_t keep = (std::max)(m_collapses.size() / k_passFraction, size_t(1));
+				std::nth_element(m_collapses.begin(), m_collapses.begin() + (keep - 1), m_collapses.end(), cheaper);
+				m_collapses.resize(keep);
+				std::sort(m_collapses.begin(), m_collapses.end(), cheaper);
+
+				size_t applied = 0;
+				for (const Collapse& collapse : m_collapses)
+				{
+					if (triangleNum <= target || collapse.Cost > maxCost)
+						break;
+
+					size_t removed = 0;
+					if (!Apply(indices->data(), collapse, &removed))
+						continue;
+
+					triangleNum	-= removed;
+					worstCost	= (std::max)(worstCost, double(collapse.Cost));
+					++applied;
+				}
+
+				RemoveDegenerates(indices);
+				triangleNum = indices->size() / 3;
+				if (applied == 0)
+					break;
+			}
+
+			return float(std::sqrt(worstCost));
+		}
+
+	private:
+		// Triangles with two corners at one position have no area left
+		void RemoveDegenerates(std::vector<uint32_t>* indices) const
+		{
+			uint32_t* data	= indices->data();
+			size_t write	= 0;
+			for (size_t i = 0; i + 3 <= indices->size(); i += 3)
+			{
+				const uint32_t g0 = m_group[data[i]], g1 = m_group[data[i + 1]], g2 = m_group[data[i + 2]];
+				if (g0 == g1 || g1 == g2 || g2 == g0)
+					continue;
+
+				data[write]		= data[i];
+				data[write + 1]	= data[i + 1];
+				data[write + 2]	= data[i + 2];
+				write += 3;
+			}
+			indices->resize(write);
+		}
+
+		// Border edges are position edges used by one triangle, more than two make a vertex non manifold
+		// Seam edges are used by two triangles through different vertices, the attributes split along them
+		void Classify(const std::vector<uint32_t>& indices)
+		{
+			// Vertices in use per position, unused duplicates do not split it
+			std::vector<uint32_t> groupSize(m_vertexNum, 0);
+			std::vector<uint8_t> used(m_vertexNum, 0);
+			for (uint32_t index : indices)
+			{
+				groupSize[m_group[index]] += used[index] ? 0 : 1;
+				used[index] = 1;
+			}
+
+			// Only edges between two split positions can be seams, they keep their vertex edge
+			std::vector<uint64_t> edges;
+			std::vector<std::pair<uint64_t, uint64_t>> splitEdges;	// position edge, vertex edge
+			edges.reserve(indices.size());
+			for (size_t i = 0; i < indices.size(); i += 3)
+			{
+				for (uint32_t e = 0; e < 3; ++e)
+				{
+					const uint32_t v0 = indices[i + e], v1 = indices[i + (e + 1) % 3];
+					const uint32_t g0 = m_group[v0], g1 = m_group[v1];
+					edges.push_back(uint64_t((std::min)(g0, g1)) << 32 | (std::max)(g0, g1));
+					if (groupSize[g0] > 1 && groupSize[g1] > 1)
+						splitEdges.emplace_back(edges.back(), uint64_t((std::min)(v0, v1)) << 32 | (std::max)(v0, v1));
+				}
+			}
+			std::sort(edges.begin(), edges.end());
+			std::sort(splitEdges.begin(), splitEdges.end());
+
+			std::vector<uint8_t> borderNum(m_vertexNum, 0);
+			std::vector<uint8_t> nonManifold(m_vertexNum, 0);
+			m_link.assign(m_vertexNum * 2, k_invalid);
+			for (size_t i = 0; i < edges.size();)
+			{
+				size_t end = i + 1;
+				while (end < edges.size() && edges[end] == edges[i])
+					++end;
+
+				const uint32_t g0 = uint32_t(edges[i] >> 32), g1 = uint32_t(edges[i]);
+				if (end - i > 2)
+				{
+					nonManifold[g0] = nonManifold[g1] = 1;
+				}
+				else if (end - i == 1)
+				{
+					for (uint32_t g : { g0, g1 })
+					{
+						if (borderNum[g] < 2)
+							m_link[g * 2 + borderNum[g]] = g0 ^ g1 ^ g;
+						borderNum[g] = uint8_t((std::min)(borderNum[g] + 1, 3));
+					}
+				}
+				i = end;
+			}
+
+			std::vector<uint8_t> seamNum(m_vertexNum, 0);
+			m_seamLink.assign(m_vertexNum * 2, k_invalid);
+			for (size_t i = 0; i < splitEdges.size();)
+			{
+				size_t end = i + 1;
+				while (end < splitEdges.size() && splitEdges[end].first == splitEdges[i].first)
+					++end;
+
+				const uint32_t g0 = uint32_t(splitEdges[i].first >> 32), g1 = uint32_t(splitEdges[i].first);
+				if (end - i == 2 && splitEdges[i].second != splitEdges[i + 1].second)
+				{
+					for (uint32_t g : { g0, g1 })
+					{
+						if (seamNum[g] < 2)
+							m_seamLink[g * 2 + seamNum[g]] = g0 ^ g1 ^ g;
+						seamNum[g] = uint8_t((std::min)(seamNum[g] + 1, 3));
+					}
+				}
+				i = end;
+			}
+
+			m_groupNext.assign(m_vertexNum, k_invalid);
+			for (size_t v = m_vertexNum; v-- > 0;)
+			{
+				const uint32_t g = m_group[v];
+				if (g == v)
+					continue;
+				m_groupNext[v] = m_groupNext[g];
+				m_groupNext[g] = uint32_t(v);
+			}
+
+			m_kind.resize(m_vertexNum);
+			for (size_t v = 0; v < m_vertexNum; ++v)
+			{
+				const uint32_t g = m_group[v];
+				if (nonManifold[g])
+					m_kind[v] = KIND::LOCKED;
+				else if (groupSize[g] > 1)
+					m_kind[v] = seamNum[g] == 2 && borderNum[g] == 0 ? KIND::SEAM : KIND::LOCKED;
+				else if (borderNum[g] == 0)
+					m_kind[v] = KIND::MANIFOLD;
+				else if (borderNum[g] == 2 && !m_options.LockBorder)
+					m_kind[v] = KIND::BORDER;
+				else
+					m_kind[v] = KIND::LOCKED;
+			}
+
+			// Only a seam line through a position links it, ends and junctions are targets
+			for (size_t g = 0; g < m_vertexNum; ++g)
+			{
+				if (seamNum[g] != 2)
+					m_seamLink[g * 2] = m_seamLink[g * 2 + 1] = k_invalid;
+			}
+		}
+
+		// Area weighted face planes, border and seam edges add a plane perpendicular to the face
+		void ComputeQuadrics(const std::vector<uint32_t>& indices)
+		{
+			m_quadric.assign(m_vertexNum, Quadric{});
+			m_lockedGroup.assign(m_vertexNum, 0);
+			m_pick.assign(m_vertexNum, PICK::CHEAPEST);
+			m_dirty.assign(m_vertexNum, 1);
+			m_best.assign(m_vertexNum, Collapse{ 0, k_invalid, 0.0f });
+			for (size_t i = 0; i < indices.size(); i += 3)
+			{
+				const uint32_t g[3] = { m_group[indices[i]], m_group[indices[i + 1]], m_group[indices[i + 2]] };
+				const DirectX::XMFLOAT3& p0 = m_vertices[g[0]].Position;
+				const DirectX::XMFLOAT3 n = Normal(p0, m_vertices[g[1]].Position, m_vertices[g[2]].Position);
+
+				const double length = std::sqrt(double(n.x) * n.x + double(n.y) * n.y + double(n.z) * n.z);
+				if (length <= 0.0)
+					continue;
+
+				const double nx = n.x / length, ny = n.y / length, nz = n.z / length;
+				const double area = length * 0.5;
+				Quadric face{};
+				face.AddPlane(nx, ny, nz, -(nx * p0.x + ny * p0.y + nz * p0.z), area);
+				face.Weight = area;
+				for (uint32_t c = 0; c < 3; ++c)
+					m_quadric[g[c]].Add(face);
+
+				for (uint32_t e = 0; e < 3; ++e)
+				{
+					const uint32_t a = g[e], b = g[(e + 1) % 3];
+					if (!IsLinked(m_link, a, b) && !IsLinked(m_seamLink, a, b) && !IsLinked(m_seamLink, b, a))
+						continue;
+
+					const DirectX::XMFLOAT3& pa = m_vertices[a].Position;
+					const DirectX::XMFLOAT3& pb = m_vertices[b].Position;
+					const double ex = pb.x - pa.x, ey = pb.y - pa.y, ez = pb.z - pa.z;
+					double bx = ey * nz - ez * ny, by = ez * nx - ex * nz, bz = ex * ny - ey * nx;
+					const double edgeLength = std::sqrt(bx * bx + by * by + bz * bz);
+					if (edgeLength <= 0.0)
+						continue;
+
+					bx /= edgeLength; by /= edgeLength; bz /= edgeLength;
+					Quadric border{};
+					border.AddPlane(bx, by, bz, -(bx * pa.x + by * pa.y + bz * pa.z), edgeLength * edgeLength * MeshSimplifier::k_borderWeight);
+					m_quadric[a].Add(border);
+					m_quadric[b].Add(border);
+				}
+			}
+		}
+
+		// Triangles around each vertex of the current list
+		void BuildAdjacency(const std::vector<uint32_t>& indices)
+		{
+			m_offset.assign(m_vertexNum + 1, 0);
+			for (uint32_t index : indices)
+				++m_offset[index + 1];
+			for (size_t v = 0; v < m_vertexNum; ++v)
+				m_offset[v + 1] += m_offset[v];
+
+			m_adjacency.resize(indices.size());
+			std::vector<uint32_t> fill(m_offset.begin(), m_offset.end() - 1);
+			for (size_t i = 0; i < indices.size(); ++i)
+				m_adjacency[fill[indices[i]]++] = uint32_t(i / 3);
+		}
+
+		static bool IsLinked(const std::vector<uint32_t>& links, const uint32_t g, const uint32_t other)
+		{
+			return links[g * 2] == other || links[g * 2 + 1] == other;
+		}
+
+		// Border and seam vertices only move onto a neighbor along their line, and not if that closes a three edge loop
+		bool IsValid(const uint32_t source, const uint32_t target) const
+		{
+			if (m_kind[source] != KIND::BORDER && m_kind[source] != KIND::SEAM)
+				return true;
+
+			const std::vector<uint32_t>& links = m_kind[source] == KIND::BORDER ? m_link : m_seamLink;
+			const uint32_t gs = m_group[source], gt = m_group[target];
+			if (!IsLinked(links, gs, gt))
+				return false;
+
+			const uint32_t other = links[gs * 2] == gt ? links[gs * 2 + 1] : links[gs * 2];
+			return !IsLinked(links, gt, other);
+		}
+
+		// Vertex at position gt that shares a triangle with vertex, k_invalid when there is none or more than one
+		uint32_t MatchTarget(const uint32_t* indices, const uint32_t vertex, const uint32_t gt) const
+		{
+			uint32_t match = k_invalid;
+			for (uint32_t t = m_offset[vertex]; t < m_offset[vertex + 1]; ++t)
+			{
+				const uint32_t* triangle = &indices[m_adjacency[t] * 3];
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					if (m_group[triangle[c]] != gt)
+						continue;
+					if (match != k_invalid && match != triangle[c])
+						return k_invalid;
+					match = triangle[c];
+				}
+			}
+			return match;
+		}
+
+		// Cheapest target of every movable vertex
+		void FindCollapses(const std::vector<uint32_t>& indices)
+		{
+			m_collapses.clear();
+			for (uint32_t v = 0; v < uint32_t(m_vertexNum); ++v)
+			{
+				if (m_kind[v] == KIND::LOCKED || m_pick[v] == PICK::NONE || m_offset[v] == m_offset[v + 1])
+					continue;
+
+				// Seam positions and vertices whose collapse flipped or made a sliver are few, checked apart
+				if (m_kind[v] == KIND::SEAM || m_pick[v] == PICK::CHECKED)
+				{
+					FindCheckedCollapse(indices, v);
+					continue;
+				}
+
+				// Nothing around v changed, the target and cost of the last pass still hold
+				if (!m_dirty[v])
+				{
+					if (m_best[v].Target != k_invalid)
+						m_collapses.push_back(m_best[v]);
+					continue;
+				}
+
+				// Inside a closed fan every neighbor follows v in exactly one triangle
+				const uint32_t	step		= m_kind[v] == KIND::BORDER ? 1 : 2;
+				const Quadric&	quadric		= m_quadric[m_group[v]];
+				Collapse		best{ v, k_invalid, 0.0f };
+				double			bestCost	= 0.0;
+				for (uint32_t t = m_offset[v]; t < m_offset[v + 1]; ++t)
+				{
+					const uint32_t* triangle = &indices[m_adjacency[t] * 3];
+					const uint32_t corner = triangle[0] == v ? 0 : triangle[1] == v ? 1 : 2;
+					for (uint32_t c = 1; c < 3; c += step)
+					{
+						const uint32_t target = triangle[(corner + c) % 3];
+						if (!IsValid(v, target))
+							continue;
+
+						const double cost = Evaluate(quadric, m_quadric[m_group[target]], m_vertices[target].Position);
+						if (best.Target == k_invalid || cost < bestCost)
+						{
+							best.Target	= target;
+							bestCost	= cost;
+						}
+					}
+				}
+
+				best.Cost	= float(bestCost);
+				m_best[v]	= best;
+				m_dirty[v]	= 0;
+				if (best.Target != k_invalid)
+					m_collapses.push_back(best);
+			}
+		}
+
+		// Cheapest target that can move, of a seam position or of a vertex whose collapse flipped or made a sliver
+		void FindCheckedCollapse(const std::vector<uint32_t>& indices, const uint32_t v)
+		{
+			const uint32_t gs = m_group[v];
+			m_candidates.clear();
+			if (m_kind[v] == KIND::SEAM)
+			{// One candidate per position, from its first vertex in use, onto either seam neighbor
+				uint32_t first = gs;
+				while (m_offset[first] == m_offset[first + 1])
+					first = m_groupNext[first];
+				if (first != v)
+					return;
+
+				for (uint32_t i = 0; i < 2; ++i)
+				{
+					const uint32_t target = m_seamLink[gs * 2 + i];
+					if (target != k_invalid && IsValid(v, target))
+						m_candidates.push_back(Collapse{ v, target, 0.0f });
+				}
+			}
+			else
+			{
+				const uint32_t step = m_kind[v] == KIND::BORDER ? 1 : 2;
+				for (uint32_t t = m_offset[v]; t < m_offset[v + 1]; ++t)
+				{
+					const uint32_t* triangle = &indices[m_adjacency[t] * 3];
+					const uint32_t corner = triangle[0] == v ? 0 : triangle[1] == v ? 1 : 2;
+					for (uint32_t c = 1; c < 3; c += step)
+					{
+						const uint32_t target = triangle[(corner + c) % 3];
+						if (IsValid(v, target))
+							m_candidates.push_back(Collapse{ v, target, 0.0f });
+					}
+				}
+			}
+
+			for (Collapse& candidate : m_candidates)
+				candidate.Cost = float(Evaluate(m_quadric[gs], m_quadric[m_group[candidate.Target]], m_vertices[candidate.Target].Position));
+			std::sort(m_candidates.begin(), m_candidates.end(), [](const Collapse& a, const Collapse& b) { return a.Cost < b.Cost; });
+
+			for (size_t i = 0; i < m_candidates.size(); ++i)
+			{
+				if (Prepare(indices.data(), m_candidates[i]))
+				{
+					m_pick[v]	= i == 0 ? PICK::CHEAPEST : m_pick[v];	// the cheapest target moves again
+					m_best[v]	= m_candidates[i];
+					m_dirty[v]	= i == 0 ? 0 : 1;	// only the cheapest target holds for the next pass
+					m_collapses.push_back(m_candidates[i]);
+					return;
+				}
+			}
+			m_pick[v] = PICK::NONE;
+		}
+
+		// Move source onto target unless a neighbor already changed or a triangle of its one ring flips
+		bool Apply(uint32_t* indices, const Collapse& collapse, size_t* removed)
+		{
+			const uint32_t gs = m_group[collapse.Source], gt = m_group[collapse.Target];
+			if (m_lockedGroup[gs] || m_lockedGroup[gt])
+				return false;
+
+			if (!Prepare(indices, collapse))
+			{
+				m_pick[collapse.Source] = IsRingLocked(indices, gs) ? PICK::CHEAPEST : PICK::CHECKED;
+				return false;
+			}
+
+			// Rings around both positions change, and the cost of every collapse onto the target
+			Touch(indices, gs);
+			Touch(indices, gt);
+			for (const std::pair<uint32_t, uint32_t>& move : m_moves)
+				Move(indices, move.first, move.second, removed);
+
+			// The line neighbor on the other side links to the target, its neighbors check the line again
+			uint32_t other = k_invalid;
+			if (m_kind[collapse.Source] == KIND::BORDER)
+				other = Relink(&m_link, gs, gt);
+			else if (m_kind[collapse.Source] == KIND::SEAM)
+				other = Relink(&m_seamLink, gs, gt);
+			if (other != k_invalid)
+				Touch(indices, other);
+
+			m_quadric[gt].Add(m_quadric[gs]);
+			return true;
+		}
+
+		// Vertex moves of a collapse into m_moves, false when one of them may not move
+		// A seam position moves all its vertices, each onto the target vertex on its own side of the seam
+		bool Prepare(const uint32_t* indices, const Collapse& collapse)
+		{
+			const uint32_t gs = m_group[collapse.Source], gt = m_group[collapse.Target];
+			m_moves.clear();
+			if (m_kind[collapse.Source] == KIND::SEAM)
+			{
+				for (uint32_t v = gs; v != k_invalid; v = m_groupNext[v])
+				{
+					if (m_offset[v] == m_offset[v + 1])
+						continue;
+
+					const uint32_t target = MatchTarget(indices, v, gt);
+					if (target == k_invalid)
+						return false;
+					m_moves.emplace_back(v, target);
+				}
+			}
+			else
+			{
+				m_moves.emplace_back(collapse.Source, collapse.Target);
+			}
+
+			const DirectX::XMFLOAT3& from	= m_vertices[gs].Position;
+			const DirectX::XMFLOAT3& to		= m_vertices[gt].Position;
+			for (const std::pair<uint32_t, uint32_t>& move : m_moves)
+			{
+				if (!CanMove(indices, move.first, gt, from, to))
+					return false;
+			}
+			return true;
+		}
+
+		// Vertices of the triangles around the position evaluate their collapse again
+		void Touch(const uint32_t* indices, const uint32_t g)
+		{
+			for (uint32_t v = g; v != k_invalid; v = m_groupNext[v])
+			{
+				for (uint32_t t = m_offset[v]; t < m_offset[v + 1]; ++t)
+				{
+					const uint32_t* triangle = &indices[m_adjacency[t] * 3];
+					for (uint32_t c = 0; c < 3; ++c)
+						m_dirty[triangle[c]] = 1;
+				}
+			}
+		}
+
+		// A triangle around the position was changed in this pass
+		bool IsRingLocked(const uint32_t* indices, const uint32_t gs) const
+		{
+			for (uint32_t v = gs; v != k_invalid; v = m_groupNext[v])
+			{
+				for (uint32_t t = m_offset[v]; t < m_offset[v + 1]; ++t)
+				{
+					const uint32_t* triangle = &indices[m_adjacency[t] * 3];
+					if (m_lockedGroup[m_group[triangle[0]]] || m_lockedGroup[m_group[triangle[1]]] || m_lockedGroup[m_group[triangle[2]]])
+						return true;
+				}
+			}
+			return false;
+		}
+
+		// No triangle of the one ring of source flips, becomes a sliver or was changed in this pass
+		bool CanMove(const uint32_t* indices, const uint32_t source, const uint32_t gt, const DirectX::XMFLOAT3& from, const DirectX::XMFLOAT3& to) const
+		{
+			for (uint32_t t = m_offset[source]; t < m_offset[source + 1]; ++t)
+			{
+				const uint32_t* triangle = &indices[m_adjacency[t] * 3];
+				uint32_t corner = 0;
+				bool collapsed = false;
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					if (m_lockedGroup[m_group[triangle[c]]])
+						return false;
+					if (m_group[triangle[c]] == gt)
+						collapsed = true;
+					if (triangle[c] == source)
+						corner = c;
+				}
+				if (collapsed)
+					continue;
+
+				const DirectX::XMFLOAT3& p1 = m_vertices[triangle[(corner + 1) % 3]].Position;
+				const DirectX::XMFLOAT3& p2 = m_vertices[triangle[(corner + 2) % 3]].Position;
+				const DirectX::XMFLOAT3 n0 = Normal(from, p1, p2);
+				const DirectX::XMFLOAT3 n1 = Normal(to, p1, p2);
+				const float dot = n0.x * n1.x + n0.y * n1.y + n0.z * n1.z;
+				const float lengthSq = (n0.x * n0.x + n0.y * n0.y + n0.z * n0.z) * (n1.x * n1.x + n1.y * n1.y + n1.z * n1.z);
+				if (dot <= 0.0f || dot * dot < k_flipCosine * k_flipCosine * lengthSq)
+					return false;
+
+				// Reject new slivers, e.g. three corners on a locked seam line, a thin triangle may stay as thin
+				const float edgeSq0 = (std::max)((std::max)(DistanceSq(from, p1), DistanceSq(from, p2)), DistanceSq(p1, p2));
+				const float edgeSq1 = (std::max)((std::max)(DistanceSq(to, p1), DistanceSq(to, p2)), DistanceSq(p1, p2));
+				const float areaSq0 = n0.x * n0.x + n0.y * n0.y + n0.z * n0.z;
+				const float areaSq1 = n1.x * n1.x + n1.y * n1.y + n1.z * n1.z;
+				if (areaSq1 < k_minSliver * k_minSliver * edgeSq1 * edgeSq1 && areaSq1 * edgeSq0 * edgeSq0 < areaSq0 * edgeSq1 * edgeSq1)
+					return false;
+			}
+			return true;
+		}
+
+		// Replace source by target, the one ring is locked, its triangles and quadrics are stale for the rest of the pass
+		void Move(uint32_t* indices, const uint32_t source, const uint32_t target, size_t* removed)
+		{
+			const uint32_t gt = m_group[target];
+			for (uint32_t t = m_offset[source]; t < m_offset[source + 1]; ++t)
+			{
+				uint32_t* triangle = &indices[m_adjacency[t] * 3];
+				bool collapsed = false;
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					m_lockedGroup[m_group[triangle[c]]] = 1;
+					collapsed |= m_group[triangle[c]] == gt;
+				}
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					if (triangle[c] == source)
+						triangle[c] = target;
+					if (m_pick[triangle[c]] == PICK::NONE)
+						m_pick[triangle[c]] = PICK::CHECKED;	// its one ring changed
+				}
+				*removed += collapsed ? 1 : 0;
+			}
+		}
+
+		// gs leaves its line, its two neighbors link to each other, returns the neighbor other than gt
+		static uint32_t Relink(std::vector<uint32_t>* links, const uint32_t gs, const uint32_t gt)
+		{
+			uint32_t* link	= &(*links)[gs * 2];
+			const uint32_t other = link[0] == gt ? link[1] : link[0];
+			for (uint32_t i = 0; i < 2; ++i)
+			{
+				if (other != k_invalid && (*links)[other * 2 + i] == gs)
+					(*links)[other * 2 + i] = gt;
+				if ((*links)[gt * 2 + i] == gs)
+					(*links)[gt * 2 + i] = other;
+			}
+			return other;
+		}
+
+	private:
+		const Vertex3D*						m_vertices;
+		size_t								m_vertexNum;
+		MeshSimplifier::Options				m_options;
+		std::vector<uint32_t>				m_group;		// first vertex at the same position
+		std::vector<uint32_t>				m_groupNext;	// next vertex at the same position
+		std::vector<KIND>					m_kind;			// per vertex
+		std::vector<uint32_t>				m_link;			// two border neighbors per group
+		std::vector<uint32_t>				m_seamLink;		// two seam neighbors per group
+		std::vector<Quadric>				m_quadric;		// per group
+		std::vector<uint8_t>				m_lockedGroup;	// touched in this pass
+		std::vector<PICK>					m_pick;			// per vertex
+		std::vector<uint8_t>				m_dirty;		// per vertex, m_best is stale
+		std::vector<Collapse>				m_best;			// per vertex, cheapest collapse of the last pass
+		std::vector<uint32_t>				m_offset;
+		std::vector<uint32_t>				m_adjacency;
+		std::vector<Collapse>				m_collapses;
+		std::vector<Collapse>				m_candidates;	// targets of one vertex
+		std::vector<std::pair<uint32_t, uint32_t>>	m_moves;	// source and target vertex of the collapse being applied
+	};
+}
+
+/* Simplify */
+float MeshSimplifier::Simplify(
+	const Vertex3D* vertices,
+	const size_t vertexNum,
+	const uint32_t* indices,
+	const size_t indexNum,
+	const Options& options,
+	std::vector<uint32_t>* output
+)
+{
+	output->assign(indices, indices + indexNum / 3 * 3);
+	if (vertexNum == 0 || output->empty())
+		return 0.0f;
+
+	Simplifier simplifier(vertices, vertexNum, options);
+	return simplifier.Run(output);
+}
+
+/* Build lods */
+void MeshSimplifier::BuildLods(LodMesh* mesh, const uint32_t levelNum, const float ratio)
+{
+	const uint32_t count = (std::min)((std::max)(levelNum, 1u), LodSelector::k_maxLevels);
+	mesh->Levels.clear();
+	mesh->Levels.push_back(LodLevel{ 0, uint32_t(mesh->Indices.size()), 0.0f });
+
+	std::vector<uint32_t> current(mesh->Indices);
+	std::vector<uint32_t> next;
+	float error = 0.0f;
+	for (uint32_t level = 1; level < count; ++level)
+	{
+		Options options;
+		options.TargetTriangleNum = size_t(double(current.size() / 3) * (std::min)((std::max)(ratio, 0.0f), 1.0f));
+
+		error += MeshSimplifier::Simplify(mesh->Vertices.data(), mesh->Vertices.size(), current.data(), current.size(), options, &next);
+		if (next.empty() || next.size() >= current.size())
+			break;
+
+		MeshOptimizer::OptimizeVertexCache(next.data(), next.size(), mesh->Vertices.size());
+		mesh->Levels.push_back(LodLevel{ uint32_t(mesh->Indices.size()), uint32_t(next.size()), error });
+		mesh->Indices.insert(mesh->Indices.end(), next.begin(), next.end());
+		current.swap(next);
+	}
+}
+
+/* Build lods batch */
+void MeshSimplifier::BuildLodsBatch(LodMesh* const* meshes, const size_t meshNum, const uint32_t levelNum, const float ratio)
+{
+	ThreadPool::Shared().ParallelFor(meshNum, [&](size_t index)
+	{
+		MeshSimplifier::BuildLods(meshes[index], levelNum, ratio);
+	});
+}
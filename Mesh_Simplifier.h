@@ -0,0 +1,83 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Mesh_Simplifier.h
+*		Detail	: Quadric error edge collapse simplification and LOD chain generation
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Mesh_Lod.h"
+
+class MeshSimplifier
+{
+public:
+	//**************************************************
+	/// \brief Stop conditions, whichever is reached first
+	//**************************************************
+	struct Options
+	{
+		size_t	TargetTriangleNum	= 0;		// 0 simplifies until TargetError
+		float	TargetError			= 1e30f;	// object space distance to the source surface
+		bool	LockBorder			= false;	// keep open boundaries exactly
+	};
+
+	static const float k_borderWeight;	// border quadric strength relative to faces
+
+public:
+	//**************************************************
+	/// \brief Half edge collapse driven by quadric error
+	///        Vertices are not moved or created, the result indexes the same vertices
+	///        Vertices on attribute seams (same position, other attributes) collapse together
+	///        along the seam, each onto the vertex of its own side, seam junctions are kept,
+	///        open borders only collapse along themselves, non manifold vertices are kept
+	///
+	/// \param[in]  vertices	 ->	vertex array
+	/// \param[in]  vertexNum	 ->	number of vertices
+	/// \param[in]  indices		 ->	triangle list
+	/// \param[in]  indexNum	 ->	number of indices
+	/// \param[in]  options		 ->	stop conditions
+	/// \param[out] output		 ->	simplified triangle list
+	///
+	/// \return largest collapse error (object space distance)
+	//**************************************************
+	static float Simplify(
+		const structure::Vertex3D* vertices,
+		const size_t vertexNum,
+		const uint32_t* indices,
+		const size_t indexNum,
+		const Options& options,
+		std::vector<uint32_t>* output
+	);
+
+	//**************************************************
+	/// \brief Append coarser levels to mesh->Indices and fill mesh->Levels
+	///        Each level is simplified from the previous one and cache optimized,
+	///        its error is the sum of the collapse errors so far
+	///
+	/// \param[in,out] mesh		 ->	Indices are level 0
+	/// \param[in]     levelNum	 ->	levels including level 0 (at most LodSelector::k_maxLevels)
+	/// \param[in]     ratio	 ->	triangle ratio between neighboring levels
+	///
+	/// \return none
+	//**************************************************
+	static void BuildLods(
+		structure::LodMesh* mesh,
+		const uint32_t levelNum,
+		const float ratio
+	);
+
+	//**************************************************
+	/// \brief BuildLods on ThreadPool::Shared, one mesh per job
+	///
+	/// \return none
+	//**************************************************
+	static void BuildLodsBatch(
+		structure::LodMesh* const* meshes,
+		const size_t meshNum,
+		const uint32_t levelNum,
+		const float ratio
+	);
+};
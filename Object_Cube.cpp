@@ -9,16 +9,26 @@
 
 #include "Object_Cube11.h"
 #include "Object_Cube12.h"
+#include "Object_CubeSoftware.h"
 
 #include "Object_Cube.h"
+using namespace DirectX;
+
+static const float k_rotateStep = XM_2PI / 240.0f;	// roll per simulation step (rad)
 
 /* Constructor */
 ObjectCube::ObjectCube()
 	:m_cube(nullptr),
 	m_position(),
 	m_rotate(),
-	m_scale()
+	m_scale(1.0f, 1.0f, 1.0f),
+	m_prevPosition(),
+	m_prevRotate(),
+	m_prevScale(1.0f, 1.0f, 1.0f)
 {
+#if GRAPHICS_BACKEND_STATIC
+	m_cube = new StaticCube();
+#else
 	switch (Application::Get())
 	{
 	case Application::USING_API_TYPE::DIRECTX_11:
@@ -27,9 +37,14 @@ ObjectCube::ObjectCube()
 	case Application::USING_API_TYPE::DIRECTX_12:
 		m_cube = new ObjectCube12();
 		break;
+	case Application::USING_API_TYPE::SOFTWARE:
+	case Application::USING_API_TYPE::NULL_DEVICE:
+		m_cube = new ObjectCubeSoftware();
+		break;
 	default:
 		break;
 	}
+#endif
 }
 
 /* Destructor */
@@ -55,11 +70,32 @@ void ObjectCube::Uninit()
 /* Update */
 void ObjectCube::Update()
 {
+	m_prevPosition	= m_position;
+	m_prevRotate	= m_rotate;
+	m_prevScale		= m_scale;
+
+	// Both states turn back together, the blend never crosses the wrap
+	m_rotate.z += k_rotateStep;
+	if (m_rotate.z > XM_2PI)
+	{
+		m_rotate.z		-= XM_2PI;
+		m_prevRotate.z	-= XM_2PI;
+	}
+
 	m_cube->Update();
 }
 
 /* Draw */
 void ObjectCube::Draw()
 {
+	// Rendered state lags the simulation by up to one step, motion stays smooth at any frame rate
+	const float alpha = Application::Interpolation();
+	const XMVECTOR position	= XMVectorLerp(XMLoadFloat3(&m_prevPosition), XMLoadFloat3(&m_position), alpha);
+	const XMVECTOR rotate	= XMVectorLerp(XMLoadFloat3(&m_prevRotate), XMLoadFloat3(&m_rotate), alpha);
+	const XMVECTOR scale	= XMVectorLerp(XMLoadFloat3(&m_prevScale), XMLoadFloat3(&m_scale), alpha);
+
+	XMFLOAT4X4 world;
+	XMStoreFloat4x4(&world, XMMatrixScalingFromVector(scale) * XMMatrixRotationRollPitchYawFromVector(rotate) * XMMatrixTranslationFromVector(position));
+	m_cube->SetWorld(world);
 	m_cube->Draw();
 }
@@ -5,6 +5,7 @@
 *		Detail	:
 ===================================================================================*/
 #pragma once
+#include "Graphics_Backend.h"
 #include "Object_Interface.h"
 
 class ICube;
@@ -41,23 +42,26 @@ public:
 	void Uninit()	override;
 	
 	//**************************************************
-	/// \brief Update cube
+	/// \brief Update cube, one fixed simulation step
 	/// 
 	/// \return none
 	//**************************************************
 	void Update()	override;
 
 	//**************************************************
-	/// \brief Draw cube
+	/// \brief Draw cube between the last two steps by Application::Interpolation
 	/// 
 	/// \return none
 	//**************************************************
 	void Draw()		override;
 
 private:
-	IObject*			m_cube;
+	StaticCube*			m_cube;		// IObject unless the backend is fixed at compile time
 	DirectX::XMFLOAT3	m_position;
 	DirectX::XMFLOAT3	m_rotate;
 	DirectX::XMFLOAT3	m_scale;
+	DirectX::XMFLOAT3	m_prevPosition;	// state before the last step
+	DirectX::XMFLOAT3	m_prevRotate;
+	DirectX::XMFLOAT3	m_prevScale;
 };
 
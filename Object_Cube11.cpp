@@ -8,6 +8,7 @@
 
 #include "Object_Cube11.h"
 using namespace structure;
+using namespace DirectX;
 
 const Vertex3D g_sprite[]
 {
@@ -17,7 +18,7 @@ const Vertex3D g_sprite[]
 	{{ 0.5f,  0.5f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f}},
 };
 
-const unsigned int g_spriteIndex[]
+const unsigned short g_spriteIndex[]	// 16 bit, less than 65536 vertices
 {
 	0, 1, 3,
 	2, 3, 0
@@ -26,11 +27,10 @@ const unsigned int g_spriteIndex[]
 /* Initialize */
 bool ObjectCube11::Init()
 {
-	if (!m_vertexBuffer)
+	GraphicsDirectX11* graphics = (GraphicsDirectX11*)Application::Graphics();
+	if (!graphics->Buffer(m_vertexBuffer))
 	{
-		HRESULT ret{};
-		ID3D11Device* device = (ID3D11Device*)Application::Graphics()->Device();
-		if (!device)
+		if (!graphics->Device())
 			return false;
 
 		{// Create vertex buffer
@@ -41,33 +41,38 @@ bool ObjectCube11::Init()
 
 			D3D11_SUBRESOURCE_DATA subResource{};
 			subResource.pSysMem = g_sprite;
-			ret = device->CreateBuffer(&bufferDesc, &subResource, &m_vertexBuffer);
-			if (FAILED(ret))
+			m_vertexBuffer = graphics->CreatePooledBuffer(bufferDesc, &subResource, GraphicsMemory::CATEGORY::GEOMETRY, "ObjectCube11::VertexBuffer");
+			if (!m_vertexBuffer.IsValid())
 				return false;
 		}
 
 		{// Create Index buffer
 			D3D11_BUFFER_DESC bufferDesc{};
-			bufferDesc.ByteWidth	= sizeof(unsigned int) * 6;
+			bufferDesc.ByteWidth	= sizeof(g_spriteIndex);
 			bufferDesc.Usage		= D3D11_USAGE::D3D11_USAGE_DEFAULT;
 			bufferDesc.BindFlags	= D3D11_BIND_FLAG::D3D11_BIND_INDEX_BUFFER;
 
 			D3D11_SUBRESOURCE_DATA subResource{};
 			subResource.pSysMem = g_spriteIndex;
-			ret = device->CreateBuffer(&bufferDesc, &subResource, &m_indexBuffer);
-			if (FAILED(ret))
+			m_indexBuffer = graphics->CreatePooledBuffer(bufferDesc, &subResource, GraphicsMemory::CATEGORY::GEOMETRY, "ObjectCube11::IndexBuffer");
+			if (!m_indexBuffer.IsValid())
 				return false;
 		}
 	}
 
+	XMStoreFloat4x4(&m_world, XMMatrixIdentity());
+
 	return true;
 }
 
 /* Uninitialize */
 void ObjectCube11::Uninit()
 {
-	SAFE_RELEASE(m_indexBuffer);
-	SAFE_RELEASE(m_vertexBuffer);
+	GraphicsDirectX11* graphics = (GraphicsDirectX11*)Application::Graphics();
+	graphics->ReleaseBuffer(m_indexBuffer);
+	graphics->ReleaseBuffer(m_vertexBuffer);
+	m_indexBuffer	= GraphicsDirectX11::BufferHandle{};
+	m_vertexBuffer	= GraphicsDirectX11::BufferHandle{};
 }
 
 /* Update */
@@ -78,13 +83,23 @@ void ObjectCube11::Update()
 /* Draw */
 void ObjectCube11::Draw()
 {
-	ID3D11DeviceContext* context = (ID3D11DeviceContext*)Application::Graphics()->Context();
+	GraphicsDirectX11* graphics = (GraphicsDirectX11*)Application::Graphics();
+	ID3D11DeviceContext* context = (ID3D11DeviceContext*)graphics->Context();
 
+	// Stale handles give nullptr, which unbinds instead of touching a released buffer
+	ID3D11Buffer* vertexBuffer = graphics->Buffer(m_vertexBuffer);
 	UINT stride = sizeof(Vertex3D);
 	UINT offset = 0;
-	context->IASetVertexBuffers(0, 1, &m_vertexBuffer, &stride, &offset);
-	context->IASetIndexBuffer(m_indexBuffer, DXGI_FORMAT::DXGI_FORMAT_R32_UINT, 0);
+	context->IASetVertexBuffers(0, 1, &vertexBuffer, &stride, &offset);
+	context->IASetIndexBuffer(graphics->Buffer(m_indexBuffer), DXGI_FORMAT::DXGI_FORMAT_R16_UINT, 0);
 
 	context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY::D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	graphics->SetObjectConstants(m_world, XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f));
 	context->DrawIndexed(6, 0, 0);
 }
+
+/* Set world matrix */
+void ObjectCube11::SetWorld(const XMFLOAT4X4& world)
+{
+	m_world = world;
+}
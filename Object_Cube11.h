@@ -8,7 +8,7 @@
 #include "Graphics_DirectX11.h"
 #include "Object_Interface.h"
 
-class ObjectCube11 : public IObject
+class ObjectCube11 final : public IObject
 {
 public:
 	//**************************************************
@@ -39,8 +39,18 @@ public:
 	//**************************************************
 	void Draw()		override;
 
+	//**************************************************
+	/// \brief Set world matrix of the next Draw
+	/// 
+	/// \param[in] world	 ->	world matrix
+	/// 
+	/// \return none
+	//**************************************************
+	void SetWorld(const DirectX::XMFLOAT4X4& world) override;
+
 private:
-	ID3D11Buffer* m_vertexBuffer;
-	ID3D11Buffer* m_indexBuffer;
+	GraphicsDirectX11::BufferHandle	m_vertexBuffer;
+	GraphicsDirectX11::BufferHandle	m_indexBuffer;
+	DirectX::XMFLOAT4X4	m_world;
 };
 
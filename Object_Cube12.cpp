@@ -19,7 +19,7 @@ const Vertex3D g_sprite[]
 	{{ 0.5f,  0.5f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f}},
 };
 
-const unsigned int g_spriteIndex[]
+const unsigned short g_spriteIndex[]	// 16 bit, less than 65536 vertices
 {
 	0, 1, 3,
 	2, 3, 0
@@ -29,7 +29,7 @@ const unsigned int g_spriteIndex[]
 bool ObjectCube12::Init()
 {
 	HRESULT ret{};
-	ID3D12Device* device = (ID3D12Device*)Application::Graphics()->Device();
+	GraphicsDirectX12* graphics = (GraphicsDirectX12*)Application::Graphics();
 
 	D3D12_HEAP_PROPERTIES heapProperties{};
 	heapProperties.Type					= D3D12_HEAP_TYPE::D3D12_HEAP_TYPE_UPLOAD;
@@ -47,60 +47,49 @@ bool ObjectCube12::Init()
 	resourceDesc.Flags				= D3D12_RESOURCE_FLAGS::D3D12_RESOURCE_FLAG_NONE;
 	resourceDesc.Layout				= D3D12_TEXTURE_LAYOUT::D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
 
-	ret = device->CreateCommittedResource(
-		&heapProperties,
-		D3D12_HEAP_FLAGS::D3D12_HEAP_FLAG_NONE,
-		&resourceDesc,
+	m_vertexBuffer = graphics->CreatePooledResource(
+		heapProperties,
+		resourceDesc,
 		D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_GENERIC_READ,
 		nullptr,
-		__uuidof(ID3D12Resource),
-		(void**)&m_vertexBuffer
+		GraphicsMemory::CATEGORY::GEOMETRY,
+		"ObjectCube12::VertexBuffer"
 	);
-	if (FAILED(ret))
+	if (!m_vertexBuffer.IsValid())
 		return false;
 
 	resourceDesc.Width	= sizeof(g_spriteIndex);
-	ret = device->CreateCommittedResource(
-		&heapProperties,
-		D3D12_HEAP_FLAGS::D3D12_HEAP_FLAG_NONE,
-		&resourceDesc,
-		D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_GENERIC_READ,
-		nullptr,
-		__uuidof(ID3D12Resource),
-		(void**)&m_indexBuffer
-	);
-	if (FAILED(ret))
-		return false;
-
-	// Create constant buffer
-	resourceDesc.Width = (sizeof(XMMATRIX) + 0xff) & ~0xff;
-	ret = device->CreateCommittedResource(
-		&heapProperties,
-		D3D12_HEAP_FLAGS::D3D12_HEAP_FLAG_NONE,
-		&resourceDesc,
+	m_indexBuffer = graphics->CreatePooledResource(
+		heapProperties,
+		resourceDesc,
 		D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_GENERIC_READ,
 		nullptr,
-		__uuidof(ID3D12Resource),
-		(void**)&m_worldBuffer
+		GraphicsMemory::CATEGORY::GEOMETRY,
+		"ObjectCube12::IndexBuffer"
 	);
-	if (FAILED(ret))
+	if (!m_indexBuffer.IsValid())
 		return false;
 
+	ID3D12Resource* vertexBuffer = graphics->Resource(m_vertexBuffer);
 	Vertex3D* vertexMap;
-	ret = m_vertexBuffer->Map(0, nullptr, (void**)&vertexMap);
+	ret = vertexBuffer->Map(0, nullptr, (void**)&vertexMap);
 	if (FAILED(ret))
 		return false;
 	
 	std::copy(std::begin(g_sprite), std::end(g_sprite), vertexMap);
-	m_vertexBuffer->Unmap(0, nullptr);
+	vertexBuffer->Unmap(0, nullptr);
 
-	unsigned int* indexMap;
-	ret = m_indexBuffer->Map(0, nullptr, (void**)&indexMap);
+	ID3D12Resource* indexBuffer = graphics->Resource(m_indexBuffer);
+	unsigned short* indexMap;
+	ret = indexBuffer->Map(0, nullptr, (void**)&indexMap);
 	if (FAILED(ret))
 		return false;
 
 	std::copy(std::begin(g_spriteIndex), std::end(g_spriteIndex), indexMap);
-	m_indexBuffer->Unmap(0, nullptr);
+	indexBuffer->Unmap(0, nullptr);
+
+	// World and color go through the backend upload ring, no buffer per object
+	XMStoreFloat4x4(&m_world, XMMatrixIdentity());
 
 	return true;
 }
@@ -108,8 +97,12 @@ bool ObjectCube12::Init()
 /* Uninitialize */
 void ObjectCube12::Uninit()
 {
-	SAFE_RELEASE(m_vertexBuffer);
-	SAFE_RELEASE(m_indexBuffer);
+	// The last frames may still read the buffers, the pool defers the release
+	GraphicsDirectX12* graphics = (GraphicsDirectX12*)Application::Graphics();
+	graphics->ReleaseResource(m_vertexBuffer);
+	graphics->ReleaseResource(m_indexBuffer);
+	m_vertexBuffer	= GraphicsDirectX12::ResourceHandle{};
+	m_indexBuffer	= GraphicsDirectX12::ResourceHandle{};
 }
 
 /* Update */
@@ -120,20 +113,32 @@ void ObjectCube12::Update()
 /* Draw */
 void ObjectCube12::Draw()
 {
-	ID3D12GraphicsCommandList* context = (ID3D12GraphicsCommandList*)Application::Graphics()->Context();
+	GraphicsDirectX12* graphics = (GraphicsDirectX12*)Application::Graphics();
+	ID3D12GraphicsCommandList* context = (ID3D12GraphicsCommandList*)graphics->Context();
+	ID3D12Resource* vertexBuffer = graphics->Resource(m_vertexBuffer);
+	ID3D12Resource* indexBuffer = graphics->Resource(m_indexBuffer);
+	if (!vertexBuffer || !indexBuffer)
+		return;
 
 	D3D12_VERTEX_BUFFER_VIEW bufferView{};
-	bufferView.BufferLocation	= m_vertexBuffer->GetGPUVirtualAddress();
+	bufferView.BufferLocation	= vertexBuffer->GetGPUVirtualAddress();
 	bufferView.SizeInBytes		= sizeof(g_sprite);
 	bufferView.StrideInBytes	= sizeof(Vertex3D);
 
 	D3D12_INDEX_BUFFER_VIEW indexView{};
-	indexView.BufferLocation	= m_indexBuffer->GetGPUVirtualAddress();
-	indexView.Format			= DXGI_FORMAT::DXGI_FORMAT_R32_UINT;
+	indexView.BufferLocation	= indexBuffer->GetGPUVirtualAddress();
+	indexView.Format			= DXGI_FORMAT::DXGI_FORMAT_R16_UINT;
 	indexView.SizeInBytes		= sizeof(g_spriteIndex);
 
 	context->IASetVertexBuffers(0, 1, &bufferView);
 	context->IASetIndexBuffer(&indexView);
 	context->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY::D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	graphics->SetObjectConstants(m_world, XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f));
 	context->DrawIndexedInstanced(6, 1, 0, 0, 0);
 }
+
+/* Set world matrix */
+void ObjectCube12::SetWorld(const XMFLOAT4X4& world)
+{
+	m_world = world;
+}
@@ -8,7 +8,7 @@
 #include "Graphics_DirectX12.h"
 #include "Object_Interface.h"
 
-class ObjectCube12 : public IObject
+class ObjectCube12 final : public IObject
 {
 public:
 	//**************************************************
@@ -39,9 +39,18 @@ public:
 	//**************************************************
 	void Draw()		override;
 
+	//**************************************************
+	/// \brief Set world matrix of the next Draw
+	/// 
+	/// \param[in] world	 ->	world matrix
+	/// 
+	/// \return none
+	//**************************************************
+	void SetWorld(const DirectX::XMFLOAT4X4& world) override;
+
 private:
-	ID3D12Resource*	m_vertexBuffer;
-	ID3D12Resource* m_indexBuffer;
-	ID3D12DescriptorHeap*	m_worldBuffer;
+	GraphicsDirectX12::ResourceHandle	m_vertexBuffer;
+	GraphicsDirectX12::ResourceHandle	m_indexBuffer;
+	DirectX::XMFLOAT4X4	m_world;
 };
 
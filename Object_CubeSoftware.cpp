@@ -0,0 +1,67 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Object_CubeSoftware.cpp
+*		Detail	:
+===================================================================================*/
+#include "Application.h"
+#include "Graphics_Backend.h"
+#include "Graphics_Null.h"
+#include "Graphics_Software.h"
+
+#include "Object_CubeSoftware.h"
+using namespace structure;
+using namespace DirectX;
+
+const Vertex3D g_sprite[]
+{
+	{{-0.5f, -0.5f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f}},
+	{{ 0.5f, -0.5f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f}},
+	{{-0.5f,  0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f}},
+	{{ 0.5f,  0.5f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f}},
+};
+
+const unsigned short g_spriteIndex[]	// 16 bit, less than 65536 vertices
+{
+	0, 1, 3,
+	2, 3, 0
+};
+
+/* Initialize */
+bool ObjectCubeSoftware::Init()
+{
+	// Vertex data stays in system memory, nothing to upload
+	XMStoreFloat4x4(&m_world, XMMatrixIdentity());
+
+	return true;
+}
+
+/* Uninitialize */
+void ObjectCubeSoftware::Uninit()
+{
+}
+
+/* Update */
+void ObjectCubeSoftware::Update()
+{
+}
+
+/* Draw */
+void ObjectCubeSoftware::Draw()
+{
+	// Concrete context of a fixed cpu backend, the draw calls below bind directly
+	StaticContext* context = static_cast<StaticContext*>((ICommandContext*)Application::Graphics()->Context());
+	if (!context)
+		return;
+
+	context->SetVertexBuffer(g_sprite, _countof(g_sprite));
+	context->SetIndexBuffer(g_spriteIndex, _countof(g_spriteIndex));
+	context->SetWorldMatrix(m_world);
+	context->DrawIndexed(_countof(g_spriteIndex), 0, 0);
+}
+
+/* Set world matrix */
+void ObjectCubeSoftware::SetWorld(const XMFLOAT4X4& world)
+{
+	m_world = world;
+}
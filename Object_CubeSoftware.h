@@ -0,0 +1,54 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Object_CubeSoftware.h
+*		Detail	:
+===================================================================================*/
+#pragma once
+#include "Graphics_CommandContext.h"
+#include "Object_Interface.h"
+
+class ObjectCubeSoftware final : public IObject
+{
+public:
+	//**************************************************
+	/// \brief Initialize cube use cpu backend (software or null)
+	/// 
+	/// \return Success is true
+	//**************************************************
+	bool Init()		override;
+
+	//**************************************************
+	/// \brief Uninitialize cube
+	/// 
+	/// \return none
+	//**************************************************
+	void Uninit()	override;
+
+	//**************************************************
+	/// \brief Update cube
+	/// 
+	/// \return none
+	//**************************************************
+	void Update()	override;
+
+	//**************************************************
+	/// \brief Draw cube
+	/// 
+	/// \return none
+	//**************************************************
+	void Draw()		override;
+
+	//**************************************************
+	/// \brief Set world matrix of the next Draw
+	/// 
+	/// \param[in] world	 ->	world matrix
+	/// 
+	/// \return none
+	//**************************************************
+	void SetWorld(const DirectX::XMFLOAT4X4& world) override;
+
+private:
+	DirectX::XMFLOAT4X4	m_world;
+};
+
@@ -5,6 +5,8 @@
 *		Detail	:
 ===================================================================================*/
 #pragma once
+#include <DirectXMath.h>
+
 class IObject
 {
 public:
@@ -13,6 +15,7 @@ public:
 	virtual void Uninit()	= 0;
 	virtual void Update()	= 0;
 	virtual void Draw()		= 0;
+	virtual void SetWorld(const DirectX::XMFLOAT4X4& world) { (void)world; }	// placed by the owner, used by the next Draw
 };
 
 
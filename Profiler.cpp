@@ -0,0 +1,298 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Profiler.cpp
+*		Detail	: Scoped cpu markers, gpu timestamps, chrome trace export
+===================================================================================*/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Profiler.h"
+
+namespace
+{
+	const uint32_t	k_ringCapacity	= 8192;	// events per thread between two NextFrame (power of two)
+	const uint32_t	k_summaryFrames	= 120;	// frames of rolling summary
+
+	//**************************************************
+	/// \brief Completed marker
+	//**************************************************
+	struct Event
+	{
+		const char*	Name;
+		uint64_t	Begin;
+		uint64_t	End;
+		uint32_t	ThreadId;
+		bool		Gpu;
+	};
+
+	//**************************************************
+	/// \brief Single producer (owner thread) / single consumer (NextFrame) ring
+	//**************************************************
+	struct ThreadBuffer
+	{
+		Event					Events[k_ringCapacity];
+		std::atomic<uint32_t>	Head{ 0 };		// written by owner thread
+		std::atomic<uint32_t>	Tail{ 0 };		// written by consumer
+		std::atomic<uint64_t>	Dropped{ 0 };	// events lost because the ring was full
+		uint32_t				ThreadId = 0;
+	};
+
+	//**************************************************
+	/// \brief Rolling statistics of one name
+	//**************************************************
+	struct SummaryEntry
+	{
+		float		History[k_summaryFrames];	// inclusive ms per frame
+		uint32_t	CallHistory[k_summaryFrames];
+		double		FrameTime	= 0.0;			// accumulation of current frame (ms)
+		uint32_t	FrameCalls	= 0;
+		bool		Gpu			= false;
+	};
+
+	struct ProfilerState
+	{
+		std::mutex										Mutex;			// guards everything below
+		std::vector<ThreadBuffer*>						Buffers;
+		std::unordered_map<const char*, SummaryEntry>	Summary;
+		std::vector<Event>								Captured;
+		bool											Capturing	= false;
+		uint64_t										FrameIndex	= 0;
+		uint32_t										NextThreadId = 1;
+		std::atomic<uint32_t>							Generation{ 0 };	// advanced by Shutdown, outside the mutex for the marker path
+	};
+
+	ProfilerState& State()
+	{
+		static ProfilerState state;
+		return state;
+	}
+
+	thread_local ThreadBuffer*	t_buffer		= nullptr;
+	thread_local uint32_t		t_generation	= 0;	// Generation t_buffer was registered in
+
+	//**************************************************
+	/// \brief Ring of calling thread, registered on first use and
+	///        again after Shutdown released the buffers of every thread
+	//**************************************************
+	ThreadBuffer* GetThreadBuffer()
+	{
+		ProfilerState& state = State();
+		const uint32_t generation = state.Generation.load(std::memory_order_acquire);
+		if (t_buffer && t_generation == generation)
+			return t_buffer;
+
+		std::lock_guard<std::mutex> lock(state.Mutex);
+		t_buffer			= new ThreadBuffer();
+		t_buffer->ThreadId	= state.NextThreadId++;
+		t_generation		= state.Generation.load(std::memory_order_relaxed);
+		state.Buffers.push_back(t_buffer);
+		return t_buffer;
+	}
+
+	//**************************************************
+	/// \brief Push event, drop it when consumer is behind (never blocks)
+	//**************************************************
+	void Push(const char* name, const uint64_t begin, const uint64_t end, const bool gpu)
+	{
+		ThreadBuffer* buffer = GetThreadBuffer();
+		uint32_t head = buffer->Head.load(std::memory_order_relaxed);
+		uint32_t tail = buffer->Tail.load(std::memory_order_acquire);
+		if (head - tail >= k_ringCapacity)
+		{
+			buffer->Dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		Event& event	= buffer->Events[head & (k_ringCapacity - 1)];
+		event.Name		= name;
+		event.Begin		= begin;
+		event.End		= end;
+		event.ThreadId	= buffer->ThreadId;
+		event.Gpu		= gpu;
+		buffer->Head.store(head + 1, std::memory_order_release);
+	}
+}
+
+/* Now */
+uint64_t Profiler::Now()
+{
+	return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/* Record cpu scope */
+void Profiler::Record(const char* name, const uint64_t begin, const uint64_t end)
+{
+	Push(name, begin, end, false);
+}
+
+/* Record gpu interval */
+void Profiler::RecordGpu(const char* name, const uint64_t begin, const uint64_t duration)
+{
+	Push(name, begin, begin + duration, true);
+}
+
+/* Next frame */
+void Profiler::NextFrame()
+{
+	ProfilerState& state = State();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+
+	for (ThreadBuffer* buffer : state.Buffers)
+	{
+		uint32_t tail = buffer->Tail.load(std::memory_order_relaxed);
+		uint32_t head = buffer->Head.load(std::memory_order_acquire);
+		for (; tail != head; ++tail)
+		{
+			const Event& event = buffer->Events[tail & (k_ringCapacity - 1)];
+
+			SummaryEntry& entry = state.Summary[event.Name];
+			entry.FrameTime += double(event.End - event.Begin) * 1e-6;
+			entry.FrameCalls++;
+			entry.Gpu = event.Gpu;
+
+			if (state.Capturing)
+				state.Captured.push_back(event);
+		}
+		buffer->Tail.store(tail, std::memory_order_release);
+	}
+
+	const uint32_t slot = uint32_t(state.FrameIndex % k_summaryFrames);
+	for (auto& pair : state.Summary)
+	{
+		SummaryEntry& entry			= pair.second;
+		entry.History[slot]			= float(entry.FrameTime);
+		entry.CallHistory[slot]		= entry.FrameCalls;
+		entry.FrameTime				= 0.0;
+		entry.FrameCalls			= 0;
+	}
+	++state.FrameIndex;
+}
+
+/* Start capture */
+void Profiler::StartCapture()
+{
+	ProfilerState& state = State();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+	state.Captured.clear();
+	state.Capturing = true;
+}
+
+/* Stop capture */
+bool Profiler::StopCapture(const char* fileName)
+{
+	Profiler::NextFrame();	// flush pending events
+
+	ProfilerState& state = State();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+	state.Capturing = false;
+
+	FILE* file = std::fopen(fileName, "w");
+	if (!file)
+		return false;
+
+	// Chrome trace event format, complete events ("X") in microseconds
+	const uint64_t origin = state.Captured.empty() ? 0 : std::min_element(
+		state.Captured.begin(), state.Captured.end(),
+		[](const Event& a, const Event& b) { return a.Begin < b.Begin; })->Begin;
+
+	std::fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+	std::fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"GPU\"}}");
+	for (const Event& event : state.Captured)
+	{
+		std::fprintf(
+			file,
+			",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+			event.Name,
+			event.Gpu ? "gpu" : "cpu",
+			event.Gpu ? 0u : event.ThreadId,
+			double(event.Begin - origin) * 1e-3,
+			double(event.End - event.Begin) * 1e-3
+		);
+	}
+	std::fprintf(file, "\n]}\n");
+	std::fclose(file);
+
+	state.Captured.clear();
+	state.Captured.shrink_to_fit();
+	return true;
+}
+
+/* Get summary */
+size_t Profiler::GetSummary(Summary* summaries, const size_t capacity)
+{
+	ProfilerState& state = State();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+
+	const uint32_t frameNum = uint32_t((std::min)(state.FrameIndex, uint64_t(k_summaryFrames)));
+	size_t count = 0;
+	for (const auto& pair : state.Summary)
+	{
+		if (count < capacity && frameNum > 0)
+		{
+			const SummaryEntry& entry = pair.second;
+			double total = 0.0, maximum = 0.0, calls = 0.0;
+			for (uint32_t i = 0; i < frameNum; ++i)
+			{
+				total	+= entry.History[i];
+				maximum	= (std::max)(maximum, double(entry.History[i]));
+				calls	+= entry.CallHistory[i];
+			}
+
+			Summary& summary		= summaries[count];
+			summary.Name			= pair.first;
+			summary.AverageMs		= total / frameNum;
+			summary.MaximumMs		= maximum;
+			summary.CallsPerFrame	= calls / frameNum;
+			summary.Gpu				= entry.Gpu;
+		}
+		++count;
+	}
+	return count;
+}
+
+/* Measure scope cost */
+double Profiler::MeasureScopeCost(const unsigned int iterations)
+{
+	Profiler::NextFrame();
+
+	uint64_t elapsed = 0;
+	unsigned int remaining = iterations;
+	while (remaining > 0)
+	{// Stay below ring capacity so no event is dropped (drop path is cheaper)
+		unsigned int batch = (std::min)(remaining, k_ringCapacity / 2);
+		uint64_t begin = Profiler::Now();
+		for (unsigned int i = 0; i < batch; ++i)
+		{
+			ProfileScope scope("Profiler::MeasureScopeCost");
+		}
+		elapsed += Profiler::Now() - begin;
+		remaining -= batch;
+
+		Profiler::NextFrame();
+	}
+
+	return iterations ? double(elapsed) / double(iterations) : 0.0;
+}
+
+/* Shutdown */
+void Profiler::Shutdown()
+{
+	ProfilerState& state = State();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+	for (ThreadBuffer* buffer : state.Buffers)
+		delete buffer;
+
+	// Other threads still hold their t_buffer, the generation makes them register a new one
+	state.Generation.fetch_add(1, std::memory_order_release);
+	state.Buffers.clear();
+	state.Summary.clear();
+	state.Captured.clear();
+	state.FrameIndex = 0;	// summary starts over
+	t_buffer = nullptr;
+}
@@ -0,0 +1,156 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Profiler.h
+*		Detail	: Scoped cpu markers, gpu timestamps, chrome trace export
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+//**************************************************
+/// \brief Markers are compiled out in release builds,
+///        define PROFILER_ENABLE=1 to keep them
+//**************************************************
+#if !defined(PROFILER_ENABLE)
+#if defined(_DEBUG)
+#define PROFILER_ENABLE 1
+#else
+#define PROFILER_ENABLE 0
+#endif
+#endif
+
+#define PROFILE_CONCAT_INNER(a, b)	a##b
+#define PROFILE_CONCAT(a, b)		PROFILE_CONCAT_INNER(a, b)
+
+#if PROFILER_ENABLE
+#define PROFILE_SCOPE(name)	ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define PROFILE_FRAME()		Profiler::NextFrame()
+#else
+#define PROFILE_SCOPE(name)	(void)0
+#define PROFILE_FRAME()		(void)0
+#endif
+
+class Profiler
+{
+public:
+	//**************************************************
+	/// \brief Rolling statistics of one marker name
+	//**************************************************
+	struct Summary
+	{
+		const char*	Name;
+		double		AverageMs;		// inclusive time per frame
+		double		MaximumMs;
+		double		CallsPerFrame;
+		bool		Gpu;			// measured by gpu timestamps
+	};
+
+public:
+	//**************************************************
+	/// \brief Current time of the profiler clock
+	///
+	/// \return nanoseconds
+	//**************************************************
+	static uint64_t Now();
+
+	//**************************************************
+	/// \brief Drain thread buffers, update summary and capture
+	///
+	/// \return none
+	//**************************************************
+	static void NextFrame();
+
+	//**************************************************
+	/// \brief Record scope of the calling thread, used by ProfileScope
+	///
+	/// \param[in] name		 ->	marker name, must be a string literal
+	/// \param[in] begin	 ->	begin time (ns)
+	/// \param[in] end		 ->	end time (ns)
+	///
+	/// \return none
+	//**************************************************
+	static void Record(
+		const char* name,
+		const uint64_t begin,
+		const uint64_t end
+	);
+
+	//**************************************************
+	/// \brief Record gpu interval resolved from timestamp queries
+	///
+	/// \param[in] name		 ->	marker name, must be a string literal
+	/// \param[in] begin	 ->	begin time on the profiler clock (ns)
+	/// \param[in] duration	 ->	gpu duration (ns)
+	///
+	/// \return none
+	//**************************************************
+	static void RecordGpu(
+		const char* name,
+		const uint64_t begin,
+		const uint64_t duration
+	);
+
+	//**************************************************
+	/// \brief Start keeping every event for trace export
+	///
+	/// \return none
+	//**************************************************
+	static void StartCapture();
+
+	//**************************************************
+	/// \brief Stop capture and write chrome trace / perfetto json
+	///
+	/// \param[in] fileName	 ->	output file
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool StopCapture(const char* fileName);
+
+	//**************************************************
+	/// \brief Copy rolling summary
+	///
+	/// \param[out] summaries ->	destination array
+	/// \param[in]  capacity  ->	destination array size
+	///
+	/// \return number of marker names (may exceed capacity)
+	//**************************************************
+	static size_t GetSummary(
+		Summary* summaries,
+		const size_t capacity
+	);
+
+	//**************************************************
+	/// \brief Measure cost of one marker
+	///
+	/// \param[in] iterations	 ->	number of scopes to record
+	///
+	/// \return nanoseconds per scope
+	//**************************************************
+	static double MeasureScopeCost(const unsigned int iterations);
+
+	//**************************************************
+	/// \brief Release all thread buffers, no marker may run during the call,
+	///        threads recording afterwards get a new buffer
+	///
+	/// \return none
+	//**************************************************
+	static void Shutdown();
+};
+
+//**************************************************
+/// \brief Record time between construction and destruction
+//**************************************************
+class ProfileScope
+{
+public:
+	explicit ProfileScope(const char* name) : m_name(name), m_begin(Profiler::Now()) {}
+	~ProfileScope() { Profiler::Record(m_name, m_begin, Profiler::Now()); }
+
+	ProfileScope(const ProfileScope&)				= delete;
+	ProfileScope& operator=(const ProfileScope&)	= delete;
+
+private:
+	const char*	m_name;
+	uint64_t	m_begin;
+};
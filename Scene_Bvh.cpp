@@ -0,0 +1,661 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Scene_Bvh.cpp
+*		Detail	: Bounding volume hierarchy over object bounds for culling and picking
+===================================================================================*/
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <functional>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define SCENE_BVH_SSE
+#endif
+
+#include "Scene_Bvh.h"
+#include "Thread_Pool.h"
+using namespace structure;
+
+const uint32_t	SceneBvh::k_invalid;
+const uint32_t	SceneBvh::k_leafSize;
+const uint32_t	SceneBvh::k_binNum;
+const float		SceneBvh::k_rebuildRatio = 1.5f;
+
+namespace
+{
+	const float		k_traversalCost		= 1.0f;		// SAH cost of an interior node relative to one box test
+	const uint32_t	k_medianDepth		= 56;		// deeper nodes split at the median, depth stays below 56 + 32
+	const uint32_t	k_stackSize			= 96;
+	const size_t	k_rayBatch			= 64;		// rays per ThreadPool job
+	const size_t	k_scanFraction		= 16;		// dirty nodes above 1/n of the tree are found by scanning
+
+	//**************************************************
+	/// \brief Six frustum planes in structure of arrays, padded to eight by repeating
+	///        A box is outside when center distance + projected extent < 0 for any plane
+	//**************************************************
+	struct alignas(16) Frustum
+	{
+		float	X[8];
+		float	Y[8];
+		float	Z[8];
+		float	W[8];
+		float	AbsX[8];
+		float	AbsY[8];
+		float	AbsZ[8];
+	};
+
+	enum class OVERLAP : uint8_t
+	{
+		OUTSIDE,
+		PARTIAL,
+		INSIDE,
+		NUM
+	};
+
+	// Planes from the columns of a row vector matrix, clip z in [0, 1]
+	void ExtractFrustum(const DirectX::XMFLOAT4X4& m, Frustum* frustum)
+	{
+		const float planes[6][4] =
+		{
+			{ m._14 + m._11, m._24 + m._21, m._34 + m._31, m._44 + m._41 },	// left
+			{ m._14 - m._11, m._24 - m._21, m._34 - m._31, m._44 - m._41 },	// right
+			{ m._14 + m._12, m._24 + m._22, m._34 + m._32, m._44 + m._42 },	// bottom
+			{ m._14 - m._12, m._24 - m._22, m._34 - m._32, m._44 - m._42 },	// top
+			{ m._13, m._23, m._33, m._43 },									// near
+			{ m._14 - m._13, m._24 - m._23, m._34 - m._33, m._44 - m._43 },	// far
+		};
+		for (uint32_t i = 0; i < 8; ++i)
+		{
+			const float* plane	= planes[i < 6 ? i : 0];
+			frustum->X[i]		= plane[0];
+			frustum->Y[i]		= plane[1];
+			frustum->Z[i]		= plane[2];
+			frustum->W[i]		= plane[3];
+			frustum->AbsX[i]	= std::fabs(plane[0]);
+			frustum->AbsY[i]	= std::fabs(plane[1]);
+			frustum->AbsZ[i]	= std::fabs(plane[2]);
+		}
+	}
+
+	OVERLAP TestFrustum(const Frustum& frustum, const Bounds& box)
+	{
+		const float cx = (box.Min.x + box.Max.x) * 0.5f, ex = (box.Max.x - box.Min.x) * 0.5f;
+		const float cy = (box.Min.y + box.Max.y) * 0.5f, ey = (box.Max.y - box.Min.y) * 0.5f;
+		const float cz = (box.Min.z + box.Max.z) * 0.5f, ez = (box.Max.z - box.Min.z) * 0.5f;
+#if defined(SCENE_BVH_SSE)
+		const __m128 centerX = _mm_set1_ps(cx), centerY = _mm_set1_ps(cy), centerZ = _mm_set1_ps(cz);
+		const __m128 extentX = _mm_set1_ps(ex), extentY = _mm_set1_ps(ey), extentZ = _mm_set1_ps(ez);
+		int outside = 0, partial = 0;
+		for (uint32_t i = 0; i < 8; i += 4)
+		{
+			__m128 distance = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(_mm_load_ps(frustum.X + i), centerX), _mm_mul_ps(_mm_load_ps(frustum.Y + i), centerY)),
+				_mm_add_ps(_mm_mul_ps(_mm_load_ps(frustum.Z + i), centerZ), _mm_load_ps(frustum.W + i)));
+			__m128 radius = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(_mm_load_ps(frustum.AbsX + i), extentX), _mm_mul_ps(_mm_load_ps(frustum.AbsY + i), extentY)),
+				_mm_mul_ps(_mm_load_ps(frustum.AbsZ + i), extentZ));
+			outside	|= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+			partial	|= _mm_movemask_ps(_mm_cmplt_ps(_mm_sub_ps(distance, radius), _mm_setzero_ps()));
+		}
+#else
+		bool outside = false, partial = false;
+		for (uint32_t i = 0; i < 6; ++i)
+		{
+			const float distance	= frustum.X[i] * cx + frustum.Y[i] * cy + frustum.Z[i] * cz + frustum.W[i];
+			const float radius		= frustum.AbsX[i] * ex + frustum.AbsY[i] * ey + frustum.AbsZ[i] * ez;
+			outside	|= distance + radius < 0.0f;
+			partial	|= distance - radius < 0.0f;
+		}
+#endif
+		return outside ? OVERLAP::OUTSIDE : partial ? OVERLAP::PARTIAL : OVERLAP::INSIDE;
+	}
+
+	//**************************************************
+	/// \brief Ray with reciprocal direction for slab tests
+	//**************************************************
+	struct RayData
+	{
+		float	Origin[4];
+		float	Inverse[4];
+		float	MaxDistance;
+	};
+
+	RayData PrepareRay(const Ray& ray)
+	{
+		// Axis parallel rays get a huge finite reciprocal, so 0 * inverse never makes NaN
+		const float direction[3] = { ray.Direction.x, ray.Direction.y, ray.Direction.z };
+		RayData data{ { ray.Origin.x, ray.Origin.y, ray.Origin.z, 0.0f }, {}, ray.MaxDistance };
+		for (uint32_t i = 0; i < 3; ++i)
+			data.Inverse[i] = std::fabs(direction[i]) > 1e-30f ? 1.0f / direction[i] : std::copysign(1e30f, direction[i]);
+		return data;
+	}
+
+	// Entry distance of the ray into the box, FLT_MAX when missed or beyond limit
+	float Intersect(const RayData& ray, const Bounds& box, const float limit)
+	{
+#if defined(SCENE_BVH_SSE)
+		const __m128 origin		= _mm_loadu_ps(ray.Origin);
+		const __m128 inverse	= _mm_loadu_ps(ray.Inverse);
+		const __m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_set_ps(0.0f, box.Min.z, box.Min.y, box.Min.x), origin), inverse);
+		const __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_set_ps(0.0f, box.Max.z, box.Max.y, box.Max.x), origin), inverse);
+		__m128 enter = _mm_min_ps(t0, t1);
+		__m128 leave = _mm_max_ps(t0, t1);
+		enter = _mm_max_ps(enter, _mm_shuffle_ps(enter, enter, _MM_SHUFFLE(3, 0, 2, 1)));
+		enter = _mm_max_ss(enter, _mm_shuffle_ps(enter, enter, _MM_SHUFFLE(3, 1, 0, 2)));
+		leave = _mm_min_ps(leave, _mm_shuffle_ps(leave, leave, _MM_SHUFFLE(3, 0, 2, 1)));
+		leave = _mm_min_ss(leave, _mm_shuffle_ps(leave, leave, _MM_SHUFFLE(3, 1, 0, 2)));
+		const float tMin	= (std::max)(_mm_cvtss_f32(enter), 0.0f);
+		const float tMax	= (std::min)(_mm_cvtss_f32(leave), limit);
+#else
+		const float minimum[3] = { box.Min.x, box.Min.y, box.Min.z };
+		const float maximum[3] = { box.Max.x, box.Max.y, box.Max.z };
+		float tMin = 0.0f, tMax = limit;
+		for (uint32_t i = 0; i < 3; ++i)
+		{
+			const float t0 = (minimum[i] - ray.Origin[i]) * ray.Inverse[i];
+			const float t1 = (maximum[i] - ray.Origin[i]) * ray.Inverse[i];
+			tMin	= (std::max)(tMin, (std::min)(t0, t1));
+			tMax	= (std::min)(tMax, (std::max)(t0, t1));
+		}
+#endif
+		return tMin <= tMax ? tMin : FLT_MAX;
+	}
+
+	void Merge(Bounds* box, const Bounds& other)
+	{
+		box->Min.x = (std::min)(box->Min.x, other.Min.x);	box->Max.x = (std::max)(box->Max.x, other.Max.x);
+		box->Min.y = (std::min)(box->Min.y, other.Min.y);	box->Max.y = (std::max)(box->Max.y, other.Max.y);
+		box->Min.z = (std::min)(box->Min.z, other.Min.z);	box->Max.z = (std::max)(box->Max.z, other.Max.z);
+	}
+
+	Bounds EmptyBounds()
+	{
+		return Bounds{ { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+	}
+
+	// Half the surface area
+	float Area(const Bounds& box)
+	{
+		const float x = (std::max)(box.Max.x - box.Min.x, 0.0f);
+		const float y = (std::max)(box.Max.y - box.Min.y, 0.0f);
+		const float z = (std::max)(box.Max.z - box.Min.z, 0.0f);
+		return x * y + y * z + z * x;
+	}
+
+}
+
+/* Constructor */
+SceneBvh::SceneBvh()
+	:m_tree(),
+	m_builtCost(0.0),
+	m_rebuildTree(),
+	m_rebuildDone(false),
+	m_rebuildNum(0)
+{
+}
+
+/* Destructor */
+SceneBvh::~SceneBvh()
+{
+	if (m_builder.joinable())
+		m_builder.join();
+}
+
+/* Build */
+void SceneBvh::Build(const Bounds* bounds, const size_t objectNum)
+{
+	// A running rebuild is based on stale bounds
+	if (m_builder.joinable())
+		m_builder.join();
+
+	m_bounds.assign(bounds, bounds + objectNum);
+	SceneBvh::BuildTree(m_bounds, &m_tree);
+	m_builtCost = m_tree.Cost;
+	m_dirty.assign(m_tree.Nodes.size(), 0);
+	m_dirtyNodes.clear();
+}
+
+/* Move */
+void SceneBvh::Move(const uint32_t object, const Bounds& bounds)
+{
+	if (object >= m_bounds.size())
+		return;
+
+	m_bounds[object] = bounds;
+	this->MarkDirty(m_tree.LeafOf[object]);
+}
+
+/* Refit */
+void SceneBvh::Refit()
+{
+	if (m_builder.joinable() && m_rebuildDone.load(std::memory_order_acquire))
+		this->AdoptRebuild();
+
+	// Children have larger indices than their parent, so descending order refits bottom up
+	// Many moved objects make a reverse scan of the flags cheaper than sorting the list
+	if (m_dirtyNodes.size() > m_tree.Nodes.size() / k_scanFraction)
+	{
+		m_dirtyNodes.clear();
+		for (size_t index = m_dirty.size(); index-- > 0;)
+		{
+			if (m_dirty[index])
+				m_dirtyNodes.push_back(uint32_t(index));
+		}
+	}
+	else
+	{
+		std::sort(m_dirtyNodes.begin(), m_dirtyNodes.end(), std::greater<uint32_t>());
+	}
+
+	for (uint32_t index : m_dirtyNodes)
+	{
+		Node& node = m_tree.Nodes[index];
+		const float before = Area(node.Box);
+
+		node.Box = EmptyBounds();
+		if (node.Count)
+		{
+			for (uint32_t i = 0; i < node.Count; ++i)
+				Merge(&node.Box, m_bounds[m_tree.Objects[node.Left + i]]);
+		}
+		else
+		{
+			Merge(&node.Box, m_tree.Nodes[node.Left].Box);
+			Merge(&node.Box, m_tree.Nodes[node.Left + 1].Box);
+		}
+
+		m_tree.AreaSum += double(Area(node.Box) - before) * (node.Count ? double(node.Count) : k_traversalCost);
+		m_dirty[index] = 0;
+	}
+	m_dirtyNodes.clear();
+
+	if (!m_tree.Nodes.empty())
+	{
+		const double rootArea = Area(m_tree.Nodes[0].Box);
+		m_tree.Cost = rootArea > 0.0 ? m_tree.AreaSum / rootArea : 0.0;
+	}
+
+	// Refit keeps the topology, a tree built for the old layout degrades as objects travel
+	if (!m_builder.joinable() && !m_bounds.empty() && m_tree.Cost > m_builtCost * k_rebuildRatio)
+	{
+		m_rebuildBounds = m_bounds;
+		m_rebuildDone.store(false, std::memory_order_relaxed);
+		m_builder = std::thread([this]()
+		{
+			SceneBvh::BuildTree(m_rebuildBounds, &m_rebuildTree);
+			m_rebuildDone.store(true, std::memory_order_release);
+		});
+	}
+}
+
+/* Cull */
+void SceneBvh::Cull(const DirectX::XMFLOAT4X4& viewProjection, std::vector<uint32_t>* visible) const
+{
+	visible->clear();
+	if (m_tree.Nodes.empty())
+		return;
+
+	Frustum frustum;
+	ExtractFrustum(viewProjection, &frustum);
+
+	// Low bit of a stack entry tells the subtree is already known to be inside
+	uint32_t stack[k_stackSize];
+	uint32_t depth = 0;
+	stack[depth++] = 0;
+	while (depth > 0)
+	{
+		const uint32_t entry	= stack[--depth];
+		const Node& node		= m_tree.Nodes[entry >> 1];
+		uint32_t inside			= entry & 1;
+		if (!inside)
+		{
+			const OVERLAP overlap = TestFrustum(frustum, node.Box);
+			if (overlap == OVERLAP::OUTSIDE)
+				continue;
+			inside = overlap == OVERLAP::INSIDE ? 1 : 0;
+		}
+
+		if (node.Count)
+		{
+			for (uint32_t i = 0; i < node.Count; ++i)
+			{
+				const uint32_t object = m_tree.Objects[node.Left + i];
+				if (inside || TestFrustum(frustum, m_bounds[object]) != OVERLAP::OUTSIDE)
+					visible->push_back(object);
+			}
+		}
+		else
+		{
+			stack[depth++] = ((node.Left + 1) << 1) | inside;
+			stack[depth++] = (node.Left << 1) | inside;
+		}
+	}
+}
+
+/* Raycast */
+void SceneBvh::Raycast(const Ray* rays, const size_t rayNum, RayHit* hits) const
+{
+	const size_t batchNum = (rayNum + k_rayBatch - 1) / k_rayBatch;
+	ThreadPool::Shared().ParallelFor(batchNum, [&](size_t batch)
+	{
+		const size_t end = (std::min)((batch + 1) * k_rayBatch, rayNum);
+		for (size_t r = batch * k_rayBatch; r < end; ++r)
+		{
+			RayHit& hit	= hits[r];
+			hit			= RayHit{ k_invalid, FLT_MAX };
+			if (m_tree.Nodes.empty())
+				continue;
+
+			const RayData ray = PrepareRay(rays[r]);
+			float best = ray.MaxDistance;
+			if (Intersect(ray, m_tree.Nodes[0].Box, best) == FLT_MAX)
+				continue;
+
+			// Entries were hit on push, nearer child is visited first
+			uint32_t stack[k_stackSize];
+			float distance[k_stackSize];
+			uint32_t depth = 0;
+			stack[depth]	= 0;
+			distance[depth]	= 0.0f;
+			++depth;
+			while (depth > 0)
+			{
+				--depth;
+				if (distance[depth] > best)
+					continue;
+
+				const Node& node = m_tree.Nodes[stack[depth]];
+				if (node.Count)
+				{
+					for (uint32_t i = 0; i < node.Count; ++i)
+					{
+						const uint32_t object = m_tree.Objects[node.Left + i];
+						const float t = Intersect(ray, m_bounds[object], best);
+						if (t < best || (t == best && hit.Object == k_invalid))
+						{
+							best	= t;
+							hit		= RayHit{ object, t };
+						}
+					}
+					continue;
+				}
+
+				const float t0 = Intersect(ray, m_tree.Nodes[node.Left].Box, best);
+				const float t1 = Intersect(ray, m_tree.Nodes[node.Left + 1].Box, best);
+				const bool swap = t1 < t0;
+				const float tNear = swap ? t1 : t0, tFar = swap ? t0 : t1;
+				if (tFar != FLT_MAX)
+				{
+					stack[depth]	= node.Left + (swap ? 0 : 1);
+					distance[depth]	= tFar;
+					++depth;
+				}
+				if (tNear != FLT_MAX)
+				{
+					stack[depth]	= node.Left + (swap ? 1 : 0);
+					distance[depth]	= tNear;
+					++depth;
+				}
+			}
+		}
+	});
+}
+
+/* Cull brute force */
+void SceneBvh::CullBruteForce(const Bounds* bounds, const size_t objectNum, const DirectX::XMFLOAT4X4& viewProjection, std::vector<uint32_t>* visible)
+{
+	visible->clear();
+
+	Frustum frustum;
+	ExtractFrustum(viewProjection, &frustum);
+	for (size_t i = 0; i < objectNum; ++i)
+	{
+		if (TestFrustum(frustum, bounds[i]) != OVERLAP::OUTSIDE)
+			visible->push_back(uint32_t(i));
+	}
+}
+
+/* Raycast brute force */
+void SceneBvh::RaycastBruteForce(const Bounds* bounds, const size_t objectNum, const Ray* rays, const size_t rayNum, RayHit* hits)
+{
+	const size_t batchNum = (rayNum + k_rayBatch - 1) / k_rayBatch;
+	ThreadPool::Shared().ParallelFor(batchNum, [&](size_t batch)
+	{
+		const size_t end = (std::min)((batch + 1) * k_rayBatch, rayNum);
+		for (size_t r = batch * k_rayBatch; r < end; ++r)
+		{
+			const RayData ray = PrepareRay(rays[r]);
+			float best = ray.MaxDistance;
+			hits[r] = RayHit{ k_invalid, FLT_MAX };
+			for (size_t i = 0; i < objectNum; ++i)
+			{
+				const float t = Intersect(ray, bounds[i], best);
+				if (t < best || (t == best && hits[r].Object == k_invalid))
+				{
+					best	= t;
+					hits[r]	= RayHit{ uint32_t(i), t };
+				}
+			}
+		}
+	});
+}
+
+/* Build tree */
+void SceneBvh::BuildTree(const std::vector<Bounds>& bounds, Tree* tree)
+{
+	const uint32_t objectNum = uint32_t(bounds.size());
+	tree->Nodes.clear();
+	tree->Nodes.reserve(size_t(objectNum) * 2);
+	tree->Parent.clear();
+	tree->Parent.reserve(size_t(objectNum) * 2);
+	tree->Objects.resize(objectNum);
+	tree->LeafOf.resize(objectNum);
+	tree->AreaSum	= 0.0;
+	tree->Cost		= 0.0;
+	if (objectNum == 0)
+		return;
+
+	// Boxes travel with the partition, so every pass over a range reads contiguous memory
+	struct Item
+	{
+		Bounds		Box;
+		float		Center[3];
+		uint32_t	Object;
+	};
+	std::vector<Item> items(objectNum);
+	for (uint32_t i = 0; i < objectNum; ++i)
+	{
+		const Bounds& box = bounds[i];
+		items[i] = Item{ box, { box.Min.x + box.Max.x, box.Min.y + box.Max.y, box.Min.z + box.Max.z }, i };
+	}
+
+	struct Task
+	{
+		uint32_t	Node;
+		uint32_t	Begin;
+		uint32_t	End;
+		uint32_t	Depth;
+	};
+	std::vector<Task> tasks;
+	tasks.push_back(Task{ 0, 0, objectNum, 0 });
+	tree->Nodes.push_back(Node{ EmptyBounds(), 0, 0 });
+	tree->Parent.push_back(k_invalid);
+
+	struct Bin
+	{
+		Bounds		Box;
+		uint32_t	Count;
+	};
+	Bin bins[3][k_binNum];
+	float rightArea[k_binNum];
+	while (!tasks.empty())
+	{
+		const Task task = tasks.back();
+		tasks.pop_back();
+
+		const uint32_t count = task.End - task.Begin;
+		Bounds box = EmptyBounds();
+		float low[3] = { FLT_MAX, FLT_MAX, FLT_MAX }, high[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		for (uint32_t i = task.Begin; i < task.End; ++i)
+		{
+			Merge(&box, items[i].Box);
+			for (uint32_t axis = 0; axis < 3; ++axis)
+			{
+				low[axis]	= (std::min)(low[axis], items[i].Center[axis]);
+				high[axis]	= (std::max)(high[axis], items[i].Center[axis]);
+			}
+		}
+		tree->Nodes[task.Node].Box = box;
+
+		// Bin all axes in one pass, then sweep each, cost is area times object count of each side
+		float scale[3];
+		for (uint32_t axis = 0; axis < 3; ++axis)
+		{
+			scale[axis] = high[axis] > low[axis] ? float(k_binNum) / (high[axis] - low[axis]) : 0.0f;
+			for (Bin& bin : bins[axis])
+				bin = Bin{ EmptyBounds(), 0 };
+		}
+
+		const float leafCost	= Area(box) * float(count);
+		float bestCost			= FLT_MAX;
+		uint32_t bestAxis		= 0;
+		uint32_t bestBin		= 0;
+		if (count > 1 && task.Depth < k_medianDepth)
+		{
+			for (uint32_t i = task.Begin; i < task.End; ++i)
+			{
+				for (uint32_t axis = 0; axis < 3; ++axis)
+				{
+					Bin& bin = bins[axis][(std::min)(uint32_t((items[i].Center[axis] - low[axis]) * scale[axis]), k_binNum - 1)];
+					Merge(&bin.Box, items[i].Box);
+					++bin.Count;
+				}
+			}
+
+			for (uint32_t axis = 0; axis < 3; ++axis)
+			{
+				if (scale[axis] == 0.0f)
+					continue;
+
+				Bounds right = EmptyBounds();
+				for (uint32_t b = k_binNum - 1; b > 0; --b)
+				{
+					Merge(&right, bins[axis][b].Box);
+					rightArea[b] = Area(right);
+				}
+
+				Bounds left = EmptyBounds();
+				uint32_t leftCount = 0;
+				for (uint32_t b = 0; b + 1 < k_binNum; ++b)
+				{
+					Merge(&left, bins[axis][b].Box);
+					leftCount += bins[axis][b].Count;
+					if (leftCount == 0 || leftCount == count)
+						continue;
+
+					const float cost = Area(left) * float(leftCount) + rightArea[b + 1] * float(count - leftCount);
+					if (cost < bestCost)
+					{
+						bestCost	= cost;
+						bestAxis	= axis;
+						bestBin		= b;
+					}
+				}
+			}
+		}
+
+		const float splitCost = bestCost + Area(box) * k_traversalCost;
+		if (count <= k_leafSize && (bestCost == FLT_MAX || leafCost <= splitCost))
+		{
+			tree->Nodes[task.Node].Left		= task.Begin;
+			tree->Nodes[task.Node].Count	= count;
+			for (uint32_t i = task.Begin; i < task.End; ++i)
+			{
+				tree->Objects[i]					= items[i].Object;
+				tree->LeafOf[items[i].Object]	= task.Node;
+			}
+			continue;
+		}
+
+		// Identical centroids cannot be binned and deep chains are cut short, halve by index
+		uint32_t middle = task.Begin + count / 2;
+		if (bestCost != FLT_MAX)
+		{
+			Item* split = std::partition(items.data() + task.Begin, items.data() + task.End, [&](const Item& item)
+			{
+				return (std::min)(uint32_t((item.Center[bestAxis] - low[bestAxis]) * scale[bestAxis]), k_binNum - 1) <= bestBin;
+			});
+			middle = uint32_t(split - items.data());
+		}
+
+		const uint32_t left = uint32_t(tree->Nodes.size());
+		tree->Nodes[task.Node].Left		= left;
+		tree->Nodes[task.Node].Count	= 0;
+		tree->Nodes.push_back(Node{ EmptyBounds(), 0, 0 });
+		tree->Nodes.push_back(Node{ EmptyBounds(), 0, 0 });
+		tree->Parent.push_back(task.Node);
+		tree->Parent.push_back(task.Node);
+		tasks.push_back(Task{ left + 1, middle, task.End, task.Depth + 1 });
+		tasks.push_back(Task{ left, task.Begin, middle, task.Depth + 1 });
+	}
+
+	for (const Node& node : tree->Nodes)
+		tree->AreaSum += double(Area(node.Box)) * (node.Count ? double(node.Count) : k_traversalCost);
+
+	const double rootArea = Area(tree->Nodes[0].Box);
+	tree->Cost = rootArea > 0.0 ? tree->AreaSum / rootArea : 0.0;
+}
+
+/* Refit tree */
+void SceneBvh::RefitTree(const std::vector<Bounds>& bounds, Tree* tree)
+{
+	tree->AreaSum = 0.0;
+	for (size_t index = tree->Nodes.size(); index-- > 0;)
+	{
+		Node& node	= tree->Nodes[index];
+		node.Box	= EmptyBounds();
+		if (node.Count)
+		{
+			for (uint32_t i = 0; i < node.Count; ++i)
+				Merge(&node.Box, bounds[tree->Objects[node.Left + i]]);
+		}
+		else
+		{
+			Merge(&node.Box, tree->Nodes[node.Left].Box);
+			Merge(&node.Box, tree->Nodes[node.Left + 1].Box);
+		}
+		tree->AreaSum += double(Area(node.Box)) * (node.Count ? double(node.Count) : k_traversalCost);
+	}
+
+	const double rootArea = tree->Nodes.empty() ? 0.0 : Area(tree->Nodes[0].Box);
+	tree->Cost = rootArea > 0.0 ? tree->AreaSum / rootArea : 0.0;
+}
+
+// Mark dirty
+void SceneBvh::MarkDirty(uint32_t node)
+{
+	while (node != k_invalid && !m_dirty[node])
+	{
+		m_dirty[node] = 1;
+		m_dirtyNodes.push_back(node);
+		node = m_tree.Parent[node];
+	}
+}
+
+// Adopt rebuild
+void SceneBvh::AdoptRebuild()
+{
+	m_builder.join();
+	if (m_rebuildTree.LeafOf.size() != m_bounds.size())
+		return;
+
+	// Objects kept moving while the builder ran
+	std::swap(m_tree, m_rebuildTree);
+	SceneBvh::RefitTree(m_bounds, &m_tree);
+	m_builtCost = m_tree.Cost;
+	m_dirty.assign(m_tree.Nodes.size(), 0);
+	m_dirtyNodes.clear();
+	++m_rebuildNum;
+}
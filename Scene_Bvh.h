@@ -0,0 +1,214 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Scene_Bvh.h
+*		Detail	: Bounding volume hierarchy over object bounds for culling and picking
+===================================================================================*/
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <DirectXMath.h>
+
+namespace structure
+{
+	//**************************************************
+	/// \brief Axis aligned box
+	//**************************************************
+	struct Bounds
+	{
+		DirectX::XMFLOAT3	Min;
+		DirectX::XMFLOAT3	Max;
+	};
+
+	//**************************************************
+	/// \brief Ray segment, Direction does not need to be normalized
+	//**************************************************
+	struct Ray
+	{
+		DirectX::XMFLOAT3	Origin;
+		DirectX::XMFLOAT3	Direction;
+		float				MaxDistance;	// in units of Direction
+	};
+
+	//**************************************************
+	/// \brief Nearest object bounds along a ray
+	//**************************************************
+	struct RayHit
+	{
+		uint32_t	Object;		// SceneBvh::k_invalid when nothing is hit
+		float		Distance;	// entry distance in units of Direction, 0 when the origin is inside
+	};
+}
+
+class SceneBvh
+{
+public:
+	static const uint32_t	k_invalid		= UINT32_MAX;
+	static const uint32_t	k_leafSize		= 4;	// objects per leaf at most
+	static const uint32_t	k_binNum		= 16;	// SAH buckets per axis
+	static const float		k_rebuildRatio;			// SAH cost growth after refits that starts a rebuild
+
+public:
+	SceneBvh();
+
+	//**************************************************
+	/// \brief Destructor, wait for a background rebuild
+	///
+	/// \return none
+	//**************************************************
+	~SceneBvh();
+
+	SceneBvh(const SceneBvh&)				= delete;
+	SceneBvh& operator=(const SceneBvh&)	= delete;
+
+	//**************************************************
+	/// \brief Build from scratch with binned SAH, blocks the caller
+	///
+	/// \param[in] bounds	 ->	bounds of each object, object index is the array index
+	/// \param[in] objectNum ->	number of objects
+	///
+	/// \return none
+	//**************************************************
+	void Build(
+		const structure::Bounds* bounds,
+		const size_t objectNum
+	);
+
+	//**************************************************
+	/// \brief Change the bounds of one object, applied by the next Refit
+	///
+	/// \param[in] object	 ->	index given to Build
+	/// \param[in] bounds	 ->	new bounds
+	///
+	/// \return none
+	//**************************************************
+	void Move(
+		const uint32_t object,
+		const structure::Bounds& bounds
+	);
+
+	//**************************************************
+	/// \brief Refit the nodes above moved objects, once per frame before queries
+	///        A finished background rebuild is adopted here, and a new one starts
+	///        when the SAH cost grew past k_rebuildRatio since the last build
+	///
+	/// \return none
+	//**************************************************
+	void Refit();
+
+	//**************************************************
+	/// \brief Objects whose bounds intersect the frustum, in tree order
+	///        Subtrees fully inside the frustum are appended without further tests
+	///
+	/// \param[in]  viewProjection	 ->	row vector matrix, clip z in [0, 1]
+	/// \param[out] visible			 ->	object indices, cleared first
+	///
+	/// \return none
+	//**************************************************
+	void Cull(
+		const DirectX::XMFLOAT4X4& viewProjection,
+		std::vector<uint32_t>* visible
+	) const;
+
+	//**************************************************
+	/// \brief Nearest object bounds along each ray, rays are split over ThreadPool::Shared
+	///
+	/// \param[in]  rays	 ->	ray array
+	/// \param[in]  rayNum	 ->	number of rays
+	/// \param[out] hits	 ->	one result per ray
+	///
+	/// \return none
+	//**************************************************
+	void Raycast(
+		const structure::Ray* rays,
+		const size_t rayNum,
+		structure::RayHit* hits
+	) const;
+
+	//**************************************************
+	/// \brief Same tests as Cull and Raycast over every object, the reference for benchmarks
+	//**************************************************
+	static void CullBruteForce(
+		const structure::Bounds* bounds,
+		const size_t objectNum,
+		const DirectX::XMFLOAT4X4& viewProjection,
+		std::vector<uint32_t>* visible
+	);
+	static void RaycastBruteForce(
+		const structure::Bounds* bounds,
+		const size_t objectNum,
+		const structure::Ray* rays,
+		const size_t rayNum,
+		structure::RayHit* hits
+	);
+
+	size_t		ObjectNum() const		{ return m_bounds.size(); }
+	size_t		NodeNum() const			{ return m_tree.Nodes.size(); }
+	double		Cost() const			{ return m_tree.Cost; }		// SAH cost relative to the root area
+	double		BuiltCost() const		{ return m_builtCost; }
+	bool		IsRebuilding() const	{ return m_builder.joinable(); }
+	uint32_t	RebuildNum() const		{ return m_rebuildNum; }
+
+private:
+	//**************************************************
+	/// \brief Leaf when Count is not 0, children of an interior node are Left and Left + 1
+	//**************************************************
+	struct Node
+	{
+		structure::Bounds	Box;
+		uint32_t			Left;		// first child, or first entry of Objects
+		uint32_t			Count;		// objects of a leaf
+	};
+
+	struct Tree
+	{
+		std::vector<Node>		Nodes;
+		std::vector<uint32_t>	Objects;	// leaf order
+		std::vector<uint32_t>	Parent;		// per node
+		std::vector<uint32_t>	LeafOf;		// per object
+		double					AreaSum;	// SAH numerator, kept current by Refit
+		double					Cost;
+	};
+
+	//**************************************************
+	/// \brief Binned SAH build into tree, safe on the builder thread
+	///
+	/// \return none
+	//**************************************************
+	static void BuildTree(
+		const std::vector<structure::Bounds>& bounds,
+		Tree* tree
+	);
+
+	//**************************************************
+	/// \brief Recompute every node box and the SAH cost
+	///
+	/// \return none
+	//**************************************************
+	static void RefitTree(
+		const std::vector<structure::Bounds>& bounds,
+		Tree* tree
+	);
+
+	// Mark a node and its ancestors for Refit
+	void MarkDirty(uint32_t node);
+
+	// Join the builder thread and swap in its tree
+	void AdoptRebuild();
+
+	std::vector<structure::Bounds>	m_bounds;			// current bounds per object
+	std::vector<uint8_t>			m_dirty;			// per node of m_tree
+	std::vector<uint32_t>			m_dirtyNodes;		// marked since the last Refit
+	Tree							m_tree;
+	double							m_builtCost;		// cost right after the last build
+
+	std::vector<structure::Bounds>	m_rebuildBounds;	// snapshot read by the builder
+	Tree							m_rebuildTree;
+	std::thread						m_builder;
+	std::atomic<bool>				m_rebuildDone;
+	uint32_t						m_rebuildNum;
+};
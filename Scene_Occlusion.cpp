@@ -0,0 +1,480 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Scene_Occlusion.cpp
+*		Detail	: Masked software occlusion culling on a low resolution cpu depth buffer
+===================================================================================*/
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SCENE_OCCLUSION_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define SCENE_OCCLUSION_TARGET_AVX2
+#else
+#include <cpuid.h>
+#define SCENE_OCCLUSION_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+#include "Scene_Occlusion.h"
+#include "Thread_Pool.h"
+using namespace structure;
+
+const uint32_t OcclusionCuller::k_tileWidth;
+const uint32_t OcclusionCuller::k_tileHeight;
+const uint32_t OcclusionCuller::k_blockTiles;
+
+namespace
+{
+	const float		k_nearW		= 1e-4f;		// clip w below this is treated as crossing the near plane
+	const uint32_t	k_fullMask	= UINT32_MAX;
+
+	//**************************************************
+	/// \brief Clip space position of a row vector
+	//**************************************************
+	struct Clip
+	{
+		float X, Y, Z, W;
+	};
+
+	Clip Transform(const DirectX::XMFLOAT4X4& m, const float x, const float y, const float z)
+	{
+		return Clip{
+			x * m._11 + y * m._21 + z * m._31 + m._41,
+			x * m._12 + y * m._22 + z * m._32 + m._42,
+			x * m._13 + y * m._23 + z * m._33 + m._43,
+			x * m._14 + y * m._24 + z * m._34 + m._44
+		};
+	}
+
+	//**************************************************
+	/// \brief Coverage of the 8x4 pixel centers of a tile, bit row * 8 + column
+	//**************************************************
+	uint32_t CoverageScalar(const float (*edge)[3], const float x, const float y)
+	{
+		uint32_t mask = 0;
+		for (uint32_t row = 0; row < OcclusionCuller::k_tileHeight; ++row)
+		{
+			for (uint32_t column = 0; column < OcclusionCuller::k_tileWidth; ++column)
+			{
+				const float px = x + float(column) + 0.5f, py = y + float(row) + 0.5f;
+				bool inside = true;
+				for (uint32_t i = 0; i < 3; ++i)
+					inside &= edge[i][0] * px + edge[i][1] * py + edge[i][2] >= 0.0f;
+				mask |= inside ? 1u << (row * OcclusionCuller::k_tileWidth + column) : 0u;
+			}
+		}
+		return mask;
+	}
+
+#if defined(SCENE_OCCLUSION_X86)
+	// Sign bit of the smallest edge value is set outside
+	uint32_t CoverageSse2(const float (*edge)[3], const float x, const float y)
+	{
+		const __m128 columnLow	= _mm_add_ps(_mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f), _mm_set1_ps(x));
+		const __m128 columnHigh	= _mm_add_ps(columnLow, _mm_set1_ps(4.0f));
+		__m128 low[3], high[3], step[3];
+		for (uint32_t i = 0; i < 3; ++i)
+		{
+			const __m128 a		= _mm_set1_ps(edge[i][0]);
+			const __m128 start	= _mm_set1_ps(edge[i][1] * (y + 0.5f) + edge[i][2]);
+			low[i]	= _mm_add_ps(_mm_mul_ps(a, columnLow), start);
+			high[i]	= _mm_add_ps(_mm_mul_ps(a, columnHigh), start);
+			step[i]	= _mm_set1_ps(edge[i][1]);
+		}
+
+		uint32_t mask = 0;
+		for (uint32_t row = 0; row < OcclusionCuller::k_tileHeight; ++row)
+		{
+			const int outsideLow	= _mm_movemask_ps(_mm_min_ps(_mm_min_ps(low[0], low[1]), low[2]));
+			const int outsideHigh	= _mm_movemask_ps(_mm_min_ps(_mm_min_ps(high[0], high[1]), high[2]));
+			mask |= uint32_t(~(outsideLow | (outsideHigh << 4)) & 0xff) << (row * OcclusionCuller::k_tileWidth);
+			for (uint32_t i = 0; i < 3; ++i)
+			{
+				low[i]	= _mm_add_ps(low[i], step[i]);
+				high[i]	= _mm_add_ps(high[i], step[i]);
+			}
+		}
+		return mask;
+	}
+
+	// One 8 wide register per mask row, only called when HasAvx2() is true
+	SCENE_OCCLUSION_TARGET_AVX2 uint32_t CoverageAvx2(const float (*edge)[3], const float x, const float y)
+	{
+		const __m256 column = _mm256_add_ps(_mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f), _mm256_set1_ps(x));
+		__m256 value[3], step[3];
+		for (uint32_t i = 0; i < 3; ++i)
+		{
+			value[i]	= _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(edge[i][0]), column), _mm256_set1_ps(edge[i][1] * (y + 0.5f) + edge[i][2]));
+			step[i]		= _mm256_set1_ps(edge[i][1]);
+		}
+
+		uint32_t mask = 0;
+		for (uint32_t row = 0; row < OcclusionCuller::k_tileHeight; ++row)
+		{
+			const int outside = _mm256_movemask_ps(_mm256_min_ps(_mm256_min_ps(value[0], value[1]), value[2]));
+			mask |= uint32_t(~outside & 0xff) << (row * OcclusionCuller::k_tileWidth);
+			for (uint32_t i = 0; i < 3; ++i)
+				value[i] = _mm256_add_ps(value[i], step[i]);
+		}
+		return mask;
+	}
+#endif
+}
+
+/* Constructor */
+OcclusionCuller::OcclusionCuller()
+	:m_width(0),
+	m_height(0),
+	m_tilesX(0),
+	m_tilesY(0),
+	m_blocksX(0),
+	m_triangleNum(0),
+	m_statistics(),
+	m_coverage(CoverageScalar)
+{
+#if defined(SCENE_OCCLUSION_X86)
+	m_coverage = OcclusionCuller::HasAvx2() ? CoverageAvx2 : CoverageSse2;
+#endif
+}
+
+/* Set resolution */
+void OcclusionCuller::SetResolution(const uint32_t width, const uint32_t height)
+{
+	const uint32_t blockWidth	= k_tileWidth * k_blockTiles;
+	const uint32_t blockHeight	= k_tileHeight * k_blockTiles;
+	m_blocksX	= (std::max)((width + blockWidth - 1) / blockWidth, 1u);
+	m_width		= m_blocksX * blockWidth;
+	m_height	= (std::max)((height + blockHeight - 1) / blockHeight, 1u) * blockHeight;
+	m_tilesX	= m_width / k_tileWidth;
+	m_tilesY	= m_height / k_tileHeight;
+
+	const size_t tileNum = size_t(m_tilesX) * m_tilesY;
+	m_zMax0.resize(tileNum);
+	m_zMax1.resize(tileNum);
+	m_mask.resize(tileNum);
+	m_blockMax.resize(size_t(m_blocksX) * (m_tilesY / k_blockTiles));
+	m_bands.resize(m_tilesY / k_blockTiles);
+	this->BeginFrame();
+}
+
+/* Begin frame */
+void OcclusionCuller::BeginFrame()
+{
+	std::fill(m_zMax0.begin(), m_zMax0.end(), 1.0f);
+	std::fill(m_zMax1.begin(), m_zMax1.end(), 0.0f);
+	std::fill(m_mask.begin(), m_mask.end(), 0u);
+	std::fill(m_blockMax.begin(), m_blockMax.end(), 1.0f);
+	m_occluders.clear();
+	m_triangleNum	= 0;
+	m_statistics	= Statistics{};
+}
+
+/* Add occluder */
+void OcclusionCuller::AddOccluder(
+	const DirectX::XMFLOAT3* positions,
+	const uint32_t stride,
+	const uint32_t* indices,
+	const uint32_t indexNum,
+	const DirectX::XMFLOAT4X4& worldViewProjection
+)
+{
+	m_occluders.push_back(Occluder{ reinterpret_cast<const uint8_t*>(positions), stride, indices, indexNum, m_triangleNum, worldViewProjection });
+	m_triangleNum += indexNum / 3;
+}
+
+/* Rasterize */
+void OcclusionCuller::Rasterize()
+{
+	if (m_width == 0)
+		return;
+
+	// Setup in place, one job per occluder
+	m_triangles.resize(m_triangleNum);
+	const float width = float(m_width), height = float(m_height);
+	ThreadPool::Shared().ParallelFor(m_occluders.size(), [&](size_t index)
+	{
+		const Occluder& occluder = m_occluders[index];
+		for (uint32_t t = 0; t < occluder.IndexNum / 3; ++t)
+		{
+			Triangle& triangle	= m_triangles[occluder.FirstTriangle + t];
+			triangle.Valid		= 0;
+
+			float x[3], y[3], z[3];
+			bool clipped = false;
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				const DirectX::XMFLOAT3& p = *reinterpret_cast<const DirectX::XMFLOAT3*>(occluder.Positions + size_t(occluder.Indices[t * 3 + c]) * occluder.Stride);
+				const Clip clip = Transform(occluder.Matrix, p.x, p.y, p.z);
+				clipped |= clip.W < k_nearW;
+
+				const float invW = 1.0f / (std::max)(clip.W, k_nearW);
+				x[c] = (clip.X * invW * 0.5f + 0.5f) * width;
+				y[c] = (0.5f - clip.Y * invW * 0.5f) * height;
+				z[c] = (std::min)((std::max)(clip.Z * invW, 0.0f), 1.0f);
+			}
+
+			const float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+			if (clipped || std::fabs(area) < 1e-6f)
+				continue;
+
+			triangle.MinX = (std::max)(int32_t(std::floor((std::min)((std::min)(x[0], x[1]), x[2]))), 0);
+			triangle.MinY = (std::max)(int32_t(std::floor((std::min)((std::min)(y[0], y[1]), y[2]))), 0);
+			triangle.MaxX = (std::min)(int32_t(std::floor((std::max)((std::max)(x[0], x[1]), x[2]))), int32_t(m_width) - 1);
+			triangle.MaxY = (std::min)(int32_t(std::floor((std::max)((std::max)(y[0], y[1]), y[2]))), int32_t(m_height) - 1);
+			if (triangle.MinX > triangle.MaxX || triangle.MinY > triangle.MaxY)
+				continue;
+
+			// Both windings occlude, edges are flipped so inside is positive
+			const float sign = area > 0.0f ? 1.0f : -1.0f;
+			for (uint32_t e = 0; e < 3; ++e)
+			{
+				const uint32_t n = (e + 1) % 3;
+				triangle.Edge[e][0] = (y[e] - y[n]) * sign;
+				triangle.Edge[e][1] = (x[n] - x[e]) * sign;
+				triangle.Edge[e][2] = (x[e] * y[n] - x[n] * y[e]) * sign;
+			}
+
+			const float depthX	= ((z[1] - z[0]) * (y[2] - y[0]) - (z[2] - z[0]) * (y[1] - y[0])) / area;
+			const float depthY	= ((x[1] - x[0]) * (z[2] - z[0]) - (x[2] - x[0]) * (z[1] - z[0])) / area;
+			triangle.Depth[0]	= depthX;
+			triangle.Depth[1]	= depthY;
+			triangle.Depth[2]	= z[0] - depthX * x[0] - depthY * y[0];
+			triangle.MaxDepth	= (std::max)((std::max)(z[0], z[1]), z[2]);
+			triangle.Valid		= 1;
+		}
+	});
+
+	// Bin to bands of blocks, bands never share tiles so they rasterize without locks
+	const uint32_t bandHeight = k_tileHeight * k_blockTiles;
+	for (std::vector<uint32_t>& band : m_bands)
+		band.clear();
+	for (uint32_t t = 0; t < m_triangleNum; ++t)
+	{
+		const Triangle& triangle = m_triangles[t];
+		if (!triangle.Valid)
+			continue;
+
+		++m_statistics.OccluderTriangles;
+		for (uint32_t band = uint32_t(triangle.MinY) / bandHeight; band <= uint32_t(triangle.MaxY) / bandHeight; ++band)
+			m_bands[band].push_back(t);
+	}
+
+	ThreadPool::Shared().ParallelFor(m_bands.size(), [&](size_t band)
+	{
+		this->RasterizeBand(uint32_t(band));
+	});
+}
+
+/* Is visible */
+bool OcclusionCuller::IsVisible(const Bounds& box, const DirectX::XMFLOAT4X4& viewProjection)
+{
+	const bool visible = this->Test(box, viewProjection);
+	++m_statistics.Tests;
+	m_statistics.Occluded += visible ? 0 : 1;
+	return visible;
+}
+
+/* Test batch */
+size_t OcclusionCuller::TestBatch(const Bounds* boxes, const size_t boxNum, const DirectX::XMFLOAT4X4& viewProjection, uint8_t* visible)
+{
+	const size_t batch		= 256;
+	const size_t batchNum	= (boxNum + batch - 1) / batch;
+	ThreadPool::Shared().ParallelFor(batchNum, [&](size_t index)
+	{
+		const size_t end = (std::min)((index + 1) * batch, boxNum);
+		for (size_t i = index * batch; i < end; ++i)
+			visible[i] = this->Test(boxes[i], viewProjection) ? 1 : 0;
+	});
+
+	size_t visibleNum = 0;
+	for (size_t i = 0; i < boxNum; ++i)
+		visibleNum += visible[i];
+
+	m_statistics.Tests		+= boxNum;
+	m_statistics.Occluded	+= boxNum - visibleNum;
+	return visibleNum;
+}
+
+/* Has AVX2 */
+bool OcclusionCuller::HasAvx2()
+{
+#if defined(SCENE_OCCLUSION_X86)
+	static const bool supported = []()
+	{
+		unsigned int ecx = 0, ebx = 0;
+#if defined(_MSC_VER)
+		int info[4]{};
+		__cpuid(info, 1);
+		ecx = (unsigned int)info[2];
+		__cpuidex(info, 7, 0);
+		ebx = (unsigned int)info[1];
+#else
+		unsigned int eax = 0, edx = 0, unused = 0;
+		if (!__get_cpuid(1, &eax, &unused, &ecx, &edx))
+			return false;
+		if (!__get_cpuid_count(7, 0, &eax, &ebx, &unused, &edx))
+			return false;
+#endif
+		// AVX2 is VEX encoded, the os must save ymm state (OSXSAVE and XCR0)
+		const bool avx2		= (ebx & (1u << 5)) != 0;
+		const bool osxsave	= (ecx & (1u << 27)) != 0;
+		if (!avx2 || !osxsave)
+			return false;
+
+#if defined(_MSC_VER)
+		unsigned long long xcr0 = _xgetbv(0);
+#else
+		unsigned int xcr0Low = 0, xcr0High = 0;
+		__asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+		unsigned long long xcr0 = xcr0Low;
+#endif
+		return (xcr0 & 0x6) == 0x6;
+	}();
+	return supported;
+#else
+	return false;
+#endif
+}
+
+// Test
+bool OcclusionCuller::Test(const Bounds& box, const DirectX::XMFLOAT4X4& viewProjection) const
+{
+	if (m_width == 0)
+		return true;
+
+	// Screen rectangle and nearest depth of the eight corners
+	float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX, minZ = FLT_MAX;
+	for (uint32_t corner = 0; corner < 8; ++corner)
+	{
+		const Clip clip = Transform(viewProjection,
+			corner & 1 ? box.Max.x : box.Min.x,
+			corner & 2 ? box.Max.y : box.Min.y,
+			corner & 4 ? box.Max.z : box.Min.z);
+		if (clip.W < k_nearW)
+			return true;
+
+		const float invW = 1.0f / clip.W;
+		const float x = (clip.X * invW * 0.5f + 0.5f) * float(m_width);
+		const float y = (0.5f - clip.Y * invW * 0.5f) * float(m_height);
+		minX = (std::min)(minX, x);	maxX = (std::max)(maxX, x);
+		minY = (std::min)(minY, y);	maxY = (std::max)(maxY, y);
+		minZ = (std::min)(minZ, clip.Z * invW);
+	}
+
+	if (maxX < 0.0f || maxY < 0.0f || minX >= float(m_width) || minY >= float(m_height))
+		return false;
+
+	const uint32_t tileX0 = uint32_t((std::max)(minX, 0.0f)) / k_tileWidth;
+	const uint32_t tileY0 = uint32_t((std::max)(minY, 0.0f)) / k_tileHeight;
+	const uint32_t tileX1 = (std::min)(uint32_t(maxX) / k_tileWidth, m_tilesX - 1);
+	const uint32_t tileY1 = (std::min)(uint32_t(maxY) / k_tileHeight, m_tilesY - 1);
+
+	// Coarse blocks first, tiles only where the block is not conclusive
+	for (uint32_t blockY = tileY0 / k_blockTiles; blockY <= tileY1 / k_blockTiles; ++blockY)
+	{
+		for (uint32_t blockX = tileX0 / k_blockTiles; blockX <= tileX1 / k_blockTiles; ++blockX)
+		{
+			if (minZ > m_blockMax[size_t(blockY) * m_blocksX + blockX])
+				continue;
+
+			const uint32_t y0 = (std::max)(blockY * k_blockTiles, tileY0), y1 = (std::min)(blockY * k_blockTiles + k_blockTiles - 1, tileY1);
+			const uint32_t x0 = (std::max)(blockX * k_blockTiles, tileX0), x1 = (std::min)(blockX * k_blockTiles + k_blockTiles - 1, tileX1);
+			for (uint32_t ty = y0; ty <= y1; ++ty)
+			{
+				for (uint32_t tx = x0; tx <= x1; ++tx)
+				{
+					if (minZ <= m_zMax0[size_t(ty) * m_tilesX + tx])
+						return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+// Rasterize band
+void OcclusionCuller::RasterizeBand(const uint32_t band)
+{
+	const uint32_t tileY0 = band * k_blockTiles;
+	const uint32_t tileY1 = tileY0 + k_blockTiles - 1;
+	for (uint32_t index : m_bands[band])
+	{
+		const Triangle& triangle = m_triangles[index];
+		const uint32_t y0 = (std::max)(uint32_t(triangle.MinY) / k_tileHeight, tileY0);
+		const uint32_t y1 = (std::min)(uint32_t(triangle.MaxY) / k_tileHeight, tileY1);
+		const uint32_t x0 = uint32_t(triangle.MinX) / k_tileWidth;
+		const uint32_t x1 = uint32_t(triangle.MaxX) / k_tileWidth;
+		for (uint32_t ty = y0; ty <= y1; ++ty)
+		{
+			const float py = float(ty * k_tileHeight);
+			for (uint32_t tx = x0; tx <= x1; ++tx)
+			{
+				const float px = float(tx * k_tileWidth);
+				const uint32_t mask = m_coverage(triangle.Edge, px, py);
+				if (mask == 0)
+					continue;
+
+				// Farthest point of the depth plane over the tile, never beyond the farthest vertex
+				const float planeMax =
+					triangle.Depth[0] * (triangle.Depth[0] > 0.0f ? px + float(k_tileWidth) : px) +
+					triangle.Depth[1] * (triangle.Depth[1] > 0.0f ? py + float(k_tileHeight) : py) +
+					triangle.Depth[2];
+				const float depth = (std::max)((std::min)(planeMax, triangle.MaxDepth), 0.0f);
+				this->UpdateTile(size_t(ty) * m_tilesX + tx, mask, depth);
+			}
+		}
+	}
+
+	for (uint32_t blockX = 0; blockX < m_blocksX; ++blockX)
+	{
+		float farthest = 0.0f;
+		for (uint32_t ty = tileY0; ty <= tileY1; ++ty)
+		{
+			for (uint32_t tx = blockX * k_blockTiles; tx < (blockX + 1) * k_blockTiles; ++tx)
+				farthest = (std::max)(farthest, m_zMax0[size_t(ty) * m_tilesX + tx]);
+		}
+		m_blockMax[size_t(band) * m_blocksX + blockX] = farthest;
+	}
+}
+
+// Update tile
+void OcclusionCuller::UpdateTile(const size_t tile, const uint32_t mask, const float depth)
+{
+	float& zMax0	= m_zMax0[tile];
+	float& zMax1	= m_zMax1[tile];
+	uint32_t& layer	= m_mask[tile];
+	if (depth >= zMax0)
+		return;
+
+	if (mask == k_fullMask)
+	{
+		zMax0 = depth;
+		if (zMax1 >= depth)
+		{
+			zMax1	= 0.0f;
+			layer	= 0;
+		}
+		return;
+	}
+
+	// A triangle much nearer than the working layer starts a new one instead of widening it
+	if (layer != 0 && zMax1 - depth > zMax0 - zMax1)
+	{
+		zMax1	= 0.0f;
+		layer	= 0;
+	}
+
+	zMax1	= (std::max)(zMax1, depth);
+	layer	|= mask;
+	if (layer == k_fullMask)
+	{
+		zMax0	= (std::min)(zMax0, zMax1);
+		zMax1	= 0.0f;
+		layer	= 0;
+	}
+}
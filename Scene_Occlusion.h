@@ -0,0 +1,170 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Scene_Occlusion.h
+*		Detail	: Masked software occlusion culling on a low resolution cpu depth buffer
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Scene_Bvh.h"
+
+class OcclusionCuller
+{
+public:
+	//**************************************************
+	/// \brief Counters of the last frame
+	//**************************************************
+	struct Statistics
+	{
+		uint64_t	OccluderTriangles;	// triangles that reached the rasterizer
+		uint64_t	Tests;
+		uint64_t	Occluded;
+	};
+
+	static const uint32_t	k_tileWidth		= 8;	// pixels per coverage mask row
+	static const uint32_t	k_tileHeight	= 4;	// coverage mask rows, 32 bits per tile
+	static const uint32_t	k_blockTiles	= 4;	// tiles per side of a hierarchy block, also the band height
+
+public:
+	OcclusionCuller();
+
+	//**************************************************
+	/// \brief Allocate the depth buffer, sizes are rounded up to whole blocks
+	///
+	/// \param[in] width	 ->	width in pixels, 256 or 320 is typical
+	/// \param[in] height	 ->	height in pixels
+	///
+	/// \return none
+	//**************************************************
+	void SetResolution(
+		const uint32_t width,
+		const uint32_t height
+	);
+
+	//**************************************************
+	/// \brief Clear the depth buffer and the occluder list
+	///
+	/// \return none
+	//**************************************************
+	void BeginFrame();
+
+	//**************************************************
+	/// \brief Queue an occluder, the arrays must live until Rasterize
+	///        Only triangles in front of the near plane occlude, the rest are dropped
+	///
+	/// \param[in] positions			 ->	first position, three floats
+	/// \param[in] stride				 ->	bytes between positions (sizeof(Vertex3D) for vertex arrays)
+	/// \param[in] indices				 ->	triangle list
+	/// \param[in] indexNum				 ->	number of indices
+	/// \param[in] worldViewProjection	 ->	row vector matrix, clip z in [0, 1]
+	///
+	/// \return none
+	//**************************************************
+	void AddOccluder(
+		const DirectX::XMFLOAT3* positions,
+		const uint32_t stride,
+		const uint32_t* indices,
+		const uint32_t indexNum,
+		const DirectX::XMFLOAT4X4& worldViewProjection
+	);
+
+	//**************************************************
+	/// \brief Transform and bin all occluders, then rasterize bands of blocks on ThreadPool::Shared
+	///        Each tile keeps a covered far depth and a partially covered working layer
+	///
+	/// \return none
+	//**************************************************
+	void Rasterize();
+
+	//**************************************************
+	/// \brief Conservative visibility of world bounds after Rasterize
+	///
+	/// \param[in] box				 ->	world space bounds
+	/// \param[in] viewProjection	 ->	same camera as the occluders
+	///
+	/// \return false only when every covered tile is nearer than the box
+	//**************************************************
+	bool IsVisible(
+		const structure::Bounds& box,
+		const DirectX::XMFLOAT4X4& viewProjection
+	);
+
+	//**************************************************
+	/// \brief IsVisible for many bounds on ThreadPool::Shared
+	///
+	/// \param[out] visible	 ->	1 visible, 0 occluded, per box
+	///
+	/// \return number of visible boxes
+	//**************************************************
+	size_t TestBatch(
+		const structure::Bounds* boxes,
+		const size_t boxNum,
+		const DirectX::XMFLOAT4X4& viewProjection,
+		uint8_t* visible
+	);
+
+	//**************************************************
+	/// \brief Processor supports AVX2, the coverage kernel uses it when true
+	///
+	/// \return if supported then true
+	//**************************************************
+	static bool HasAvx2();
+
+	uint32_t			Width() const			{ return m_width; }
+	uint32_t			Height() const			{ return m_height; }
+	const float*		TileDepth() const		{ return m_zMax0.data(); }	// covered far depth per tile, row major
+	const Statistics&	GetStatistics() const	{ return m_statistics; }
+
+private:
+	using CoverageFunc = uint32_t(*)(const float (*)[3], float, float);
+
+	struct Occluder
+	{
+		const uint8_t*			Positions;
+		uint32_t				Stride;
+		const uint32_t*			Indices;
+		uint32_t				IndexNum;
+		uint32_t				FirstTriangle;
+		DirectX::XMFLOAT4X4		Matrix;
+	};
+
+	//**************************************************
+	/// \brief Screen space triangle, edges are a * x + b * y + c >= 0 inside
+	//**************************************************
+	struct Triangle
+	{
+		float		Edge[3][3];
+		float		Depth[3];	// z = Depth[0] * x + Depth[1] * y + Depth[2]
+		float		MaxDepth;
+		int32_t		MinX, MinY, MaxX, MaxY;
+		uint32_t	Valid;
+	};
+
+	// Visibility without touching the statistics, safe from several threads
+	bool Test(const structure::Bounds& box, const DirectX::XMFLOAT4X4& viewProjection) const;
+
+	// Rasterize the triangles binned to one band of blocks
+	void RasterizeBand(const uint32_t band);
+
+	// Merge a triangle into one tile
+	void UpdateTile(const size_t tile, const uint32_t mask, const float depth);
+
+	std::vector<Occluder>				m_occluders;
+	std::vector<Triangle>				m_triangles;
+	std::vector<std::vector<uint32_t>>	m_bands;		// triangle indices per band
+	std::vector<float>					m_zMax0;		// farthest depth of the covered part, per tile
+	std::vector<float>					m_zMax1;		// farthest depth of the working layer
+	std::vector<uint32_t>				m_mask;			// working layer coverage
+	std::vector<float>					m_blockMax;		// farthest zMax0 of each block
+	uint32_t							m_width;
+	uint32_t							m_height;
+	uint32_t							m_tilesX;
+	uint32_t							m_tilesY;
+	uint32_t							m_blocksX;
+	uint32_t							m_triangleNum;
+	Statistics							m_statistics;
+	CoverageFunc						m_coverage;		// 32 pixel mask of one tile
+};
@@ -0,0 +1,341 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Scene_Transform.cpp
+*		Detail	: Batched world matrix composition from structure of arrays transforms
+===================================================================================*/
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SCENE_TRANSFORM_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define SCENE_TRANSFORM_TARGET_AVX2
+#define SCENE_TRANSFORM_TARGET_AVX512
+#else
+#include <cpuid.h>
+#define SCENE_TRANSFORM_TARGET_AVX2		__attribute__((target("avx2")))
+#define SCENE_TRANSFORM_TARGET_AVX512	__attribute__((target("avx512f")))
+#endif
+#endif
+
+#include "Scene_Transform.h"
+using namespace structure;
+
+namespace
+{
+	//**************************************************
+	/// \brief Supported kernels, detected once
+	//**************************************************
+	struct Features
+	{
+		bool	Avx2;
+		bool	Avx512;
+	};
+
+	const Features& DetectFeatures()
+	{
+		static const Features features = []()
+		{
+			Features result{ false, false };
+#if defined(SCENE_TRANSFORM_X86)
+			unsigned int ecx = 0, ebx = 0;
+#if defined(_MSC_VER)
+			int info[4]{};
+			__cpuid(info, 1);
+			ecx = (unsigned int)info[2];
+			__cpuidex(info, 7, 0);
+			ebx = (unsigned int)info[1];
+#else
+			unsigned int eax = 0, edx = 0, unused = 0;
+			if (!__get_cpuid(1, &eax, &unused, &ecx, &edx))
+				return result;
+			if (!__get_cpuid_count(7, 0, &eax, &ebx, &unused, &edx))
+				return result;
+#endif
+			// The os must save ymm state for AVX2 and also opmask and zmm state for AVX-512
+			const bool osxsave = (ecx & (1u << 27)) != 0;
+			if (!osxsave)
+				return result;
+
+#if defined(_MSC_VER)
+			unsigned long long xcr0 = _xgetbv(0);
+#else
+			unsigned int xcr0Low = 0, xcr0High = 0;
+			__asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+			unsigned long long xcr0 = xcr0Low;
+#endif
+			result.Avx2		= (ebx & (1u << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+			result.Avx512	= (ebx & (1u << 16)) != 0 && (xcr0 & 0xe6) == 0xe6;
+#endif
+			return result;
+		}();
+		return features;
+	}
+
+	//**************************************************
+	/// \brief One object at a time, also the tail of the wide kernels
+	//**************************************************
+	void ComposeScalar(const TransformArrays& t, size_t begin, const size_t end, uint8_t* output, const size_t stride, const bool transpose)
+	{
+		for (; begin < end; ++begin)
+		{
+			const float x = t.RotationX[begin], y = t.RotationY[begin], z = t.RotationZ[begin], w = t.RotationW[begin];
+			const float sx = t.ScaleX[begin], sy = t.ScaleY[begin], sz = t.ScaleZ[begin];
+			const float x2 = x + x, y2 = y + y, z2 = z + z;
+			const float xx = x * x2, yy = y * y2, zz = z * z2;
+			const float xy = x * y2, xz = x * z2, yz = y * z2;
+			const float wx = w * x2, wy = w * y2, wz = w * z2;
+
+			const float m[16]
+			{
+				sx * (1.0f - (yy + zz)),	sx * (xy + wz),				sx * (xz - wy),				0.0f,
+				sy * (xy - wz),				sy * (1.0f - (xx + zz)),	sy * (yz + wx),				0.0f,
+				sz * (xz + wy),				sz * (yz - wx),				sz * (1.0f - (xx + yy)),	0.0f,
+				t.PositionX[begin],			t.PositionY[begin],			t.PositionZ[begin],			1.0f,
+			};
+
+			float* out = (float*)(output + begin * stride);
+			if (!transpose)
+			{
+				std::memcpy(out, m, sizeof(m));
+				continue;
+			}
+
+			float transposed[16];
+			for (int row = 0; row < 4; ++row)
+			{
+				for (int column = 0; column < 4; ++column)
+					transposed[column * 4 + row] = m[row * 4 + column];
+			}
+			std::memcpy(out, transposed, sizeof(transposed));
+		}
+	}
+
+#if defined(SCENE_TRANSFORM_X86)
+	//**************************************************
+	/// \brief Elements of 4 objects, element e of every object in m[e]
+	//**************************************************
+	void ComposeSse2(const TransformArrays& t, size_t begin, const size_t end, uint8_t* output, const size_t stride, const bool transpose)
+	{
+		const __m128 one	= _mm_set1_ps(1.0f);
+		const __m128 zero	= _mm_setzero_ps();
+		for (; begin + 4 <= end; begin += 4)
+		{
+			const __m128 x = _mm_loadu_ps(t.RotationX + begin), y = _mm_loadu_ps(t.RotationY + begin);
+			const __m128 z = _mm_loadu_ps(t.RotationZ + begin), w = _mm_loadu_ps(t.RotationW + begin);
+			const __m128 sx = _mm_loadu_ps(t.ScaleX + begin), sy = _mm_loadu_ps(t.ScaleY + begin), sz = _mm_loadu_ps(t.ScaleZ + begin);
+			const __m128 x2 = _mm_add_ps(x, x), y2 = _mm_add_ps(y, y), z2 = _mm_add_ps(z, z);
+			const __m128 xx = _mm_mul_ps(x, x2), yy = _mm_mul_ps(y, y2), zz = _mm_mul_ps(z, z2);
+			const __m128 xy = _mm_mul_ps(x, y2), xz = _mm_mul_ps(x, z2), yz = _mm_mul_ps(y, z2);
+			const __m128 wx = _mm_mul_ps(w, x2), wy = _mm_mul_ps(w, y2), wz = _mm_mul_ps(w, z2);
+
+			const __m128 m[16]
+			{
+				_mm_mul_ps(sx, _mm_sub_ps(one, _mm_add_ps(yy, zz))), _mm_mul_ps(sx, _mm_add_ps(xy, wz)), _mm_mul_ps(sx, _mm_sub_ps(xz, wy)), zero,
+				_mm_mul_ps(sy, _mm_sub_ps(xy, wz)), _mm_mul_ps(sy, _mm_sub_ps(one, _mm_add_ps(xx, zz))), _mm_mul_ps(sy, _mm_add_ps(yz, wx)), zero,
+				_mm_mul_ps(sz, _mm_add_ps(xz, wy)), _mm_mul_ps(sz, _mm_sub_ps(yz, wx)), _mm_mul_ps(sz, _mm_sub_ps(one, _mm_add_ps(xx, yy))), zero,
+				_mm_loadu_ps(t.PositionX + begin), _mm_loadu_ps(t.PositionY + begin), _mm_loadu_ps(t.PositionZ + begin), one,
+			};
+
+			// Transpose element vectors into rows, rows[r][k] is row r of object k
+			__m128 rows[4][4];
+			for (int r = 0; r < 4; ++r)
+			{
+				__m128 a = transpose ? m[r] : m[r * 4], b = transpose ? m[4 + r] : m[r * 4 + 1];
+				__m128 c = transpose ? m[8 + r] : m[r * 4 + 2], d = transpose ? m[12 + r] : m[r * 4 + 3];
+				_MM_TRANSPOSE4_PS(a, b, c, d);
+				rows[r][0] = a;
+				rows[r][1] = b;
+				rows[r][2] = c;
+				rows[r][3] = d;
+			}
+
+			// Whole matrices in address order
+			for (int k = 0; k < 4; ++k)
+			{
+				float* out = (float*)(output + (begin + k) * stride);
+				for (int r = 0; r < 4; ++r)
+					_mm_storeu_ps(out + r * 4, rows[r][k]);
+			}
+		}
+		ComposeScalar(t, begin, end, output, stride, transpose);
+	}
+
+	//**************************************************
+	/// \brief 8 objects, only called when AVX2 is supported
+	//**************************************************
+	SCENE_TRANSFORM_TARGET_AVX2 void ComposeAvx2(const TransformArrays& t, size_t begin, const size_t end, uint8_t* output, const size_t stride, const bool transpose)
+	{
+		const __m256 one	= _mm256_set1_ps(1.0f);
+		const __m256 zero	= _mm256_setzero_ps();
+		for (; begin + 8 <= end; begin += 8)
+		{
+			const __m256 x = _mm256_loadu_ps(t.RotationX + begin), y = _mm256_loadu_ps(t.RotationY + begin);
+			const __m256 z = _mm256_loadu_ps(t.RotationZ + begin), w = _mm256_loadu_ps(t.RotationW + begin);
+			const __m256 sx = _mm256_loadu_ps(t.ScaleX + begin), sy = _mm256_loadu_ps(t.ScaleY + begin), sz = _mm256_loadu_ps(t.ScaleZ + begin);
+			const __m256 x2 = _mm256_add_ps(x, x), y2 = _mm256_add_ps(y, y), z2 = _mm256_add_ps(z, z);
+			const __m256 xx = _mm256_mul_ps(x, x2), yy = _mm256_mul_ps(y, y2), zz = _mm256_mul_ps(z, z2);
+			const __m256 xy = _mm256_mul_ps(x, y2), xz = _mm256_mul_ps(x, z2), yz = _mm256_mul_ps(y, z2);
+			const __m256 wx = _mm256_mul_ps(w, x2), wy = _mm256_mul_ps(w, y2), wz = _mm256_mul_ps(w, z2);
+
+			const __m256 m[16]
+			{
+				_mm256_mul_ps(sx, _mm256_sub_ps(one, _mm256_add_ps(yy, zz))), _mm256_mul_ps(sx, _mm256_add_ps(xy, wz)), _mm256_mul_ps(sx, _mm256_sub_ps(xz, wy)), zero,
+				_mm256_mul_ps(sy, _mm256_sub_ps(xy, wz)), _mm256_mul_ps(sy, _mm256_sub_ps(one, _mm256_add_ps(xx, zz))), _mm256_mul_ps(sy, _mm256_add_ps(yz, wx)), zero,
+				_mm256_mul_ps(sz, _mm256_add_ps(xz, wy)), _mm256_mul_ps(sz, _mm256_sub_ps(yz, wx)), _mm256_mul_ps(sz, _mm256_sub_ps(one, _mm256_add_ps(xx, yy))), zero,
+				_mm256_loadu_ps(t.PositionX + begin), _mm256_loadu_ps(t.PositionY + begin), _mm256_loadu_ps(t.PositionZ + begin), one,
+			};
+
+			// 4x4 transposes inside each 128 bit lane, rows[r][k] holds object k low and k + 4 high
+			__m256 rows[4][4];
+			for (int r = 0; r < 4; ++r)
+			{
+				const __m256 a = transpose ? m[r] : m[r * 4], b = transpose ? m[4 + r] : m[r * 4 + 1];
+				const __m256 c = transpose ? m[8 + r] : m[r * 4 + 2], d = transpose ? m[12 + r] : m[r * 4 + 3];
+				const __m256 abLow = _mm256_unpacklo_ps(a, b), abHigh = _mm256_unpackhi_ps(a, b);
+				const __m256 cdLow = _mm256_unpacklo_ps(c, d), cdHigh = _mm256_unpackhi_ps(c, d);
+				rows[r][0] = _mm256_shuffle_ps(abLow, cdLow, _MM_SHUFFLE(1, 0, 1, 0));
+				rows[r][1] = _mm256_shuffle_ps(abLow, cdLow, _MM_SHUFFLE(3, 2, 3, 2));
+				rows[r][2] = _mm256_shuffle_ps(abHigh, cdHigh, _MM_SHUFFLE(1, 0, 1, 0));
+				rows[r][3] = _mm256_shuffle_ps(abHigh, cdHigh, _MM_SHUFFLE(3, 2, 3, 2));
+			}
+
+			for (int k = 0; k < 4; ++k)
+			{
+				float* out = (float*)(output + (begin + k) * stride);
+				for (int r = 0; r < 4; ++r)
+					_mm_storeu_ps(out + r * 4, _mm256_castps256_ps128(rows[r][k]));
+			}
+			for (int k = 0; k < 4; ++k)
+			{
+				float* out = (float*)(output + (begin + 4 + k) * stride);
+				for (int r = 0; r < 4; ++r)
+					_mm_storeu_ps(out + r * 4, _mm256_extractf128_ps(rows[r][k], 1));
+			}
+		}
+		ComposeScalar(t, begin, end, output, stride, transpose);
+	}
+
+	//**************************************************
+	/// \brief 16 objects, one 64 byte store per matrix, only called when AVX-512 is supported
+	//**************************************************
+	SCENE_TRANSFORM_TARGET_AVX512 void ComposeAvx512(const TransformArrays& t, size_t begin, const size_t end, uint8_t* output, const size_t stride, const bool transpose)
+	{
+		const __m512 one	= _mm512_set1_ps(1.0f);
+		const __m512 zero	= _mm512_setzero_ps();
+		for (; begin + 16 <= end; begin += 16)
+		{
+			const __m512 x = _mm512_loadu_ps(t.RotationX + begin), y = _mm512_loadu_ps(t.RotationY + begin);
+			const __m512 z = _mm512_loadu_ps(t.RotationZ + begin), w = _mm512_loadu_ps(t.RotationW + begin);
+			const __m512 sx = _mm512_loadu_ps(t.ScaleX + begin), sy = _mm512_loadu_ps(t.ScaleY + begin), sz = _mm512_loadu_ps(t.ScaleZ + begin);
+			const __m512 x2 = _mm512_add_ps(x, x), y2 = _mm512_add_ps(y, y), z2 = _mm512_add_ps(z, z);
+			const __m512 xx = _mm512_mul_ps(x, x2), yy = _mm512_mul_ps(y, y2), zz = _mm512_mul_ps(z, z2);
+			const __m512 xy = _mm512_mul_ps(x, y2), xz = _mm512_mul_ps(x, z2), yz = _mm512_mul_ps(y, z2);
+			const __m512 wx = _mm512_mul_ps(w, x2), wy = _mm512_mul_ps(w, y2), wz = _mm512_mul_ps(w, z2);
+
+			const __m512 m[16]
+			{
+				_mm512_mul_ps(sx, _mm512_sub_ps(one, _mm512_add_ps(yy, zz))), _mm512_mul_ps(sx, _mm512_add_ps(xy, wz)), _mm512_mul_ps(sx, _mm512_sub_ps(xz, wy)), zero,
+				_mm512_mul_ps(sy, _mm512_sub_ps(xy, wz)), _mm512_mul_ps(sy, _mm512_sub_ps(one, _mm512_add_ps(xx, zz))), _mm512_mul_ps(sy, _mm512_add_ps(yz, wx)), zero,
+				_mm512_mul_ps(sz, _mm512_add_ps(xz, wy)), _mm512_mul_ps(sz, _mm512_sub_ps(yz, wx)), _mm512_mul_ps(sz, _mm512_sub_ps(one, _mm512_add_ps(xx, yy))), zero,
+				_mm512_loadu_ps(t.PositionX + begin), _mm512_loadu_ps(t.PositionY + begin), _mm512_loadu_ps(t.PositionZ + begin), one,
+			};
+
+			// 4x4 transposes inside each 128 bit lane, rows[r][k] holds row r of objects k, k + 4, k + 8, k + 12
+			__m512 rows[4][4];
+			for (int r = 0; r < 4; ++r)
+			{
+				const __m512 a = transpose ? m[r] : m[r * 4], b = transpose ? m[4 + r] : m[r * 4 + 1];
+				const __m512 c = transpose ? m[8 + r] : m[r * 4 + 2], d = transpose ? m[12 + r] : m[r * 4 + 3];
+				const __m512 abLow = _mm512_unpacklo_ps(a, b), abHigh = _mm512_unpackhi_ps(a, b);
+				const __m512 cdLow = _mm512_unpacklo_ps(c, d), cdHigh = _mm512_unpackhi_ps(c, d);
+				rows[r][0] = _mm512_shuffle_ps(abLow, cdLow, _MM_SHUFFLE(1, 0, 1, 0));
+				rows[r][1] = _mm512_shuffle_ps(abLow, cdLow, _MM_SHUFFLE(3, 2, 3, 2));
+				rows[r][2] = _mm512_shuffle_ps(abHigh, cdHigh, _MM_SHUFFLE(1, 0, 1, 0));
+				rows[r][3] = _mm512_shuffle_ps(abHigh, cdHigh, _MM_SHUFFLE(3, 2, 3, 2));
+			}
+
+			// Gather the four rows of one object from the same 128 bit lane of rows[0..3][k]
+			__m512 matrices[16];
+			for (int k = 0; k < 4; ++k)
+			{
+				const __m512 rows01Low	= _mm512_shuffle_f32x4(rows[0][k], rows[1][k], 0x44);
+				const __m512 rows23Low	= _mm512_shuffle_f32x4(rows[2][k], rows[3][k], 0x44);
+				const __m512 rows01High	= _mm512_shuffle_f32x4(rows[0][k], rows[1][k], 0xee);
+				const __m512 rows23High	= _mm512_shuffle_f32x4(rows[2][k], rows[3][k], 0xee);
+				matrices[k]			= _mm512_shuffle_f32x4(rows01Low, rows23Low, 0x88);
+				matrices[k + 4]		= _mm512_shuffle_f32x4(rows01Low, rows23Low, 0xdd);
+				matrices[k + 8]		= _mm512_shuffle_f32x4(rows01High, rows23High, 0x88);
+				matrices[k + 12]	= _mm512_shuffle_f32x4(rows01High, rows23High, 0xdd);
+			}
+
+			for (int k = 0; k < 16; ++k)
+				_mm512_storeu_ps(output + (begin + k) * stride, matrices[k]);
+		}
+		ComposeScalar(t, begin, end, output, stride, transpose);
+	}
+#endif
+}
+
+/* Compose with the best kernel */
+void TransformBatch::Compose(const TransformArrays& transforms, const size_t count, void* output, const size_t stride, const bool transpose)
+{
+	TransformBatch::Compose(transforms, count, output, stride, transpose, TransformBatch::Best());
+}
+
+/* Compose */
+void TransformBatch::Compose(const TransformArrays& transforms, const size_t count, void* output, const size_t stride, const bool transpose, const ISA isa)
+{
+	uint8_t* bytes = (uint8_t*)output;
+	switch (TransformBatch::IsSupported(isa) ? isa : ISA::SCALAR)
+	{
+#if defined(SCENE_TRANSFORM_X86)
+	case ISA::SSE2:		ComposeSse2(transforms, 0, count, bytes, stride, transpose);	break;
+	case ISA::AVX2:		ComposeAvx2(transforms, 0, count, bytes, stride, transpose);	break;
+	case ISA::AVX512:	ComposeAvx512(transforms, 0, count, bytes, stride, transpose);	break;
+#endif
+	default:			ComposeScalar(transforms, 0, count, bytes, stride, transpose);	break;
+	}
+}
+
+/* Best kernel */
+TransformBatch::ISA TransformBatch::Best()
+{
+	if (TransformBatch::IsSupported(ISA::AVX512))
+		return ISA::AVX512;
+	if (TransformBatch::IsSupported(ISA::AVX2))
+		return ISA::AVX2;
+	if (TransformBatch::IsSupported(ISA::SSE2))
+		return ISA::SSE2;
+	return ISA::SCALAR;
+}
+
+/* Is supported */
+bool TransformBatch::IsSupported(const ISA isa)
+{
+	switch (isa)
+	{
+	case ISA::SCALAR:	return true;
+#if defined(SCENE_TRANSFORM_X86)
+	case ISA::SSE2:		return true;	// baseline of every x64 processor
+	case ISA::AVX2:		return DetectFeatures().Avx2;
+	case ISA::AVX512:	return DetectFeatures().Avx512;
+#endif
+	default:			return false;
+	}
+}
+
+/* Name */
+const char* TransformBatch::Name(const ISA isa)
+{
+	switch (isa)
+	{
+	case ISA::SCALAR:	return "scalar";
+	case ISA::SSE2:		return "sse2";
+	case ISA::AVX2:		return "avx2";
+	case ISA::AVX512:	return "avx512";
+	default:			return "unknown";
+	}
+}
@@ -0,0 +1,100 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Scene_Transform.h
+*		Detail	: Batched world matrix composition from structure of arrays transforms
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace structure
+{
+	//**************************************************
+	/// \brief Transforms as structure of arrays, element i of every array is object i
+	//**************************************************
+	struct TransformArrays
+	{
+		const float*	PositionX;
+		const float*	PositionY;
+		const float*	PositionZ;
+		const float*	RotationX;	// unit quaternion
+		const float*	RotationY;
+		const float*	RotationZ;
+		const float*	RotationW;
+		const float*	ScaleX;
+		const float*	ScaleY;
+		const float*	ScaleZ;
+	};
+}
+
+class TransformBatch
+{
+public:
+	//**************************************************
+	/// \brief Kernel width, SSE2 4 objects, AVX2 8, AVX-512 16 per iteration
+	//**************************************************
+	enum class ISA
+	{
+		SCALAR,
+		SSE2,
+		AVX2,
+		AVX512,
+		NUM
+	};
+
+public:
+	//**************************************************
+	/// \brief Compose world = scale * rotation * translation (row vector) with the best kernel
+	///        Rows are written in order with full 16 byte stores, so output can be
+	///        write combined upload memory such as ObjectConstants::World of a mapped ring
+	///
+	/// \param[in]  transforms	 ->	input arrays
+	/// \param[in]  count		 ->	number of objects
+	/// \param[out] output		 ->	first matrix, 16 floats
+	/// \param[in]  stride		 ->	bytes between matrices (sizeof(XMFLOAT4X4) for an array)
+	/// \param[in]  transpose	 ->	write column major for column_major cbuffers
+	///
+	/// \return none
+	//**************************************************
+	static void Compose(
+		const structure::TransformArrays& transforms,
+		const size_t count,
+		void* output,
+		const size_t stride,
+		const bool transpose
+	);
+
+	//**************************************************
+	/// \brief Compose with a given kernel, falls back to SCALAR when unsupported
+	//**************************************************
+	static void Compose(
+		const structure::TransformArrays& transforms,
+		const size_t count,
+		void* output,
+		const size_t stride,
+		const bool transpose,
+		const ISA isa
+	);
+
+	//**************************************************
+	/// \brief Widest kernel the processor and the os support
+	///
+	/// \return kernel used by Compose
+	//**************************************************
+	static ISA Best();
+
+	//**************************************************
+	/// \brief Kernel is supported by the processor and the os
+	///
+	/// \return if supported then true
+	//**************************************************
+	static bool IsSupported(const ISA isa);
+
+	//**************************************************
+	/// \brief Lower case name for reports
+	///
+	/// \return name
+	//**************************************************
+	static const char* Name(const ISA isa);
+};
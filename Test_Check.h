@@ -0,0 +1,44 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Test_Check.h
+*		Detail	: Minimal checks for the unit test executables
+===================================================================================*/
+#pragma once
+#include <cstdio>
+
+namespace test
+{
+	//**************************************************
+	/// \brief Failed checks of the process, main returns non zero when any failed
+	//**************************************************
+	inline int& FailureNum()
+	{
+		static int failureNum = 0;
+		return failureNum;
+	}
+
+	//**************************************************
+	/// \brief Print a failed check
+	///
+	/// \return none
+	//**************************************************
+	inline void Fail(const char* file, const int line, const char* expression)
+	{
+		std::printf("%s(%d): check failed: %s\n", file, line, expression);
+		++FailureNum();
+	}
+
+	//**************************************************
+	/// \brief Exit code and summary of the process
+	///
+	/// \return 0 when every check passed
+	//**************************************************
+	inline int Finish(const char* name)
+	{
+		std::printf("%s: %d failed\n", name, FailureNum());
+		return FailureNum() == 0 ? 0 : 1;
+	}
+}
+
+#define TEST_CHECK(expression)	do { if (!(expression)) test::Fail(__FILE__, __LINE__, #expression); } while (false)
@@ -0,0 +1,189 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Test_HandlePool.cpp
+*		Detail	: Unit tests of HandlePool
+===================================================================================*/
+#include <string>
+#include <vector>
+
+#include "Handle_Pool.h"
+#include "Test_Check.h"
+
+namespace
+{
+	struct Item;	// tag only
+	using Pool = HandlePool<Item, uint32_t, std::string>;
+
+	//**************************************************
+	/// \brief Create, destroy and reuse of a slot
+	//**************************************************
+	void TestLifetime()
+	{
+		Pool pool;
+		TEST_CHECK(pool.Empty() && !pool.IsValid(Pool::Handle{}));
+
+		const Pool::Handle a = pool.Create(1, "a");
+		const Pool::Handle b = pool.Create(2, "b");
+		TEST_CHECK(a.IsValid() && b.IsValid() && a != b);
+		TEST_CHECK(pool.Size() == 2);
+		TEST_CHECK(*pool.Get<0>(a) == 1 && *pool.Get<1>(b) == "b");
+
+		TEST_CHECK(pool.Destroy(a));
+		TEST_CHECK(!pool.IsValid(a) && pool.IsValid(b));
+		TEST_CHECK(pool.Size() == 1);
+
+		// The freed slot is reused with the next generation
+		const Pool::Handle c = pool.Create(3, "c");
+		TEST_CHECK((c.Value & Pool::k_indexMask) == (a.Value & Pool::k_indexMask));
+		TEST_CHECK(c != a && pool.IsValid(c));
+		TEST_CHECK(*pool.Get<0>(c) == 3 && *pool.Get<1>(c) == "c");
+	}
+
+	//**************************************************
+	/// \brief Stale and foreign handles are rejected everywhere
+	//**************************************************
+	void TestStale()
+	{
+		Pool pool;
+		const Pool::Handle a = pool.Create(1, "a");
+		pool.Destroy(a);
+		const Pool::Handle reused = pool.Create(2, "b");
+
+		TEST_CHECK(!pool.IsValid(a));
+		TEST_CHECK(pool.Get<0>(a) == nullptr && pool.Get<1>(a) == nullptr);
+		TEST_CHECK(!pool.Destroy(a));
+		TEST_CHECK(pool.IsValid(reused) && pool.Size() == 1);
+
+		// Slot beyond the pool, zero handle
+		TEST_CHECK(!pool.IsValid(Pool::Handle{ (1u << Pool::k_indexBits) | 5u }));
+		TEST_CHECK(!pool.Destroy(Pool::Handle{}));
+		TEST_CHECK(pool.Get<0>(Pool::Handle{}) == nullptr);
+	}
+
+	//**************************************************
+	/// \brief Destroy moves the last element into the hole, Get follows it
+	//**************************************************
+	void TestSwapRemove()
+	{
+		Pool pool;
+		std::vector<Pool::Handle> handles;
+		for (uint32_t i = 0; i < 64; ++i)
+			handles.push_back(pool.Create(i, std::to_string(i)));
+
+		// Every third element, the holes are filled from the back
+		for (uint32_t i = 0; i < 64; i += 3)
+			pool.Destroy(handles[i]);
+
+		bool correct = true;
+		for (uint32_t i = 0; i < 64; ++i)
+		{
+			if (i % 3 == 0)
+				correct = correct && !pool.IsValid(handles[i]);
+			else
+				correct = correct && *pool.Get<0>(handles[i]) == i && *pool.Get<1>(handles[i]) == std::to_string(i);
+		}
+		TEST_CHECK(correct);
+
+		// Dense columns are packed and HandleAt maps back
+		bool dense = true;
+		for (size_t d = 0; d < pool.Size(); ++d)
+		{
+			const Pool::Handle handle = pool.HandleAt(d);
+			dense = dense && pool.Get<0>(handle) == pool.Data<0>() + d && pool.Get<1>(handle) == pool.Data<1>() + d;
+		}
+		TEST_CHECK(dense && pool.Size() == 64 - 22);
+	}
+
+	//**************************************************
+	/// \brief Clear invalidates every handle and keeps the slots for reuse
+	//**************************************************
+	void TestClear()
+	{
+		Pool pool;
+		std::vector<Pool::Handle> handles;
+		for (uint32_t i = 0; i < 16; ++i)
+			handles.push_back(pool.Create(i, ""));
+
+		pool.Clear();
+		TEST_CHECK(pool.Empty());
+
+		bool stale = true;
+		for (const Pool::Handle handle : handles)
+			stale = stale && !pool.IsValid(handle);
+		TEST_CHECK(stale);
+
+		// New handles reuse slots, none of them equals an old one
+		bool fresh = true;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			const Pool::Handle handle = pool.Create(i, "");
+			fresh = fresh && (handle.Value & Pool::k_indexMask) < 16;
+			for (const Pool::Handle old : handles)
+				fresh = fresh && handle != old;
+		}
+		TEST_CHECK(fresh);
+	}
+
+	//**************************************************
+	/// \brief 2^20 live slots, the next Create fails until one is destroyed
+	//**************************************************
+	void TestCapacity()
+	{
+		HandlePool<Item, uint32_t> pool;
+		const uint32_t slotNum = Pool::k_indexMask + 1;
+		pool.Reserve(slotNum);
+
+		Pool::Handle last;
+		bool created = true;
+		for (uint32_t i = 0; i < slotNum; ++i)
+		{
+			last = pool.Create(i);
+			created = created && last.IsValid();
+		}
+		TEST_CHECK(created && pool.Size() == slotNum);
+		TEST_CHECK((last.Value & Pool::k_indexMask) == Pool::k_indexMask);
+		TEST_CHECK(*pool.Get<0>(last) == slotNum - 1);
+
+		TEST_CHECK(!pool.Create(0).IsValid());
+		TEST_CHECK(pool.Size() == slotNum);
+
+		pool.Destroy(last);
+		const Pool::Handle reused = pool.Create(7);
+		TEST_CHECK(reused.IsValid() && *pool.Get<0>(reused) == 7);
+	}
+
+	//**************************************************
+	/// \brief Documented limit, the generation wraps after 4095 reuses of a slot
+	//**************************************************
+	void TestGenerationWrap()
+	{
+		Pool pool;
+		const Pool::Handle first = pool.Create(0, "");
+		Pool::Handle handle = first;
+		bool repeated = false;
+		for (uint32_t i = 0; i < Pool::k_generationMask; ++i)
+		{
+			pool.Destroy(handle);
+			handle = pool.Create(i, "");
+			repeated = repeated || handle.Value == 0 || (i + 1 < Pool::k_generationMask && handle == first);
+		}
+		TEST_CHECK(!repeated);
+
+		// Every generation but the last differs, the 4095th reuse repeats the first handle
+		TEST_CHECK(handle == first);
+		TEST_CHECK(*pool.Get<0>(first) == Pool::k_generationMask - 1);
+	}
+}
+
+/* main */
+int main()
+{
+	TestLifetime();
+	TestStale();
+	TestSwapRemove();
+	TestClear();
+	TestCapacity();
+	TestGenerationWrap();
+	return test::Finish("HandlePool");
+}
@@ -0,0 +1,156 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Test_MeshFile.cpp
+*		Detail	: Unit tests of MeshFile
+===================================================================================*/
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "Mesh_File.h"
+#include "Test_Check.h"
+using namespace structure;
+
+namespace
+{
+	const wchar_t*	k_fileName		= L"test_meshfile.mesh";
+	const char*		k_fileNameA		= "test_meshfile.mesh";
+
+	//**************************************************
+	/// \brief Grid of side x side quads, row order
+	//**************************************************
+	MeshData BuildGrid(const uint32_t side)
+	{
+		MeshData mesh;
+		for (uint32_t y = 0; y <= side; ++y)
+		{
+			for (uint32_t x = 0; x <= side; ++x)
+			{
+				const float u = float(x) / float(side), v = float(y) / float(side);
+				mesh.Vertices.push_back(Vertex3D{ { u, v, 0.0f }, { 0.0f, 0.0f, -1.0f }, { u, v } });
+			}
+		}
+		for (uint32_t y = 0; y < side; ++y)
+		{
+			for (uint32_t x = 0; x < side; ++x)
+			{
+				const uint32_t i0 = y * (side + 1) + x, i1 = i0 + 1, i2 = i0 + side + 1, i3 = i2 + 1;
+				mesh.Indices.insert(mesh.Indices.end(), { i0, i2, i1, i1, i2, i3 });
+			}
+		}
+		return mesh;
+	}
+
+	//**************************************************
+	/// \brief Indices of the opened file, each submesh adds its BaseVertex as DrawIndexed does
+	//**************************************************
+	std::vector<uint32_t> DrawnIndices(const MeshFile& file)
+	{
+		const MeshFile::Header* header = file.GetHeader();
+		std::vector<uint32_t> indices(header->IndexNum, UINT32_MAX);
+		for (uint32_t s = 0; s < header->SubmeshNum; ++s)
+		{
+			const MeshFile::Submesh& submesh = file.Submeshes()[s];
+			for (uint32_t i = submesh.StartIndex; i < submesh.StartIndex + submesh.IndexNum; ++i)
+			{
+				const uint32_t index = header->IndexSize == sizeof(uint16_t) ? ((const uint16_t*)file.Indices())[i] : ((const uint32_t*)file.Indices())[i];
+				indices[i] = uint32_t(submesh.BaseVertex) + index;
+			}
+		}
+		return indices;
+	}
+
+	//**************************************************
+	/// \brief Write, open and compare streams and draw ranges with the source
+	//**************************************************
+	void CheckRoundTrip(const MeshData& mesh, const MeshIndex::Buffer& buffer)
+	{
+		TEST_CHECK(MeshFile::Write(k_fileName, mesh, buffer));
+
+		MeshFile file;
+		TEST_CHECK(file.Open(k_fileName));
+		if (!file.IsOpen())
+			return;
+
+		const MeshFile::Header* header = file.GetHeader();
+		TEST_CHECK(header->VertexNum == mesh.Vertices.size());
+		TEST_CHECK(header->IndexNum == mesh.Indices.size());
+		TEST_CHECK(header->IndexSize == buffer.IndexSize());
+		TEST_CHECK(header->SubmeshNum == buffer.Chunks.size());
+		TEST_CHECK(header->VertexOffset % MeshFile::k_streamAlignment == 0 && header->IndexOffset % MeshFile::k_streamAlignment == 0);
+		TEST_CHECK(file.VertexBytes() == mesh.Vertices.size() * sizeof(Vertex3D));
+		TEST_CHECK(std::memcmp(file.Vertices(), mesh.Vertices.data(), file.VertexBytes()) == 0);
+		TEST_CHECK(std::memcmp(file.Indices(), buffer.Data(), file.IndexBytes()) == 0);
+		TEST_CHECK(DrawnIndices(file) == mesh.Indices);
+	}
+
+	//**************************************************
+	/// \brief More than 65536 vertices, 16 bit chunks with their own base vertex
+	//**************************************************
+	void TestChunked()
+	{
+		const MeshData mesh = BuildGrid(300);
+		MeshIndex::Buffer buffer;
+		TEST_CHECK(MeshIndex::Build(mesh.Indices.data(), mesh.Indices.size(), &buffer));
+		TEST_CHECK(buffer.Chunks.size() > 1 && buffer.Chunks.back().BaseVertex != 0);
+		CheckRoundTrip(mesh, buffer);
+	}
+
+	//**************************************************
+	/// \brief One chunk that does not start at vertex 0 keeps its base
+	//**************************************************
+	void TestBaseVertex()
+	{
+		MeshData mesh = BuildGrid(4);
+		for (uint32_t& index : mesh.Indices)
+			index += 8;
+		mesh.Vertices.insert(mesh.Vertices.begin(), 8, Vertex3D{ { 9.0f, 9.0f, 9.0f }, {}, {} });
+
+		MeshIndex::Buffer buffer;
+		TEST_CHECK(MeshIndex::Build(mesh.Indices.data(), mesh.Indices.size(), &buffer));
+		TEST_CHECK(buffer.Chunks.size() == 1 && buffer.Chunks[0].BaseVertex == 8);
+		CheckRoundTrip(mesh, buffer);
+	}
+
+	//**************************************************
+	/// \brief Missing and truncated files do not open
+	//**************************************************
+	void TestRejects()
+	{
+		MeshFile file;
+		TEST_CHECK(!file.Open(L"test_meshfile_missing.mesh") && !file.IsOpen());
+
+		const MeshData mesh = BuildGrid(4);
+		MeshIndex::Buffer buffer;
+		MeshIndex::Build(mesh.Indices.data(), mesh.Indices.size(), &buffer);
+		TEST_CHECK(MeshFile::Write(k_fileName, mesh, buffer));
+
+		// Drop the submesh table, the size no longer matches the header
+		std::vector<char> bytes;
+		if (FILE* in = std::fopen(k_fileNameA, "rb"))
+		{
+			char block[4096];
+			for (size_t read; (read = std::fread(block, 1, sizeof(block), in)) > 0;)
+				bytes.insert(bytes.end(), block, block + read);
+			std::fclose(in);
+		}
+		bytes.resize(bytes.size() - sizeof(MeshFile::Submesh));
+		if (FILE* out = std::fopen(k_fileNameA, "wb"))
+		{
+			std::fwrite(bytes.data(), 1, bytes.size(), out);
+			std::fclose(out);
+		}
+		TEST_CHECK(!file.Open(k_fileName) && !file.IsOpen());
+	}
+}
+
+/* main */
+int main()
+{
+	TestChunked();
+	TestBaseVertex();
+	TestRejects();
+	std::remove(k_fileNameA);
+	return test::Finish("MeshFile");
+}
@@ -0,0 +1,139 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Test_MeshLod.cpp
+*		Detail	: Unit tests of LodSelector
+===================================================================================*/
+#include <vector>
+
+#include "Mesh_Lod.h"
+#include "Test_Check.h"
+using namespace structure;
+
+namespace
+{
+	// Errors 0, 1, 2, 4 with 1000, 500, 250, 100 triangles
+	const LodLevel k_levels[4] = { { 0, 3000, 0.0f }, { 0, 1500, 1.0f }, { 0, 750, 2.0f }, { 0, 300, 4.0f } };
+
+	//**************************************************
+	/// \brief Instances on the z axis, one unit of error per unit of distance at PixelError 1
+	//**************************************************
+	struct Row
+	{
+		std::vector<float>		Zero;
+		std::vector<float>		Z;
+		std::vector<uint32_t>	Mesh;
+
+		Row(const size_t num, const uint32_t mesh) :Zero(num, 0.0f), Z(num, 0.0f), Mesh(num, mesh) {}
+
+		uint64_t Select(LodSelector* selector, const float distance)
+		{
+			for (float& z : Z)
+				z = distance;
+			const LodSelector::Camera camera{ { 0.0f, 0.0f, 0.0f }, 1.0f };
+			const LodSelector::Instances instances{ Zero.data(), Zero.data(), Z.data(), Zero.data(), Mesh.data(), nullptr, Z.size() };
+			return selector->Select(camera, instances);
+		}
+	};
+
+	//**************************************************
+	/// \brief Count level changes while the distance wobbles around the level 1 threshold
+	//**************************************************
+	uint32_t CountChanges(const float hysteresis, const uint32_t startLevel)
+	{
+		LodSelector selector;
+		LodSelector::Settings settings;
+		settings.Hysteresis = hysteresis;
+		selector.SetSettings(settings);
+		const uint32_t mesh = selector.AddMesh(k_levels, 4);
+
+		Row row(1, mesh);
+		row.Select(&selector, startLevel == 0 ? 0.5f : 1.5f);
+		TEST_CHECK(selector.Level(0) == startLevel);
+
+		uint32_t changes = 0;
+		uint32_t level = selector.Level(0);
+		for (uint32_t frame = 0; frame < 16; ++frame)
+		{
+			row.Select(&selector, frame % 2 == 0 ? 1.02f : 0.98f);
+			changes += selector.Level(0) != level ? 1 : 0;
+			level = selector.Level(0);
+		}
+		return changes;
+	}
+
+	//**************************************************
+	/// \brief Coarser levels need headroom, so the level does not flip every frame at a threshold
+	//**************************************************
+	void TestHysteresis()
+	{
+		// Without hysteresis every frame crosses the threshold
+		TEST_CHECK(CountChanges(0.0f, 0) == 16);
+
+		// Coming from level 0 it never leaves, coming from level 1 it drops once and stays
+		TEST_CHECK(CountChanges(0.25f, 0) == 0);
+		TEST_CHECK(CountChanges(0.25f, 1) == 1);
+
+		// Past the headroom it goes coarser, 1.4 * 0.75 >= 1
+		LodSelector selector;
+		Row row(1, selector.AddMesh(k_levels, 4));
+		row.Select(&selector, 1.2f);
+		TEST_CHECK(selector.Level(0) == 0);
+		TEST_CHECK(row.Select(&selector, 1.4f) == 500 && selector.Level(0) == 1);
+		TEST_CHECK(row.Select(&selector, 1.2f) == 500 && selector.Level(0) == 1);
+		TEST_CHECK(row.Select(&selector, 0.9f) == 1000 && selector.Level(0) == 0);
+	}
+
+	//**************************************************
+	/// \brief Over budget the next frames scale the error up and pick coarser levels
+	//**************************************************
+	void TestBudget()
+	{
+		LodSelector selector;
+		Row row(4, selector.AddMesh(k_levels, 4));
+		TEST_CHECK(row.Select(&selector, 0.9f) == 4000 && selector.Bias() == 1.0f);
+
+		LodSelector::Settings settings;
+		settings.TriangleBudget = 1000;
+		selector.SetSettings(settings);
+		TEST_CHECK(row.Select(&selector, 0.9f) == 4000 && selector.Bias() > 1.0f);
+
+		uint64_t triangleNum = 0;
+		for (uint32_t frame = 0; frame < 8; ++frame)
+			triangleNum = row.Select(&selector, 0.9f);
+		TEST_CHECK(triangleNum <= settings.TriangleBudget);
+		TEST_CHECK(selector.Level(0) >= 2 && selector.Level(3) == selector.Level(0));
+		TEST_CHECK(selector.Bias() > 1.0f && selector.Bias() <= LodSelector::k_maxBias);
+
+		// An unlimited budget resets the scale
+		selector.SetSettings(LodSelector::Settings());
+		row.Select(&selector, 0.9f);
+		TEST_CHECK(selector.Bias() == 1.0f);
+	}
+
+	//**************************************************
+	/// \brief A mesh without levels is always level 0
+	//**************************************************
+	void TestEmptyChain()
+	{
+		LodSelector selector;
+		Row row(5, selector.AddMesh(nullptr, 0));
+		for (const float distance : { 0.0f, 1.0f, 100.0f, 1e6f })
+		{
+			TEST_CHECK(row.Select(&selector, distance) == 0);
+			bool level0 = true;
+			for (size_t i = 0; i < 5; ++i)
+				level0 = level0 && selector.Level(i) == 0;
+			TEST_CHECK(level0);
+		}
+	}
+}
+
+/* main */
+int main()
+{
+	TestHysteresis();
+	TestBudget();
+	TestEmptyChain();
+	return test::Finish("MeshLod");
+}
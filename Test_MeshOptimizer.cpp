@@ -0,0 +1,243 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Test_MeshOptimizer.cpp
+*		Detail	: Unit tests of MeshOptimizer
+===================================================================================*/
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "Mesh_Optimizer.h"
+#include "Test_Check.h"
+using namespace structure;
+
+namespace
+{
+	using Triangle = std::array<Vertex3D, 3>;
+
+	//**************************************************
+	/// \brief Bytes of a vertex in a strict weak order
+	//**************************************************
+	bool Less(const Vertex3D& a, const Vertex3D& b)
+	{
+		return std::memcmp(&a, &b, sizeof(Vertex3D)) < 0;
+	}
+
+	//**************************************************
+	/// \brief Grid of side x side quads on a unit square, row order
+	///
+	/// \param[in] split	 ->	every triangle gets its own three vertices
+	//**************************************************
+	MeshData BuildGrid(const uint32_t side, const bool split)
+	{
+		MeshData mesh;
+		for (uint32_t y = 0; y <= side; ++y)
+		{
+			for (uint32_t x = 0; x <= side; ++x)
+			{
+				const float u = float(x) / float(side), v = float(y) / float(side);
+				mesh.Vertices.push_back(Vertex3D{ { u, v, 0.0f }, { 0.0f, 0.0f, -1.0f }, { u, v } });
+			}
+		}
+		for (uint32_t y = 0; y < side; ++y)
+		{
+			for (uint32_t x = 0; x < side; ++x)
+			{
+				const uint32_t i0 = y * (side + 1) + x, i1 = i0 + 1, i2 = i0 + side + 1, i3 = i2 + 1;
+				mesh.Indices.insert(mesh.Indices.end(), { i0, i2, i1, i1, i2, i3 });
+			}
+		}
+
+		if (split)
+		{
+			std::vector<Vertex3D> vertices;
+			for (uint32_t& index : mesh.Indices)
+			{
+				vertices.push_back(mesh.Vertices[index]);
+				index = uint32_t(vertices.size() - 1);
+			}
+			mesh.Vertices = vertices;
+		}
+		return mesh;
+	}
+
+	//**************************************************
+	/// \brief Shuffle triangle order, corners keep their winding
+	//**************************************************
+	void ShuffleTriangles(MeshData* mesh, const uint32_t seed)
+	{
+		std::vector<std::array<uint32_t, 3>> triangles(mesh->Indices.size() / 3);
+		std::memcpy(triangles.data(), mesh->Indices.data(), mesh->Indices.size() * sizeof(uint32_t));
+		std::shuffle(triangles.begin(), triangles.end(), std::mt19937(seed));
+		std::memcpy(mesh->Indices.data(), triangles.data(), mesh->Indices.size() * sizeof(uint32_t));
+	}
+
+	//**************************************************
+	/// \brief Triangles by vertex contents, each rotated to start at its
+	///        smallest corner so winding is kept, then sorted
+	//**************************************************
+	std::vector<Triangle> TriangleSet(const MeshData& mesh)
+	{
+		std::vector<Triangle> triangles;
+		for (size_t i = 0; i + 2 < mesh.Indices.size(); i += 3)
+		{
+			Triangle triangle{ mesh.Vertices[mesh.Indices[i]], mesh.Vertices[mesh.Indices[i + 1]], mesh.Vertices[mesh.Indices[i + 2]] };
+			const size_t first = size_t(std::min_element(triangle.begin(), triangle.end(), Less) - triangle.begin());
+			std::rotate(triangle.begin(), triangle.begin() + first, triangle.end());
+			triangles.push_back(triangle);
+		}
+		std::sort(triangles.begin(), triangles.end(), [](const Triangle& a, const Triangle& b)
+		{
+			return std::memcmp(a.data(), b.data(), sizeof(Triangle)) < 0;
+		});
+		return triangles;
+	}
+
+	bool SameTriangles(const std::vector<Triangle>& a, const std::vector<Triangle>& b)
+	{
+		return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(Triangle)) == 0;
+	}
+
+	bool IndicesInRange(const MeshData& mesh)
+	{
+		return std::all_of(mesh.Indices.begin(), mesh.Indices.end(), [&](uint32_t index) { return index < mesh.Vertices.size(); });
+	}
+
+	//**************************************************
+	/// \brief Exact statistics of small lists
+	//**************************************************
+	void TestAnalyze()
+	{
+		const uint32_t single[3]{ 0, 1, 2 };
+		MeshOptimizer::Statistics statistics = MeshOptimizer::Analyze(single, 3, 3);
+		TEST_CHECK(statistics.TriangleNum == 1 && statistics.VertexNum == 3);
+		TEST_CHECK(statistics.ACMR == 3.0f && statistics.ATVR == 1.0f);
+
+		// A quad shares an edge, the second triangle adds one vertex
+		const uint32_t quad[6]{ 0, 1, 2, 2, 1, 3 };
+		statistics = MeshOptimizer::Analyze(quad, 6, 4);
+		TEST_CHECK(statistics.ACMR == 2.0f && statistics.ATVR == 1.0f);
+
+		// A cache of 3 entries drops vertex 0 before it comes back
+		const uint32_t fan[9]{ 0, 1, 2, 3, 4, 5, 0, 1, 2 };
+		statistics = MeshOptimizer::Analyze(fan, 9, 6, 3);
+		TEST_CHECK(statistics.ACMR == 3.0f && statistics.ATVR == 1.5f);
+	}
+
+	//**************************************************
+	/// \brief Weld merges the corners split per triangle back to the grid vertices
+	//**************************************************
+	void TestWeld()
+	{
+		const uint32_t side = 8;
+		MeshData mesh = BuildGrid(side, true);
+		const std::vector<Triangle> before = TriangleSet(mesh);
+		const size_t splitNum = mesh.Vertices.size();
+
+		const size_t removed = MeshOptimizer::Weld(&mesh);
+		TEST_CHECK(mesh.Vertices.size() == size_t(side + 1) * (side + 1));
+		TEST_CHECK(removed == splitNum - mesh.Vertices.size());
+		TEST_CHECK(IndicesInRange(mesh));
+		TEST_CHECK(SameTriangles(before, TriangleSet(mesh)));
+
+		// Nothing left to merge
+		TEST_CHECK(MeshOptimizer::Weld(&mesh) == 0);
+
+		// Vertices that differ in any attribute stay apart
+		MeshData seam = BuildGrid(1, true);
+		seam.Vertices[3].TexCoord.x += 1.0f;
+		const size_t seamBefore = seam.Vertices.size();
+		MeshOptimizer::Weld(&seam);
+		TEST_CHECK(seam.Vertices.size() == 5 && seamBefore == 6);
+	}
+
+	//**************************************************
+	/// \brief Every pass keeps the triangles, the passes reorder only
+	//**************************************************
+	void TestPassesKeepTriangles()
+	{
+		MeshData mesh = BuildGrid(40, false);
+		ShuffleTriangles(&mesh, 7);
+		const std::vector<Triangle> source = TriangleSet(mesh);
+
+		MeshOptimizer::OptimizeVertexCache(mesh.Indices.data(), mesh.Indices.size(), mesh.Vertices.size());
+		TEST_CHECK(SameTriangles(source, TriangleSet(mesh)));
+
+		MeshOptimizer::OptimizeOverdraw(mesh.Indices.data(), mesh.Indices.size(), mesh.Vertices.data(), mesh.Vertices.size(), 1.05f);
+		TEST_CHECK(SameTriangles(source, TriangleSet(mesh)));
+
+		MeshOptimizer::OptimizeVertexFetch(&mesh);
+		TEST_CHECK(IndicesInRange(mesh));
+		TEST_CHECK(SameTriangles(source, TriangleSet(mesh)));
+
+		// Vertex fetch order is the order of first use
+		uint32_t next = 0;
+		bool ordered = true;
+		for (uint32_t index : mesh.Indices)
+		{
+			ordered = ordered && index <= next;
+			next = (std::max)(next, index + 1);
+		}
+		TEST_CHECK(ordered);
+
+		// Unreferenced vertices are removed
+		MeshData unused = BuildGrid(2, false);
+		unused.Vertices.push_back(Vertex3D{ { 9.0f, 9.0f, 9.0f }, {}, {} });
+		MeshOptimizer::OptimizeVertexFetch(&unused);
+		TEST_CHECK(unused.Vertices.size() == 9);
+
+		// The whole pipeline on split vertices
+		MeshData split = BuildGrid(20, true);
+		ShuffleTriangles(&split, 3);
+		const std::vector<Triangle> splitSource = TriangleSet(split);
+		MeshOptimizer::Optimize(&split, MeshOptimizer::Options());
+		TEST_CHECK(split.Vertices.size() == 21 * 21);
+		TEST_CHECK(SameTriangles(splitSource, TriangleSet(split)));
+	}
+
+	//**************************************************
+	/// \brief A shuffled 100x100 grid misses almost every vertex, the cache
+	///        order brings it near the ideal of one vertex per two triangles
+	//**************************************************
+	void TestGridEfficiency()
+	{
+		MeshData mesh = BuildGrid(100, false);
+		const MeshOptimizer::Statistics rowOrder = MeshOptimizer::Analyze(mesh.Indices.data(), mesh.Indices.size(), mesh.Vertices.size());
+		TEST_CHECK(rowOrder.TriangleNum == 20000 && rowOrder.VertexNum == 101 * 101);
+		TEST_CHECK(rowOrder.ACMR > 0.9f && rowOrder.ACMR < 1.1f);	// a row of 101 vertices does not fit in 16 entries
+
+		ShuffleTriangles(&mesh, 1);
+		const MeshOptimizer::Statistics shuffled = MeshOptimizer::Analyze(mesh.Indices.data(), mesh.Indices.size(), mesh.Vertices.size());
+		TEST_CHECK(shuffled.ACMR > 2.8f);
+		TEST_CHECK(shuffled.ATVR > 5.5f);
+
+		MeshOptimizer::OptimizeVertexCache(mesh.Indices.data(), mesh.Indices.size(), mesh.Vertices.size());
+		const MeshOptimizer::Statistics cache = MeshOptimizer::Analyze(mesh.Indices.data(), mesh.Indices.size(), mesh.Vertices.size());
+		TEST_CHECK(cache.ACMR < 0.75f);
+		TEST_CHECK(cache.ATVR < 1.5f);
+		TEST_CHECK(cache.ACMR < rowOrder.ACMR);
+
+		// Overdraw order may give back at most its threshold
+		MeshOptimizer::OptimizeOverdraw(mesh.Indices.data(), mesh.Indices.size(), mesh.Vertices.data(), mesh.Vertices.size(), 1.05f);
+		const MeshOptimizer::Statistics overdraw = MeshOptimizer::Analyze(mesh.Indices.data(), mesh.Indices.size(), mesh.Vertices.size());
+		TEST_CHECK(overdraw.ACMR <= cache.ACMR * 1.05f + 1e-4f);
+
+		// Vertex fetch order does not change which vertices hit the cache
+		MeshOptimizer::OptimizeVertexFetch(&mesh);
+		const MeshOptimizer::Statistics fetch = MeshOptimizer::Analyze(mesh.Indices.data(), mesh.Indices.size(), mesh.Vertices.size());
+		TEST_CHECK(fetch.ACMR == overdraw.ACMR);
+	}
+}
+
+/* main */
+int main()
+{
+	TestAnalyze();
+	TestWeld();
+	TestPassesKeepTriangles();
+	TestGridEfficiency();
+	return test::Finish("MeshOptimizer");
+}
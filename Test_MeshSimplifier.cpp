@@ -0,0 +1,169 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Test_MeshSimplifier.cpp
+*		Detail	: Unit tests of MeshSimplifier
+===================================================================================*/
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "Mesh_Simplifier.h"
+#include "Test_Check.h"
+using namespace structure;
+
+namespace
+{
+	//**************************************************
+	/// \brief Unit uv sphere, the column u = 1 repeats the positions of u = 0
+	///        and every vertex of a pole row shares the pole position
+	//**************************************************
+	MeshData BuildSphere(const uint32_t segments, const uint32_t rings)
+	{
+		const float pi = 3.14159265f;
+		MeshData mesh;
+		for (uint32_t y = 0; y <= rings; ++y)
+		{
+			for (uint32_t x = 0; x <= segments; ++x)
+			{
+				const float u = float(x) / float(segments), v = float(y) / float(rings);
+				const float theta = u * 2.0f * pi, phi = v * pi;
+				DirectX::XMFLOAT3 position(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+				if (x == segments)	// bit exact with the first column
+					position = mesh.Vertices[y * (segments + 1)].Position;
+				if (y == 0 || y == rings)
+					position = DirectX::XMFLOAT3(0.0f, y == 0 ? 1.0f : -1.0f, 0.0f);
+				mesh.Vertices.push_back(Vertex3D{ position, position, { u, v } });
+			}
+		}
+		for (uint32_t y = 0; y < rings; ++y)
+		{
+			for (uint32_t x = 0; x < segments; ++x)
+			{
+				const uint32_t i0 = y * (segments + 1) + x, i1 = i0 + 1, i2 = i0 + segments + 1, i3 = i2 + 1;
+				if (y != 0)
+					mesh.Indices.insert(mesh.Indices.end(), { i0, i1, i2 });
+				if (y != rings - 1)
+					mesh.Indices.insert(mesh.Indices.end(), { i1, i3, i2 });
+			}
+		}
+		return mesh;
+	}
+
+	//**************************************************
+	/// \brief Largest distance of a face center inside the unit sphere
+	//**************************************************
+	float SphereDeviation(const MeshData& mesh, const std::vector<uint32_t>& indices)
+	{
+		float deviation = 0.0f;
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			DirectX::XMFLOAT3 center(0.0f, 0.0f, 0.0f);
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				const DirectX::XMFLOAT3& p = mesh.Vertices[indices[i + c]].Position;
+				center.x += p.x / 3.0f;	center.y += p.y / 3.0f;	center.z += p.z / 3.0f;
+			}
+			const float radius = std::sqrt(center.x * center.x + center.y * center.y + center.z * center.z);
+			deviation = (std::max)(deviation, 1.0f - radius);
+		}
+		return deviation;
+	}
+
+	//**************************************************
+	/// \brief Position edges used by exactly one triangle, a closed surface has none
+	//**************************************************
+	size_t OpenEdgeNum(const MeshData& mesh, const std::vector<uint32_t>& indices)
+	{
+		auto key = [&](uint32_t index)
+		{
+			const DirectX::XMFLOAT3& p = mesh.Vertices[index].Position;
+			return std::make_pair(std::make_pair(p.x, p.y), p.z);
+		};
+		std::multiset<std::pair<decltype(key(0)), decltype(key(0))>> edges;
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			for (uint32_t e = 0; e < 3; ++e)
+			{
+				auto a = key(indices[i + e]), b = key(indices[i + (e + 1) % 3]);
+				edges.insert((std::min)(a, b) == a ? std::make_pair(a, b) : std::make_pair(b, a));
+			}
+		}
+		size_t open = 0;
+		for (auto it = edges.begin(); it != edges.end(); it = edges.upper_bound(*it))
+			open += edges.count(*it) == 1 ? 1 : 0;
+		return open;
+	}
+
+	//**************************************************
+	/// \brief Triangles whose texture coordinates wrap around, a seam vertex moved onto the other side
+	//**************************************************
+	size_t WrappedTriangleNum(const MeshData& mesh, const std::vector<uint32_t>& indices)
+	{
+		size_t wrapped = 0;
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			const float u0 = mesh.Vertices[indices[i]].TexCoord.x, u1 = mesh.Vertices[indices[i + 1]].TexCoord.x, u2 = mesh.Vertices[indices[i + 2]].TexCoord.x;
+			wrapped += (std::max)((std::max)(u0, u1), u2) - (std::min)((std::min)(u0, u1), u2) > 0.5f ? 1 : 0;
+		}
+		return wrapped;
+	}
+
+	//**************************************************
+	/// \brief A uv sphere reaches a small target, the seam and the poles follow along
+	//**************************************************
+	void TestSphereSeam()
+	{
+		const MeshData sphere = BuildSphere(300, 300);
+		MeshSimplifier::Options options;
+		options.TargetTriangleNum = sphere.Indices.size() / 3 / 100;
+
+		std::vector<uint32_t> simplified;
+		const float error = MeshSimplifier::Simplify(sphere.Vertices.data(), sphere.Vertices.size(), sphere.Indices.data(), sphere.Indices.size(), options, &simplified);
+
+		const int failureNum = test::FailureNum();
+		TEST_CHECK(simplified.size() / 3 <= options.TargetTriangleNum * 11 / 10);
+		TEST_CHECK(OpenEdgeNum(sphere, simplified) == 0);
+		TEST_CHECK(WrappedTriangleNum(sphere, simplified) == 0);
+		TEST_CHECK(SphereDeviation(sphere, simplified) < 0.05f);
+		if (test::FailureNum() != failureNum)
+			std::printf("sphere: %zu -> %zu triangles, error %f, deviation %f\n", sphere.Indices.size() / 3, simplified.size() / 3, error, SphereDeviation(sphere, simplified));
+	}
+
+	//**************************************************
+	/// \brief Out of reach triangle targets stop at TargetError, the returned error stays within it
+	//**************************************************
+	void TestErrorStop()
+	{
+		const MeshData sphere = BuildSphere(64, 32);
+		const size_t sourceNum = sphere.Indices.size() / 3;
+
+		size_t previousNum = sourceNum;
+		for (const float targetError : { 0.002f, 0.01f, 0.05f })
+		{
+			MeshSimplifier::Options options;
+			options.TargetTriangleNum	= 1;
+			options.TargetError			= targetError;
+
+			std::vector<uint32_t> simplified;
+			const float error = MeshSimplifier::Simplify(sphere.Vertices.data(), sphere.Vertices.size(), sphere.Indices.data(), sphere.Indices.size(), options, &simplified);
+			const size_t triangleNum = simplified.size() / 3;
+			TEST_CHECK(error <= targetError);
+			TEST_CHECK(triangleNum > options.TargetTriangleNum && triangleNum < sourceNum);
+			TEST_CHECK(triangleNum <= previousNum);
+			TEST_CHECK(OpenEdgeNum(sphere, simplified) == 0);
+			previousNum = triangleNum;
+		}
+	}
+}
+
+/* main */
+int main()
+{
+	TestSphereSeam();
+	TestErrorStop();
+	return test::Finish("MeshSimplifier");
+}
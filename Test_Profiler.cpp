@@ -0,0 +1,78 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Test_Profiler.cpp
+*		Detail	: Unit tests of Profiler
+===================================================================================*/
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <thread>
+
+#include "Profiler.h"
+#include "Test_Check.h"
+
+namespace
+{
+	//**************************************************
+	/// \brief Calls per frame of one marker in the rolling summary
+	//**************************************************
+	double CallsOf(const char* name)
+	{
+		Profiler::Summary summaries[16];
+		const size_t count = (std::min)(Profiler::GetSummary(summaries, 16), size_t(16));
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (std::strcmp(summaries[i].Name, name) == 0)
+				return summaries[i].CallsPerFrame;
+		}
+		return 0.0;
+	}
+
+	//**************************************************
+	/// \brief Events of every thread reach the summary
+	//**************************************************
+	void TestRecord()
+	{
+		Profiler::Record("Test::Main", 0, 1000000);
+		std::thread([] { Profiler::Record("Test::Worker", 0, 2000000); }).join();
+		Profiler::NextFrame();
+
+		TEST_CHECK(CallsOf("Test::Main") == 1.0);
+		TEST_CHECK(CallsOf("Test::Worker") == 1.0);
+		Profiler::Shutdown();
+	}
+
+	//**************************************************
+	/// \brief A thread that recorded before Shutdown records into a new buffer after it
+	//**************************************************
+	void TestShutdownOtherThread()
+	{
+		std::promise<void> recorded, shutdown;
+		std::thread worker([&]
+		{
+			Profiler::Record("Test::Before", 0, 1000);
+			recorded.set_value();
+			shutdown.get_future().wait();
+			Profiler::Record("Test::After", 0, 1000);	// buffer of the first record was released
+		});
+
+		recorded.get_future().wait();
+		Profiler::Shutdown();
+		shutdown.set_value();
+		worker.join();
+
+		Profiler::NextFrame();
+		TEST_CHECK(CallsOf("Test::Before") == 0.0);
+		TEST_CHECK(CallsOf("Test::After") == 1.0);
+		Profiler::Shutdown();
+	}
+}
+
+/* main */
+int main()
+{
+	TestRecord();
+	TestShutdownOtherThread();
+	return test::Finish("Profiler");
+}
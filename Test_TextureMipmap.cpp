@@ -0,0 +1,190 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Test_TextureMipmap.cpp
+*		Detail	: Unit tests of TextureMipmap
+===================================================================================*/
+#include <cstdlib>
+#include <vector>
+
+#include "Texture_Mipmap.h"
+#include "Test_Check.h"
+
+namespace
+{
+	using Level = TextureMipmap::Level;
+
+	//**************************************************
+	/// \brief Box filter on plain values, exact averages are checked
+	//**************************************************
+	TextureMipmap::Options LinearBox()
+	{
+		TextureMipmap::Options options;
+		options.Filter				= TextureMipmap::FILTER::BOX;
+		options.Srgb				= false;
+		options.PremultiplyAlpha	= false;
+		return options;
+	}
+
+	//**************************************************
+	/// \brief Image of one color
+	//**************************************************
+	std::vector<uint8_t> Fill(const uint32_t width, const uint32_t height, const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a)
+	{
+		std::vector<uint8_t> pixels;
+		for (uint32_t i = 0; i < width * height; ++i)
+			pixels.insert(pixels.end(), { r, g, b, a });
+		return pixels;
+	}
+
+	const uint8_t* Pixel(const Level& level, const uint32_t x, const uint32_t y)
+	{
+		return level.Pixels.data() + (size_t(y) * level.Width + x) * 4;
+	}
+
+	//**************************************************
+	/// \brief Sizes are halved and rounded down, the row pitch is dropped
+	//**************************************************
+	void TestLevelSizes()
+	{
+		TEST_CHECK(TextureMipmap::FullLevelNum(5, 3) == 3);
+		TEST_CHECK(TextureMipmap::FullLevelNum(1, 1) == 1);
+		TEST_CHECK(TextureMipmap::FullLevelNum(256, 17) == 9);
+
+		// 5x3 with 8 bytes of padding per row
+		const uint32_t rowPitch = 5 * 4 + 8;
+		std::vector<uint8_t> source(rowPitch * 3, 0xcd);
+		for (uint32_t y = 0; y < 3; ++y)
+		{
+			for (uint32_t x = 0; x < 5 * 4; ++x)
+				source[y * rowPitch + x] = uint8_t(y * 20 + x);
+		}
+
+		std::vector<Level> levels;
+		TEST_CHECK(TextureMipmap::Generate(source.data(), 5, 3, rowPitch, LinearBox(), &levels));
+		TEST_CHECK(levels.size() == 3);
+		if (levels.size() != 3)
+			return;
+		TEST_CHECK(levels[0].Width == 5 && levels[0].Height == 3 && levels[0].Pixels.size() == 5 * 3 * 4);
+		TEST_CHECK(levels[1].Width == 2 && levels[1].Height == 1 && levels[1].Pixels.size() == 2 * 1 * 4);
+		TEST_CHECK(levels[2].Width == 1 && levels[2].Height == 1 && levels[2].Pixels.size() == 4);
+		TEST_CHECK(*Pixel(levels[0], 4, 2) == 2 * 20 + 16 && levels[0].Pixels[5 * 4] == 20);
+
+		// LevelNum cuts the chain, bad input is refused
+		TextureMipmap::Options options = LinearBox();
+		options.LevelNum = 2;
+		TEST_CHECK(TextureMipmap::Generate(source.data(), 5, 3, rowPitch, options, &levels) && levels.size() == 2);
+		TEST_CHECK(!TextureMipmap::Generate(nullptr, 5, 3, rowPitch, options, &levels));
+		TEST_CHECK(!TextureMipmap::Generate(source.data(), 0, 3, rowPitch, options, &levels));
+	}
+
+	//**************************************************
+	/// \brief Box averages the covered source area, partial pixels by their coverage
+	//**************************************************
+	void TestBoxAverage()
+	{
+		// 2x2 blocks of 10, 20, 30, 40 average to 25
+		std::vector<uint8_t> source(4 * 4 * 4);
+		for (uint32_t y = 0; y < 4; ++y)
+		{
+			for (uint32_t x = 0; x < 4; ++x)
+			{
+				const uint8_t value = uint8_t(10 * ((y % 2) * 2 + (x % 2) + 1) + 100 * (x / 2));
+				uint8_t* pixel = &source[(y * 4 + x) * 4];
+				pixel[0] = pixel[1] = pixel[2] = value;
+				pixel[3] = 255;
+			}
+		}
+		std::vector<Level> levels;
+		TextureMipmap::Generate(source.data(), 4, 4, 4 * 4, LinearBox(), &levels);
+		TEST_CHECK(levels.size() == 3);
+		TEST_CHECK(*Pixel(levels[1], 0, 0) == 25 && *Pixel(levels[1], 1, 0) == 125);
+		TEST_CHECK(*Pixel(levels[1], 0, 1) == 25 && *Pixel(levels[1], 1, 1) == 125);
+		TEST_CHECK(*Pixel(levels[2], 0, 0) == 75 && Pixel(levels[2], 0, 0)[3] == 255);
+
+		// 5 to 2 columns, each covers 2.5 pixels: (100 + 100 + 0.5 * 200) / 2.5, (0.5 * 200 + 50 + 50) / 2.5
+		const uint8_t columns[5] = { 100, 100, 200, 50, 50 };
+		std::vector<uint8_t> odd(5 * 3 * 4);
+		for (uint32_t i = 0; i < 5 * 3; ++i)
+		{
+			odd[i * 4] = odd[i * 4 + 1] = odd[i * 4 + 2] = columns[i % 5];
+			odd[i * 4 + 3] = 255;
+		}
+		TextureMipmap::Generate(odd.data(), 5, 3, 5 * 4, LinearBox(), &levels);
+		TEST_CHECK(*Pixel(levels[1], 0, 0) == 120 && *Pixel(levels[1], 1, 0) == 80);
+		TEST_CHECK(*Pixel(levels[2], 0, 0) == 100);
+	}
+
+	//**************************************************
+	/// \brief Black and white average to half the light, not half the code value
+	//**************************************************
+	void TestSrgb()
+	{
+		const uint8_t source[8] = { 0, 0, 0, 255, 255, 255, 255, 255 };
+		TextureMipmap::Options options = LinearBox();
+
+		std::vector<Level> levels;
+		TextureMipmap::Generate(source, 2, 1, 8, options, &levels);
+		TEST_CHECK(levels.size() == 2 && *Pixel(levels[1], 0, 0) == 128);
+
+		// Linear 0.5 encodes to sRGB 0.7354, 187.5 of 255
+		options.Srgb = true;
+		TextureMipmap::Generate(source, 2, 1, 8, options, &levels);
+		TEST_CHECK(levels.size() == 2 && std::abs(int(*Pixel(levels[1], 0, 0)) - 188) <= 1);
+		TEST_CHECK(Pixel(levels[1], 0, 0)[3] == 255);	// alpha is always linear
+
+		// A flat sRGB color stays flat through every filter
+		for (const TextureMipmap::FILTER filter : { TextureMipmap::FILTER::BOX, TextureMipmap::FILTER::KAISER, TextureMipmap::FILTER::LANCZOS })
+		{
+			options.Filter = filter;
+			const std::vector<uint8_t> flat = Fill(7, 5, 200, 100, 50, 255);
+			TextureMipmap::Generate(flat.data(), 7, 5, 7 * 4, options, &levels);
+			bool same = levels.size() == 3;
+			for (const Level& level : levels)
+			{
+				for (size_t i = 0; i < level.Pixels.size(); i += 4)
+				{
+					same = same && std::abs(int(level.Pixels[i]) - 200) <= 1 && std::abs(int(level.Pixels[i + 1]) - 100) <= 1 &&
+						std::abs(int(level.Pixels[i + 2]) - 50) <= 1 && level.Pixels[i + 3] == 255;
+				}
+			}
+			TEST_CHECK(same);
+		}
+	}
+
+	//**************************************************
+	/// \brief Transparent pixels do not bleed their color when alpha is premultiplied
+	//**************************************************
+	void TestAlpha()
+	{
+		// Opaque red next to transparent green
+		const uint8_t source[8] = { 255, 0, 0, 255, 0, 255, 0, 0 };
+		TextureMipmap::Options options = LinearBox();
+
+		std::vector<Level> levels;
+		TextureMipmap::Generate(source, 2, 1, 8, options, &levels);
+		const uint8_t* straight = Pixel(levels[1], 0, 0);
+		TEST_CHECK(straight[0] == 128 && straight[1] == 128 && straight[2] == 0 && straight[3] == 128);
+
+		options.PremultiplyAlpha = true;
+		TextureMipmap::Generate(source, 2, 1, 8, options, &levels);
+		const uint8_t* premultiplied = Pixel(levels[1], 0, 0);
+		TEST_CHECK(premultiplied[0] == 255 && premultiplied[1] == 0 && premultiplied[2] == 0 && premultiplied[3] == 128);
+
+		// Nothing visible stays black
+		const std::vector<uint8_t> clear = Fill(4, 4, 90, 90, 90, 0);
+		TextureMipmap::Generate(clear.data(), 4, 4, 4 * 4, options, &levels);
+		const uint8_t* last = Pixel(levels.back(), 0, 0);
+		TEST_CHECK(last[0] == 0 && last[1] == 0 && last[2] == 0 && last[3] == 0);
+	}
+}
+
+/* main */
+int main()
+{
+	TestLevelSizes();
+	TestBoxAverage();
+	TestSrgb();
+	TestAlpha();
+	return test::Finish("TextureMipmap");
+}
@@ -0,0 +1,242 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Test_TextureResidency.cpp
+*		Detail	: Unit tests of TextureResidency
+===================================================================================*/
+#include <vector>
+
+#include "Texture_Residency.h"
+#include "Test_Check.h"
+
+namespace
+{
+	using Request = TextureResidency::Request;
+
+	// 128x128 rgba8, each level a quarter of the one above
+	const uint64_t	k_levelBytes[8]	= { 65536, 16384, 4096, 1024, 256, 64, 16, 4 };
+	const uint32_t	k_mipNum		= 8;
+	const uint32_t	k_tailMip		= 4;
+	const uint64_t	k_tailBytes		= 256 + 64 + 16 + 4;
+
+	//**************************************************
+	/// \brief Finish every load of the plan
+	//**************************************************
+	void Complete(TextureResidency* residency, const std::vector<Request>& loads, const bool success)
+	{
+		for (const Request& load : loads)
+			residency->OnLoaded(load, success);
+	}
+
+	//**************************************************
+	/// \brief Demand, plan and complete until nothing is loaded, the demand holds every frame
+	//**************************************************
+	void Settle(TextureResidency* residency, const std::vector<float>& desiredMips, const std::vector<float>& priorities)
+	{
+		for (uint32_t frame = 0; frame < 64; ++frame)
+		{
+			residency->BeginFrame();
+			for (uint32_t i = 0; i < desiredMips.size(); ++i)
+				residency->SetDemand(i, desiredMips[i], priorities[i]);
+
+			std::vector<Request> loads, evictions;
+			residency->Plan(4, &loads, &evictions);
+			if (loads.empty())
+				return;
+			Complete(residency, loads, true);
+		}
+	}
+
+	//**************************************************
+	/// \brief Loads go to the highest priority times missing levels first
+	//**************************************************
+	void TestScoreOrder()
+	{
+		TextureResidency residency;
+		const uint32_t low	= residency.Add(k_levelBytes, k_mipNum, k_tailMip);
+		const uint32_t high	= residency.Add(k_levelBytes, k_mipNum, k_tailMip);
+		TEST_CHECK(residency.ResidentMip(low) == k_tailMip && residency.ResidentBytes() == 2 * k_tailBytes);
+
+		residency.BeginFrame();
+		residency.SetDemand(low, 0.0f, 10.0f);
+		residency.SetDemand(high, 0.0f, 100.0f);
+		std::vector<Request> loads, evictions;
+		residency.Plan(1, &loads, &evictions);
+		TEST_CHECK(loads.size() == 1 && loads[0].Texture == high && loads[0].Mip == k_tailMip - 1);
+		TEST_CHECK(residency.IsLoading(high) && residency.PendingBytes() == k_levelBytes[k_tailMip - 1]);
+
+		// One load in flight per texture, the other one comes next
+		loads.clear();
+		residency.Plan(2, &loads, &evictions);
+		TEST_CHECK(loads.size() == 1 && loads[0].Texture == low);
+
+		// Same priority, the texture further from its demand wins
+		TextureResidency deficit;
+		const uint32_t near	= deficit.Add(k_levelBytes, k_mipNum, k_tailMip);
+		const uint32_t far	= deficit.Add(k_levelBytes, k_mipNum, k_tailMip);
+		deficit.BeginFrame();
+		deficit.SetDemand(near, 3.0f, 10.0f);
+		deficit.SetDemand(far, 0.0f, 10.0f);
+		loads.clear();
+		deficit.Plan(1, &loads, &evictions);
+		TEST_CHECK(loads.size() == 1 && loads[0].Texture == far);
+
+		// Without priority nothing is requested
+		TextureResidency idle;
+		idle.Add(k_levelBytes, k_mipNum, k_tailMip);
+		idle.BeginFrame();
+		idle.SetDemand(0, 0.0f, 0.0f);
+		loads.clear();
+		idle.Plan(4, &loads, &evictions);
+		TEST_CHECK(loads.empty());
+
+		TEST_CHECK(TextureResidency::DesiredMip(1024, 1024, 256.0f, 256.0f) == 2.0f);
+		TEST_CHECK(TextureResidency::DesiredMip(256, 256, 512.0f, 512.0f) == 0.0f);
+	}
+
+	//**************************************************
+	/// \brief A load evicts a resident level only when it is worth k_evictionBias times more
+	//**************************************************
+	void TestEvictionBias()
+	{
+		// 11 outscores the resident level but stays within the bias, 13 clears it
+		for (const float priority : { 11.0f, 13.0f })
+		{
+			// Room for the tails and one more level
+			TextureResidency residency;
+			const uint32_t resident	= residency.Add(k_levelBytes, k_mipNum, k_tailMip);
+			const uint32_t wanted	= residency.Add(k_levelBytes, k_mipNum, k_tailMip);
+			residency.SetBudget(2 * k_tailBytes + k_levelBytes[k_tailMip - 1]);
+
+			// Level 3 of the resident texture is worth 10 * (3 + 1 - 3)
+			Settle(&residency, { 3.0f, float(k_tailMip) }, { 10.0f, 0.0f });
+			TEST_CHECK(residency.ResidentMip(resident) == k_tailMip - 1);
+
+			// The same level of the other texture is worth the priority
+			residency.BeginFrame();
+			residency.SetDemand(resident, 3.0f, 10.0f);
+			residency.SetDemand(wanted, 3.0f, priority);
+			std::vector<Request> loads, evictions;
+			residency.Plan(4, &loads, &evictions);
+
+			const bool replaces = priority == 13.0f;
+			TEST_CHECK(replaces == !evictions.empty());
+			TEST_CHECK(replaces == !loads.empty());
+			if (replaces)
+			{
+				TEST_CHECK(evictions.size() == 1 && evictions[0].Texture == resident && evictions[0].Mip == k_tailMip - 1);
+				TEST_CHECK(loads.size() == 1 && loads[0].Texture == wanted);
+			}
+			TEST_CHECK(residency.ResidentBytes() + residency.PendingBytes() <= residency.Budget());
+		}
+	}
+
+	//**************************************************
+	/// \brief Resident and pending bytes never pass the budget, a lower budget evicts
+	//**************************************************
+	void TestBudget()
+	{
+		const uint32_t textureNum = 12;
+		TextureResidency residency;
+		for (uint32_t i = 0; i < textureNum; ++i)
+			residency.Add(k_levelBytes, k_mipNum, k_tailMip);
+		residency.SetBudget(textureNum * k_tailBytes + 40000);
+
+		bool within = true;
+		for (uint32_t frame = 0; frame < 40; ++frame)
+		{
+			residency.BeginFrame();
+			for (uint32_t i = 0; i < textureNum; ++i)
+				residency.SetDemand(i, float((i + frame) % 5), float((i * 7 + frame * 3) % 11));
+
+			// Loads land one frame later
+			std::vector<Request> loads, evictions;
+			residency.Plan(3, &loads, &evictions);
+			within = within && residency.ResidentBytes() + residency.PendingBytes() <= residency.Budget();
+			Complete(&residency, loads, true);
+			within = within && residency.ResidentBytes() <= residency.Budget();
+		}
+		TEST_CHECK(within);
+		TEST_CHECK(residency.ResidentBytes() > textureNum * k_tailBytes);
+
+		// Halved budget, met by the next plan alone
+		residency.SetBudget(textureNum * k_tailBytes + 20000);
+		std::vector<Request> loads, evictions;
+		residency.Plan(0, &loads, &evictions);
+		TEST_CHECK(!evictions.empty() && loads.empty());
+		TEST_CHECK(residency.ResidentBytes() <= residency.Budget());
+	}
+
+	//**************************************************
+	/// \brief A failed level is not requested again, coarser levels stay
+	//**************************************************
+	void TestFailedLoad()
+	{
+		TextureResidency residency;
+		const uint32_t texture = residency.Add(k_levelBytes, k_mipNum, k_tailMip);
+
+		residency.BeginFrame();
+		residency.SetDemand(texture, 0.0f, 10.0f);
+		std::vector<Request> loads, evictions;
+		residency.Plan(1, &loads, &evictions);
+		TEST_CHECK(loads.size() == 1 && loads[0].Mip == 3);
+		Complete(&residency, loads, true);
+		TEST_CHECK(residency.ResidentMip(texture) == 3);
+
+		loads.clear();
+		residency.Plan(1, &loads, &evictions);
+		TEST_CHECK(loads.size() == 1 && loads[0].Mip == 2);
+		Complete(&residency, loads, false);
+		TEST_CHECK(residency.ResidentMip(texture) == 3 && !residency.IsLoading(texture) && residency.PendingBytes() == 0);
+
+		// Demand of level 0 stops at the finest level that loaded
+		for (uint32_t frame = 0; frame < 4; ++frame)
+		{
+			residency.BeginFrame();
+			residency.SetDemand(texture, 0.0f, 10.0f);
+			loads.clear();
+			residency.Plan(4, &loads, &evictions);
+			TEST_CHECK(loads.empty());
+		}
+		TEST_CHECK(residency.ResidentMip(texture) == 3);
+	}
+
+	//**************************************************
+	/// \brief Levels from the tail on are never evicted, even over budget
+	//**************************************************
+	void TestTailResident()
+	{
+		TextureResidency residency;
+		const uint32_t a = residency.Add(k_levelBytes, k_mipNum, k_tailMip);
+		const uint32_t b = residency.Add(k_levelBytes, k_mipNum, k_tailMip);
+		Settle(&residency, { 0.0f, 1.0f }, { 5.0f, 5.0f });
+		TEST_CHECK(residency.ResidentMip(a) == 0 && residency.ResidentMip(b) == 1);
+
+		residency.SetBudget(0);
+		std::vector<Request> loads, evictions;
+		residency.Plan(4, &loads, &evictions);
+		TEST_CHECK(loads.empty() && evictions.size() == k_tailMip + k_tailMip - 1);
+
+		bool tailKept = true;
+		for (const Request& eviction : evictions)
+			tailKept = tailKept && eviction.Mip < k_tailMip;
+		TEST_CHECK(tailKept);
+		TEST_CHECK(residency.ResidentMip(a) == k_tailMip && residency.ResidentMip(b) == k_tailMip);
+		TEST_CHECK(residency.ResidentBytes() == 2 * k_tailBytes);
+
+		// A tail past the last level is clamped to it
+		const uint32_t clamped = residency.Add(k_levelBytes, 3, 10);
+		TEST_CHECK(residency.ResidentMip(clamped) == 2);
+	}
+}
+
+/* main */
+int main()
+{
+	TestScoreOrder();
+	TestEvictionBias();
+	TestBudget();
+	TestFailedLoad();
+	TestTailResident();
+	return test::Finish("TextureResidency");
+}
@@ -0,0 +1,796 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Texture_Compressor.cpp
+*		Detail	: Cpu block compression to BC1, BC3, BC4, BC5 and BC7
+===================================================================================*/
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define TEXTURE_COMPRESSOR_SSE
+#endif
+
+#include "Texture_Compressor.h"
+#include "Thread_Pool.h"
+
+namespace
+{
+	//**************************************************
+	/// \brief Block layouts written by Compress
+	//**************************************************
+	enum class KIND
+	{
+		BC1,
+		BC3,
+		BC4,
+		BC5,
+		BC7,
+		NUM
+	};
+
+	//**************************************************
+	/// \brief Search effort of a quality level
+	//**************************************************
+	struct Settings
+	{
+		uint32_t	AxisIterations;		// power iterations, 0 is the bounding box diagonal
+		uint32_t	Refits;				// least squares endpoint refits
+		int			EndpointSearch;		// BC4 endpoint offsets tried on each side
+	};
+
+	//**************************************************
+	/// \brief 4x4 pixels as channel planes for the SIMD kernels
+	//**************************************************
+	struct Block
+	{
+		alignas(16) float	Channel[4][16];
+	};
+
+	// Weight of the second endpoint per index
+	const float k_bc1Weights[4]{ 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+	const uint32_t k_bc7Weights[16]{ 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	bool GetKind(const TextureFile::FORMAT format, KIND* kind)
+	{
+		switch (format)
+		{
+		case TextureFile::FORMAT::BC1_UNORM:
+		case TextureFile::FORMAT::BC1_UNORM_SRGB:	*kind = KIND::BC1;	return true;
+		case TextureFile::FORMAT::BC3_UNORM:
+		case TextureFile::FORMAT::BC3_UNORM_SRGB:	*kind = KIND::BC3;	return true;
+		case TextureFile::FORMAT::BC4_UNORM:		*kind = KIND::BC4;	return true;
+		case TextureFile::FORMAT::BC5_UNORM:		*kind = KIND::BC5;	return true;
+		case TextureFile::FORMAT::BC7_UNORM:
+		case TextureFile::FORMAT::BC7_UNORM_SRGB:	*kind = KIND::BC7;	return true;
+		default:									return false;
+		}
+	}
+
+	Settings GetSettings(const TextureCompressor::QUALITY quality)
+	{
+		switch (quality)
+		{
+		case TextureCompressor::QUALITY::FAST:	return { 0, 0, 0 };
+		case TextureCompressor::QUALITY::HIGH:	return { 8, 3, 4 };
+		default:								return { 4, 1, 2 };
+		}
+	}
+
+	//**************************************************
+	/// \brief Nearest palette entry of every pixel
+	///
+	/// \param[in]  channels	 ->	channelNum planes of 16 values, 16 byte aligned
+	/// \param[in]  palette		 ->	paletteNum colors
+	/// \param[out] indices		 ->	16 palette indices
+	///
+	/// \return sum of squared errors
+	//**************************************************
+	float SelectIndices(
+		const float* const* channels,
+		const uint32_t channelNum,
+		const float (*palette)[4],
+		const uint32_t paletteNum,
+		uint8_t* indices
+	)
+	{
+#if defined(TEXTURE_COMPRESSOR_SSE)
+		// Four pixels per register, one palette entry at a time
+		__m128 total = _mm_setzero_ps();
+		for (uint32_t i = 0; i < 16; i += 4)
+		{
+			__m128 best			= _mm_set1_ps(FLT_MAX);
+			__m128 bestIndex	= _mm_setzero_ps();
+			for (uint32_t p = 0; p < paletteNum; ++p)
+			{
+				__m128 distance = _mm_setzero_ps();
+				for (uint32_t c = 0; c < channelNum; ++c)
+				{
+					__m128 difference = _mm_sub_ps(_mm_load_ps(channels[c] + i), _mm_set1_ps(palette[p][c]));
+					distance = _mm_add_ps(distance, _mm_mul_ps(difference, difference));
+				}
+				__m128 closer	= _mm_cmplt_ps(distance, best);
+				best			= _mm_min_ps(distance, best);
+				bestIndex		= _mm_or_ps(_mm_and_ps(closer, _mm_set1_ps(float(p))), _mm_andnot_ps(closer, bestIndex));
+			}
+			total = _mm_add_ps(total, best);
+
+			alignas(16) int32_t lanes[4];
+			_mm_store_si128((__m128i*)lanes, _mm_cvttps_epi32(bestIndex));
+			for (uint32_t k = 0; k < 4; ++k)
+				indices[i + k] = uint8_t(lanes[k]);
+		}
+
+		alignas(16) float sums[4];
+		_mm_store_ps(sums, total);
+		return sums[0] + sums[1] + sums[2] + sums[3];
+#else
+		float total = 0.0f;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			float best = FLT_MAX;
+			for (uint32_t p = 0; p < paletteNum; ++p)
+			{
+				float distance = 0.0f;
+				for (uint32_t c = 0; c < channelNum; ++c)
+				{
+					float difference = channels[c][i] - palette[p][c];
+					distance += difference * difference;
+				}
+				if (distance < best)
+				{
+					best		= distance;
+					indices[i]	= uint8_t(p);
+				}
+			}
+			total += best;
+		}
+		return total;
+#endif
+	}
+
+	//**************************************************
+	/// \brief Direction of largest variance (power iteration)
+	///        Starts from the bounding box diagonal, signed by covariance
+	//**************************************************
+	void PrincipalAxis(const Block& block, const uint32_t channelNum, const uint32_t iterations, float* mean, float* axis)
+	{
+		float minimum[4]{}, maximum[4]{};
+		for (uint32_t c = 0; c < channelNum; ++c)
+		{
+			mean[c]		= 0.0f;
+			minimum[c]	= 255.0f;
+			maximum[c]	= 0.0f;
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				mean[c]		+= block.Channel[c][i];
+				minimum[c]	= (std::min)(minimum[c], block.Channel[c][i]);
+				maximum[c]	= (std::max)(maximum[c], block.Channel[c][i]);
+			}
+			mean[c] *= 1.0f / 16.0f;
+		}
+
+		float covariance[4][4]{};
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			for (uint32_t a = 0; a < channelNum; ++a)
+			{
+				for (uint32_t b = a; b < channelNum; ++b)
+					covariance[a][b] += (block.Channel[a][i] - mean[a]) * (block.Channel[b][i] - mean[b]);
+			}
+		}
+		for (uint32_t a = 0; a < channelNum; ++a)
+		{
+			for (uint32_t b = 0; b < a; ++b)
+				covariance[a][b] = covariance[b][a];
+		}
+
+		uint32_t widest = 0;
+		for (uint32_t c = 0; c < channelNum; ++c)
+		{
+			axis[c] = maximum[c] - minimum[c];
+			if (axis[c] > axis[widest])
+				widest = c;
+		}
+		for (uint32_t c = 0; c < channelNum; ++c)
+		{
+			if (covariance[widest][c] < 0.0f)
+				axis[c] = -axis[c];
+		}
+
+		for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+		{
+			float next[4]{};
+			for (uint32_t a = 0; a < channelNum; ++a)
+			{
+				for (uint32_t b = 0; b < channelNum; ++b)
+					next[a] += covariance[a][b] * axis[b];
+			}
+
+			float length = 0.0f;
+			for (uint32_t c = 0; c < channelNum; ++c)
+				length = (std::max)(length, std::fabs(next[c]));
+			if (length < FLT_EPSILON)
+				break;
+			for (uint32_t c = 0; c < channelNum; ++c)
+				axis[c] = next[c] / length;
+		}
+
+		float length = 0.0f;
+		for (uint32_t c = 0; c < channelNum; ++c)
+			length += axis[c] * axis[c];
+		length = std::sqrt(length);
+		for (uint32_t c = 0; c < channelNum; ++c)
+			axis[c] = length > FLT_EPSILON ? axis[c] / length : 0.0f;
+	}
+
+	//**************************************************
+	/// \brief Extremes of the pixels projected on the axis
+	//**************************************************
+	void AxisEndpoints(const Block& block, const uint32_t channelNum, const float* mean, const float* axis, float (*endpoint)[4])
+	{
+		float low = 0.0f, high = 0.0f;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			float t = 0.0f;
+			for (uint32_t c = 0; c < channelNum; ++c)
+				t += (block.Channel[c][i] - mean[c]) * axis[c];
+			low		= (std::min)(low, t);
+			high	= (std::max)(high, t);
+		}
+
+		for (uint32_t c = 0; c < channelNum; ++c)
+		{
+			endpoint[0][c] = (std::min)((std::max)(mean[c] + low * axis[c], 0.0f), 255.0f);
+			endpoint[1][c] = (std::min)((std::max)(mean[c] + high * axis[c], 0.0f), 255.0f);
+		}
+	}
+
+	//**************************************************
+	/// \brief Endpoints that minimize the error for fixed indices
+	///
+	/// \return false when the indices do not span two endpoints
+	//**************************************************
+	bool LeastSquares(const Block& block, const uint32_t channelNum, const uint8_t* indices, const float* weights, float (*endpoint)[4])
+	{
+		float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+		float ax[4]{}, bx[4]{};
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			const float b = weights[indices[i]];
+			const float a = 1.0f - b;
+			aa += a * a;
+			ab += a * b;
+			bb += b * b;
+			for (uint32_t c = 0; c < channelNum; ++c)
+			{
+				ax[c] += a * block.Channel[c][i];
+				bx[c] += b * block.Channel[c][i];
+			}
+		}
+
+		const float determinant = aa * bb - ab * ab;
+		if (std::fabs(determinant) < 1e-6f)
+			return false;
+
+		for (uint32_t c = 0; c < channelNum; ++c)
+		{
+			endpoint[0][c] = (std::min)((std::max)((bb * ax[c] - ab * bx[c]) / determinant, 0.0f), 255.0f);
+			endpoint[1][c] = (std::min)((std::max)((aa * bx[c] - ab * ax[c]) / determinant, 0.0f), 255.0f);
+		}
+		return true;
+	}
+
+	uint16_t Pack565(const float* color)
+	{
+		const uint32_t r = uint32_t(color[0] * (31.0f / 255.0f) + 0.5f);
+		const uint32_t g = uint32_t(color[1] * (63.0f / 255.0f) + 0.5f);
+		const uint32_t b = uint32_t(color[2] * (31.0f / 255.0f) + 0.5f);
+		return uint16_t((r << 11) | (g << 5) | b);
+	}
+
+	void Unpack565(const uint16_t color, uint32_t* rgb)
+	{
+		const uint32_t r = (color >> 11) & 31;
+		const uint32_t g = (color >> 5) & 63;
+		const uint32_t b = color & 31;
+		rgb[0] = (r << 3) | (r >> 2);
+		rgb[1] = (g << 2) | (g >> 4);
+		rgb[2] = (b << 3) | (b >> 2);
+	}
+
+	//**************************************************
+	/// \brief Indices of 4 color mode for two 565 endpoints
+	///
+	/// \return sum of squared errors
+	//**************************************************
+	float Bc1Indices(const Block& block, const uint16_t* color, uint8_t* indices)
+	{
+		uint32_t rgb[2][3];
+		Unpack565(color[0], rgb[0]);
+		Unpack565(color[1], rgb[1]);
+
+		// Same integer interpolation as DecodeColor
+		float palette[4][4]{};
+		for (uint32_t c = 0; c < 3; ++c)
+		{
+			palette[0][c] = float(rgb[0][c]);
+			palette[1][c] = float(rgb[1][c]);
+			palette[2][c] = float((2 * rgb[0][c] + rgb[1][c]) / 3);
+			palette[3][c] = float((rgb[0][c] + 2 * rgb[1][c]) / 3);
+		}
+
+		const float* channels[3]{ block.Channel[0], block.Channel[1], block.Channel[2] };
+		return SelectIndices(channels, 3, palette, 4, indices);
+	}
+
+	//**************************************************
+	/// \brief Color block shared by BC1 and BC3, always 4 color mode
+	//**************************************************
+	void EncodeColor(const Block& block, const Settings& settings, uint8_t* output)
+	{
+		float mean[4], axis[4], endpoint[2][4];
+		PrincipalAxis(block, 3, settings.AxisIterations, mean, axis);
+		AxisEndpoints(block, 3, mean, axis, endpoint);
+		if (settings.AxisIterations == 0)
+		{// Pull the bounding box in, extremes are rarely worth an endpoint
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				const float inset = (endpoint[1][c] - endpoint[0][c]) / 16.0f;
+				endpoint[0][c] += inset;
+				endpoint[1][c] -= inset;
+			}
+		}
+
+		uint16_t color[2]{ Pack565(endpoint[0]), Pack565(endpoint[1]) };
+		uint8_t indices[16];
+		float error = Bc1Indices(block, color, indices);
+		for (uint32_t refit = 0; refit < settings.Refits; ++refit)
+		{
+			if (!LeastSquares(block, 3, indices, k_bc1Weights, endpoint))
+				break;
+
+			uint16_t candidate[2]{ Pack565(endpoint[0]), Pack565(endpoint[1]) };
+			uint8_t candidateIndices[16];
+			const float candidateError = Bc1Indices(block, candidate, candidateIndices);
+			if (candidateError >= error)
+				break;
+
+			error = candidateError;
+			std::copy(candidate, candidate + 2, color);
+			std::copy(candidateIndices, candidateIndices + 16, indices);
+		}
+
+		// First endpoint greater selects 4 color mode, the palette is symmetric under the swap
+		uint32_t flip = 0;
+		if (color[0] < color[1])
+		{
+			std::swap(color[0], color[1]);
+			flip = 1;
+		}
+
+		uint32_t bits = 0;
+		for (uint32_t i = 0; i < 16; ++i)
+			bits |= (color[0] == color[1] ? 0u : uint32_t(indices[i] ^ flip)) << (i * 2);
+
+		std::memcpy(output, color, 4);
+		std::memcpy(output + 4, &bits, 4);
+	}
+
+	//**************************************************
+	/// \brief Single channel block of BC3 alpha, BC4 and BC5, 8 value mode
+	//**************************************************
+	void EncodeChannel(const float* values, const Settings& settings, uint8_t* output)
+	{
+		float low = 255.0f, high = 0.0f;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			low		= (std::min)(low, values[i]);
+			high	= (std::max)(high, values[i]);
+		}
+
+		std::memset(output, 0, 8);
+		if (high == low)
+		{
+			output[0] = output[1] = uint8_t(high);
+			return;
+		}
+
+		// Try endpoints pulled in from the extremes, keep the smallest error
+		int bestHigh = int(high), bestLow = int(low);
+		float bestError = FLT_MAX;
+		uint8_t indices[16]{};
+		for (int h = int(high); h >= int(high) - settings.EndpointSearch; --h)
+		{
+			for (int l = int(low); l <= int(low) + settings.EndpointSearch && l < h; ++l)
+			{
+				// Same integer interpolation as DecodeChannel
+				float palette[8][4]{ { float(h) }, { float(l) } };
+				for (uint32_t p = 2; p < 8; ++p)
+					palette[p][0] = float(((8 - p) * h + (p - 1) * l) / 7);
+
+				uint8_t candidate[16];
+				const float error = SelectIndices(&values, 1, palette, 8, candidate);
+				if (error < bestError)
+				{
+					bestError	= error;
+					bestHigh	= h;
+					bestLow		= l;
+					std::copy(candidate, candidate + 16, indices);
+				}
+			}
+		}
+
+		output[0] = uint8_t(bestHigh);
+		output[1] = uint8_t(bestLow);
+		uint64_t bits = 0;
+		for (uint32_t i = 0; i < 16; ++i)
+			bits |= uint64_t(indices[i]) << (i * 3);
+		for (uint32_t i = 0; i < 6; ++i)
+			output[2 + i] = uint8_t(bits >> (i * 8));
+	}
+
+	//**************************************************
+	/// \brief BC7 endpoint, 7 bits per channel and a shared low bit
+	//**************************************************
+	void QuantizeBc7(const float* endpoint, uint8_t* quantized, uint8_t* pbit)
+	{
+		float bestError = FLT_MAX;
+		for (uint8_t p = 0; p < 2; ++p)
+		{
+			uint8_t candidate[4];
+			float error = 0.0f;
+			for (uint32_t c = 0; c < 4; ++c)
+			{
+				const int value = (std::min)((std::max)(int((endpoint[c] - p) * 0.5f + 0.5f), 0), 127);
+				const float difference = float((value << 1) | p) - endpoint[c];
+				candidate[c] = uint8_t(value);
+				error += difference * difference;
+			}
+			if (error < bestError)
+			{
+				bestError	= error;
+				*pbit		= p;
+				std::copy(candidate, candidate + 4, quantized);
+			}
+		}
+	}
+
+	//**************************************************
+	/// \brief Indices of mode 6 for two quantized endpoints
+	///
+	/// \return sum of squared errors
+	//**************************************************
+	float Bc7Indices(const Block& block, const uint8_t (*quantized)[4], const uint8_t* pbit, uint8_t* indices)
+	{
+		float palette[16][4];
+		for (uint32_t c = 0; c < 4; ++c)
+		{
+			const uint32_t e0 = (uint32_t(quantized[0][c]) << 1) | pbit[0];
+			const uint32_t e1 = (uint32_t(quantized[1][c]) << 1) | pbit[1];
+			for (uint32_t p = 0; p < 16; ++p)
+				palette[p][c] = float(((64 - k_bc7Weights[p]) * e0 + k_bc7Weights[p] * e1 + 32) >> 6);
+		}
+
+		const float* channels[4]{ block.Channel[0], block.Channel[1], block.Channel[2], block.Channel[3] };
+		return SelectIndices(channels, 4, palette, 16, indices);
+	}
+
+	//**************************************************
+	/// \brief Append bits, least significant bit first
+	//**************************************************
+	struct BitWriter
+	{
+		uint8_t*	Data;
+		uint32_t	Position;
+
+		void Write(const uint32_t value, const uint32_t bitNum)
+		{
+			for (uint32_t i = 0; i < bitNum; ++i, ++Position)
+				Data[Position >> 3] |= uint8_t(((value >> i) & 1) << (Position & 7));
+		}
+	};
+
+	struct BitReader
+	{
+		const uint8_t*	Data;
+		uint32_t		Position;
+
+		uint32_t Read(const uint32_t bitNum)
+		{
+			uint32_t value = 0;
+			for (uint32_t i = 0; i < bitNum; ++i, ++Position)
+				value |= uint32_t((Data[Position >> 3] >> (Position & 7)) & 1) << i;
+			return value;
+		}
+	};
+
+	//**************************************************
+	/// \brief BC7 mode 6, one subset of RGBA with 4 bit indices
+	//**************************************************
+	void EncodeBc7(const Block& block, const Settings& settings, uint8_t* output)
+	{
+		float mean[4], axis[4], endpoint[2][4];
+		PrincipalAxis(block, 4, settings.AxisIterations, mean, axis);
+		AxisEndpoints(block, 4, mean, axis, endpoint);
+
+		uint8_t quantized[2][4], pbit[2];
+		QuantizeBc7(endpoint[0], quantized[0], &pbit[0]);
+		QuantizeBc7(endpoint[1], quantized[1], &pbit[1]);
+		uint8_t indices[16];
+		float error = Bc7Indices(block, quantized, pbit, indices);
+
+		float weights[16];
+		for (uint32_t i = 0; i < 16; ++i)
+			weights[i] = float(k_bc7Weights[i]) / 64.0f;
+		for (uint32_t refit = 0; refit < settings.Refits; ++refit)
+		{
+			if (!LeastSquares(block, 4, indices, weights, endpoint))
+				break;
+
+			uint8_t candidate[2][4], candidatePbit[2], candidateIndices[16];
+			QuantizeBc7(endpoint[0], candidate[0], &candidatePbit[0]);
+			QuantizeBc7(endpoint[1], candidate[1], &candidatePbit[1]);
+			const float candidateError = Bc7Indices(block, candidate, candidatePbit, candidateIndices);
+			if (candidateError >= error)
+				break;
+
+			error = candidateError;
+			std::memcpy(quantized, candidate, sizeof(quantized));
+			std::copy(candidatePbit, candidatePbit + 2, pbit);
+			std::copy(candidateIndices, candidateIndices + 16, indices);
+		}
+
+		// Anchor index has an implicit zero high bit
+		if (indices[0] & 8)
+		{
+			for (uint32_t c = 0; c < 4; ++c)
+				std::swap(quantized[0][c], quantized[1][c]);
+			std::swap(pbit[0], pbit[1]);
+			for (uint8_t& index : indices)
+				index = uint8_t(15 - index);
+		}
+
+		std::memset(output, 0, 16);
+		BitWriter writer{ output, 0 };
+		writer.Write(1 << 6, 7);
+		for (uint32_t c = 0; c < 4; ++c)
+		{
+			writer.Write(quantized[0][c], 7);
+			writer.Write(quantized[1][c], 7);
+		}
+		writer.Write(pbit[0], 1);
+		writer.Write(pbit[1], 1);
+		writer.Write(indices[0], 3);
+		for (uint32_t i = 1; i < 16; ++i)
+			writer.Write(indices[i], 4);
+	}
+
+	void DecodeColor(const uint8_t* input, const bool fourColor, uint8_t (*pixels)[4])
+	{
+		uint16_t color[2];
+		uint32_t bits;
+		std::memcpy(color, input, 4);
+		std::memcpy(&bits, input + 4, 4);
+
+		uint32_t palette[4][4]{};
+		Unpack565(color[0], palette[0]);
+		Unpack565(color[1], palette[1]);
+		palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 255;
+		for (uint32_t c = 0; c < 3; ++c)
+		{
+			if (fourColor || color[0] > color[1])
+			{
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+			else
+			{
+				palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+				palette[3][c] = 0;
+			}
+		}
+		if (!fourColor && color[0] <= color[1])
+			palette[3][3] = 0;
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			const uint32_t index = (bits >> (i * 2)) & 3;
+			for (uint32_t c = 0; c < 4; ++c)
+				pixels[i][c] = uint8_t(palette[index][c]);
+		}
+	}
+
+	void DecodeChannel(const uint8_t* input, const uint32_t channel, uint8_t (*pixels)[4])
+	{
+		const uint32_t a0 = input[0], a1 = input[1];
+		uint32_t palette[8]{ a0, a1 };
+		for (uint32_t p = 2; p < 8; ++p)
+		{
+			if (a0 > a1)
+				palette[p] = ((8 - p) * a0 + (p - 1) * a1) / 7;
+			else
+				palette[p] = p < 6 ? ((6 - p) * a0 + (p - 1) * a1) / 5 : (p == 6 ? 0 : 255);
+		}
+
+		uint64_t bits = 0;
+		for (uint32_t i = 0; i < 6; ++i)
+			bits |= uint64_t(input[2 + i]) << (i * 8);
+		for (uint32_t i = 0; i < 16; ++i)
+			pixels[i][channel] = uint8_t(palette[(bits >> (i * 3)) & 7]);
+	}
+
+	bool DecodeBc7(const uint8_t* input, uint8_t (*pixels)[4])
+	{
+		BitReader reader{ input, 0 };
+		if (reader.Read(7) != (1 << 6))
+			return false;
+
+		uint32_t endpoint[2][4];
+		for (uint32_t c = 0; c < 4; ++c)
+		{
+			endpoint[0][c] = reader.Read(7) << 1;
+			endpoint[1][c] = reader.Read(7) << 1;
+		}
+		const uint32_t p0 = reader.Read(1), p1 = reader.Read(1);
+		for (uint32_t c = 0; c < 4; ++c)
+		{
+			endpoint[0][c] |= p0;
+			endpoint[1][c] |= p1;
+		}
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			const uint32_t weight = k_bc7Weights[reader.Read(i == 0 ? 3 : 4)];
+			for (uint32_t c = 0; c < 4; ++c)
+				pixels[i][c] = uint8_t(((64 - weight) * endpoint[0][c] + weight * endpoint[1][c] + 32) >> 6);
+		}
+		return true;
+	}
+}
+
+/* Compress */
+bool TextureCompressor::Compress(const uint8_t* rgba, const uint32_t width, const uint32_t height, const uint32_t rowPitch, const TextureFile::FORMAT format, const QUALITY quality, std::vector<uint8_t>* blocks)
+{
+	KIND kind;
+	if (!rgba || width == 0 || height == 0 || !GetKind(format, &kind))
+		return false;
+
+	const Settings settings		= GetSettings(quality);
+	const uint32_t blockBytes	= TextureFile::BlockBytes(format);
+	const uint32_t blocksX		= (width + 3) / 4;
+	const uint32_t blocksY		= (height + 3) / 4;
+	blocks->resize(size_t(blocksX) * blocksY * blockBytes);
+	uint8_t* output = blocks->data();
+
+	ThreadPool::Shared().ParallelFor(blocksY, [&](size_t y)
+	{
+		Block block;
+		for (uint32_t x = 0; x < blocksX; ++x)
+		{
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				const uint32_t px		= (std::min)(x * 4 + (i & 3), width - 1);
+				const uint32_t py		= (std::min)(uint32_t(y) * 4 + (i >> 2), height - 1);
+				const uint8_t* pixel	= rgba + size_t(py) * rowPitch + size_t(px) * 4;
+				for (uint32_t c = 0; c < 4; ++c)
+					block.Channel[c][i] = float(pixel[c]);
+			}
+
+			uint8_t* target = output + (y * blocksX + x) * blockBytes;
+			switch (kind)
+			{
+			case KIND::BC1:
+				EncodeColor(block, settings, target);
+				break;
+			case KIND::BC3:
+				EncodeChannel(block.Channel[3], settings, target);
+				EncodeColor(block, settings, target + 8);
+				break;
+			case KIND::BC4:
+				EncodeChannel(block.Channel[0], settings, target);
+				break;
+			case KIND::BC5:
+				EncodeChannel(block.Channel[0], settings, target);
+				EncodeChannel(block.Channel[1], settings, target + 8);
+				break;
+			default:
+				EncodeBc7(block, settings, target);
+				break;
+			}
+		}
+	});
+	return true;
+}
+
+/* Decompress */
+bool TextureCompressor::Decompress(const uint8_t* blocks, const uint32_t width, const uint32_t height, const TextureFile::FORMAT format, std::vector<uint8_t>* rgba)
+{
+	KIND kind;
+	if (!blocks || !GetKind(format, &kind))
+		return false;
+
+	const uint32_t blockBytes	= TextureFile::BlockBytes(format);
+	const uint32_t blocksX		= (width + 3) / 4;
+	const uint32_t blocksY		= (height + 3) / 4;
+	rgba->assign(size_t(width) * height * 4, 0);
+
+	for (uint32_t y = 0; y < blocksY; ++y)
+	{
+		for (uint32_t x = 0; x < blocksX; ++x)
+		{
+			const uint8_t* input = blocks + (size_t(y) * blocksX + x) * blockBytes;
+			uint8_t pixels[16][4]{};
+			for (uint32_t i = 0; i < 16; ++i)
+				pixels[i][3] = 255;
+
+			switch (kind)
+			{
+			case KIND::BC1:
+				DecodeColor(input, false, pixels);
+				break;
+			case KIND::BC3:
+				DecodeColor(input + 8, true, pixels);
+				DecodeChannel(input, 3, pixels);
+				break;
+			case KIND::BC4:
+				DecodeChannel(input, 0, pixels);
+				break;
+			case KIND::BC5:
+				DecodeChannel(input, 0, pixels);
+				DecodeChannel(input + 8, 1, pixels);
+				break;
+			default:
+				if (!DecodeBc7(input, pixels))
+					return false;
+				break;
+			}
+
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				const uint32_t px = x * 4 + (i & 3);
+				const uint32_t py = y * 4 + (i >> 2);
+				if (px < width && py < height)
+					std::memcpy(rgba->data() + (size_t(py) * width + px) * 4, pixels[i], 4);
+			}
+		}
+	}
+	return true;
+}
+
+/* PSNR */
+double TextureCompressor::Psnr(const uint8_t* reference, const uint8_t* test, const size_t pixelNum, const uint32_t channelNum)
+{
+	const uint32_t channels = (std::min)((std::max)(channelNum, 1u), 4u);
+	double sum = 0.0;
+	for (size_t i = 0; i < pixelNum; ++i)
+	{
+		for (uint32_t c = 0; c < channels; ++c)
+		{
+			const double difference = double(reference[i * 4 + c]) - double(test[i * 4 + c]);
+			sum += difference * difference;
+		}
+	}
+
+	const double mse = sum / (double(pixelNum) * channels);
+	return mse > 0.0 ? (std::min)(10.0 * std::log10(255.0 * 255.0 / mse), 100.0) : 100.0;
+}
+
+/* Channel number */
+uint32_t TextureCompressor::ChannelNum(const TextureFile::FORMAT format)
+{
+	KIND kind;
+	if (!GetKind(format, &kind))
+		return 0;
+
+	switch (kind)
+	{
+	case KIND::BC1:	return 3;
+	case KIND::BC4:	return 1;
+	case KIND::BC5:	return 2;
+	default:		return 4;
+	}
+}
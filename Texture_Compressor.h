@@ -0,0 +1,97 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Texture_Compressor.h
+*		Detail	: Cpu block compression to BC1, BC3, BC4, BC5 and BC7
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Texture_File.h"
+
+class TextureCompressor
+{
+public:
+	//**************************************************
+	/// \brief Speed and quality trade off
+	//**************************************************
+	enum class QUALITY
+	{
+		FAST,		// bounding box axis, no refinement
+		NORMAL,		// principal axis, one least squares refit
+		HIGH,		// more axis iterations and refits, wider BC4 endpoint search
+		NUM
+	};
+
+public:
+	//**************************************************
+	/// \brief Compress RGBA8 pixels on ThreadPool::Shared, one job per row of blocks
+	///        BC1 is opaque, BC4 takes red, BC5 red and green, BC7 uses mode 6
+	///        Partial edge blocks repeat the last row and column
+	///
+	/// \param[in]  rgba	 ->	source pixels, 4 bytes each
+	/// \param[in]  width	 ->	width in pixels
+	/// \param[in]  height	 ->	height in pixels
+	/// \param[in]  rowPitch ->	bytes per source row
+	/// \param[in]  format	 ->	BC1, BC3, BC4, BC5 or BC7 (UNORM or SRGB)
+	/// \param[in]  quality	 ->	speed and quality
+	/// \param[out] blocks	 ->	TextureFile::LevelBytes bytes of blocks
+	///
+	/// \return Success is true, false for other formats
+	//**************************************************
+	static bool Compress(
+		const uint8_t* rgba,
+		const uint32_t width,
+		const uint32_t height,
+		const uint32_t rowPitch,
+		const TextureFile::FORMAT format,
+		const QUALITY quality,
+		std::vector<uint8_t>* blocks
+	);
+
+	//**************************************************
+	/// \brief Decode blocks to RGBA8 for error measurement
+	///        BC7 blocks other than mode 6 are rejected
+	///
+	/// \param[in]  blocks	 ->	compressed data
+	/// \param[in]  width	 ->	width in pixels
+	/// \param[in]  height	 ->	height in pixels
+	/// \param[in]  format	 ->	format passed to Compress
+	/// \param[out] rgba	 ->	width * height pixels, missing channels are 0 and alpha 255
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool Decompress(
+		const uint8_t* blocks,
+		const uint32_t width,
+		const uint32_t height,
+		const TextureFile::FORMAT format,
+		std::vector<uint8_t>* rgba
+	);
+
+	//**************************************************
+	/// \brief Peak signal to noise ratio of two RGBA8 images
+	///
+	/// \param[in] reference	 ->	original pixels
+	/// \param[in] test			 ->	decoded pixels
+	/// \param[in] pixelNum		 ->	number of pixels
+	/// \param[in] channelNum	 ->	leading channels compared (1 to 4)
+	///
+	/// \return PSNR in dB, 100 for identical images
+	//**************************************************
+	static double Psnr(
+		const uint8_t* reference,
+		const uint8_t* test,
+		const size_t pixelNum,
+		const uint32_t channelNum
+	);
+
+	//**************************************************
+	/// \brief Number of channels a format stores
+	///
+	/// \return channel count for Psnr, 0 for unsupported formats
+	//**************************************************
+	static uint32_t ChannelNum(const TextureFile::FORMAT format);
+};
@@ -0,0 +1,350 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Texture_File.cpp
+*		Detail	: DDS and KTX2 header parsing and per mip level reads
+===================================================================================*/
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+
+#include "Texture_File.h"
+
+const uint32_t TextureFile::k_maxLevels;
+
+namespace
+{
+	const size_t k_headerReadSize = 512;	// DDS + DX10 header, KTX2 header + level index
+
+	const uint32_t k_ddsMagic			= 0x20534444;	// "DDS "
+	const uint32_t k_ddsFourCCFlag		= 0x4;
+	const uint32_t k_ddsRgbFlag			= 0x40;
+	const uint32_t k_ddsCubemapFlag		= 0x200;
+	const uint32_t k_ddsVolumeFlag		= 0x200000;
+	const uint32_t k_ddsDimension2D		= 3;			// D3D10_RESOURCE_DIMENSION_TEXTURE2D
+
+	const uint8_t k_ktx2Identifier[12]{ 0xab, 'K', 'T', 'X', ' ', '2', '0', 0xbb, '\r', '\n', 0x1a, '\n' };
+
+	//**************************************************
+	/// \brief Table row of format conversions
+	//**************************************************
+	struct FormatInfo
+	{
+		TextureFile::FORMAT	Format;
+		uint32_t			Dxgi;
+		uint32_t			Vulkan;
+		uint32_t			BlockBytes;
+		bool				Compressed;
+	};
+
+	const FormatInfo k_formatInfo[]
+	{
+		{ TextureFile::FORMAT::UNKNOWN,				0,	0,		0,	false },
+		{ TextureFile::FORMAT::R8_UNORM,			61,	9,		1,	false },
+		{ TextureFile::FORMAT::R8G8_UNORM,			49,	16,		2,	false },
+		{ TextureFile::FORMAT::R8G8B8A8_UNORM,		28,	37,		4,	false },
+		{ TextureFile::FORMAT::R8G8B8A8_UNORM_SRGB,	29,	43,		4,	false },
+		{ TextureFile::FORMAT::B8G8R8A8_UNORM,		87,	44,		4,	false },
+		{ TextureFile::FORMAT::B8G8R8A8_UNORM_SRGB,	91,	50,		4,	false },
+		{ TextureFile::FORMAT::R16G16B16A16_FLOAT,	10,	97,		8,	false },
+		{ TextureFile::FORMAT::R32G32B32A32_FLOAT,	2,	109,	16,	false },
+		{ TextureFile::FORMAT::BC1_UNORM,			71,	133,	8,	true },
+		{ TextureFile::FORMAT::BC1_UNORM_SRGB,		72,	134,	8,	true },
+		{ TextureFile::FORMAT::BC2_UNORM,			74,	135,	16,	true },
+		{ TextureFile::FORMAT::BC2_UNORM_SRGB,		75,	136,	16,	true },
+		{ TextureFile::FORMAT::BC3_UNORM,			77,	137,	16,	true },
+		{ TextureFile::FORMAT::BC3_UNORM_SRGB,		78,	138,	16,	true },
+		{ TextureFile::FORMAT::BC4_UNORM,			80,	139,	8,	true },
+		{ TextureFile::FORMAT::BC4_SNORM,			81,	140,	8,	true },
+		{ TextureFile::FORMAT::BC5_UNORM,			83,	141,	16,	true },
+		{ TextureFile::FORMAT::BC5_SNORM,			84,	142,	16,	true },
+		{ TextureFile::FORMAT::BC6H_UF16,			95,	143,	16,	true },
+		{ TextureFile::FORMAT::BC6H_SF16,			96,	144,	16,	true },
+		{ TextureFile::FORMAT::BC7_UNORM,			98,	145,	16,	true },
+		{ TextureFile::FORMAT::BC7_UNORM_SRGB,		99,	146,	16,	true },
+	};
+	static_assert(sizeof(k_formatInfo) / sizeof(k_formatInfo[0]) == size_t(TextureFile::FORMAT::NUM), "format table is out of date");
+
+	TextureFile::FORMAT FromDxgi(const uint32_t dxgi)
+	{
+		for (const FormatInfo& info : k_formatInfo)
+		{
+			if (info.Dxgi == dxgi)
+				return info.Format;
+		}
+		return TextureFile::FORMAT::UNKNOWN;
+	}
+
+	TextureFile::FORMAT FromVulkan(const uint32_t vulkan)
+	{
+		// BC1 without alpha has its own VkFormat, the blocks are the same
+		if (vulkan == 131)	return TextureFile::FORMAT::BC1_UNORM;
+		if (vulkan == 132)	return TextureFile::FORMAT::BC1_UNORM_SRGB;
+		for (const FormatInfo& info : k_formatInfo)
+		{
+			if (info.Vulkan == vulkan)
+				return info.Format;
+		}
+		return TextureFile::FORMAT::UNKNOWN;
+	}
+
+	uint32_t FourCC(const char a, const char b, const char c, const char d)
+	{
+		return uint32_t(uint8_t(a)) | (uint32_t(uint8_t(b)) << 8) | (uint32_t(uint8_t(c)) << 16) | (uint32_t(uint8_t(d)) << 24);
+	}
+
+	uint32_t Read32(const uint8_t* data)
+	{
+		uint32_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	uint64_t Read64(const uint8_t* data)
+	{
+		uint64_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	//**************************************************
+	/// \brief Open file for binary reading with the stored name
+	//**************************************************
+#if defined(_WIN32)
+	FILE* OpenReadFile(const std::wstring& fileName)
+	{
+		return _wfopen(fileName.c_str(), L"rb");
+	}
+#else
+	FILE* OpenReadFile(const std::string& fileName)
+	{
+		return fileName.empty() ? nullptr : std::fopen(fileName.c_str(), "rb");
+	}
+#endif
+
+	bool Seek(FILE* file, const uint64_t offset, const int origin)
+	{
+#if defined(_WIN32)
+		return _fseeki64(file, (long long)offset, origin) == 0;
+#else
+		return fseeko(file, off_t(offset), origin) == 0;
+#endif
+	}
+
+	uint64_t Tell(FILE* file)
+	{
+#if defined(_WIN32)
+		return uint64_t(_ftelli64(file));
+#else
+		return uint64_t(ftello(file));
+#endif
+	}
+}
+
+/* Constructor */
+TextureFile::TextureFile()
+	:m_format(FORMAT::UNKNOWN)
+{
+}
+
+/* Open */
+bool TextureFile::Open(const wchar_t* fileName)
+{
+	m_levels.clear();
+	m_format = FORMAT::UNKNOWN;
+	if (!fileName)
+		return false;
+
+#if defined(_WIN32)
+	m_fileName = fileName;
+#else
+	m_fileName.assign(std::wcslen(fileName) * MB_CUR_MAX + 1, '\0');
+	size_t length = std::wcstombs(&m_fileName[0], fileName, m_fileName.size());
+	m_fileName.resize(length == size_t(-1) ? 0 : length);
+#endif
+
+	FILE* file = OpenReadFile(m_fileName);
+	if (!file)
+		return false;
+
+	uint8_t header[k_headerReadSize]{};
+	size_t size = std::fread(header, 1, sizeof(header), file);
+	uint64_t fileSize = Seek(file, 0, SEEK_END) ? Tell(file) : 0;
+	std::fclose(file);
+
+	bool result = false;
+	if (size >= 4 && Read32(header) == k_ddsMagic)
+		result = this->ParseDds(header, size, fileSize);
+	else if (size >= sizeof(k_ktx2Identifier) && std::memcmp(header, k_ktx2Identifier, sizeof(k_ktx2Identifier)) == 0)
+		result = this->ParseKtx2(header, size, fileSize);
+
+	if (!result)
+	{
+		m_levels.clear();
+		m_format = FORMAT::UNKNOWN;
+	}
+	return result;
+}
+
+/* Read one level */
+bool TextureFile::ReadLevel(const uint32_t level, void* data) const
+{
+	if (level >= m_levels.size() || !data)
+		return false;
+
+	FILE* file = OpenReadFile(m_fileName);
+	if (!file)
+		return false;
+
+	const Level& info = m_levels[level];
+	bool result = Seek(file, info.Offset, SEEK_SET) &&
+		std::fread(data, 1, size_t(info.Bytes), file) == size_t(info.Bytes);
+	std::fclose(file);
+	return result;
+}
+
+/* Block bytes */
+uint32_t TextureFile::BlockBytes(const FORMAT format)
+{
+	return format < FORMAT::NUM ? k_formatInfo[size_t(format)].BlockBytes : 0;
+}
+
+/* Is compressed */
+bool TextureFile::IsCompressed(const FORMAT format)
+{
+	return format < FORMAT::NUM && k_formatInfo[size_t(format)].Compressed;
+}
+
+/* DXGI format */
+uint32_t TextureFile::DxgiFormat(const FORMAT format)
+{
+	return format < FORMAT::NUM ? k_formatInfo[size_t(format)].Dxgi : 0;
+}
+
+/* Level bytes */
+uint64_t TextureFile::LevelBytes(const FORMAT format, const uint32_t width, const uint32_t height, uint32_t* rowPitch)
+{
+	uint64_t columns	= width;
+	uint64_t rows		= height;
+	if (IsCompressed(format))
+	{
+		columns	= (std::max)(uint64_t(1), (columns + 3) / 4);
+		rows	= (std::max)(uint64_t(1), (rows + 3) / 4);
+	}
+
+	const uint64_t pitch = columns * BlockBytes(format);
+	if (rowPitch)
+		*rowPitch = uint32_t(pitch);
+	return pitch * rows;
+}
+
+// Parse DDS
+bool TextureFile::ParseDds(const uint8_t* data, const size_t size, const uint64_t fileSize)
+{
+	// magic(4) + DDS_HEADER(124), DDS_PIXELFORMAT starts at 72 of DDS_HEADER
+	const size_t headerSize = 4 + 124;
+	if (size < headerSize || Read32(data + 4) != 124)
+		return false;
+
+	const uint32_t height		= Read32(data + 4 + 8);
+	const uint32_t width		= Read32(data + 4 + 12);
+	const uint32_t depth		= Read32(data + 4 + 20);
+	const uint32_t mipNum		= (std::max)(Read32(data + 4 + 24), 1u);
+	const uint8_t* pixelFormat	= data + 4 + 72;
+	const uint32_t formatFlags	= Read32(pixelFormat + 4);
+	const uint32_t fourCC		= Read32(pixelFormat + 8);
+	const uint32_t caps2		= Read32(data + 4 + 108);
+	if ((caps2 & (k_ddsCubemapFlag | k_ddsVolumeFlag)) || depth > 1)
+		return false;
+
+	size_t offset = headerSize;
+	if ((formatFlags & k_ddsFourCCFlag) && fourCC == FourCC('D', 'X', '1', '0'))
+	{
+		// DDS_HEADER_DXT10
+		if (size < headerSize + 20)
+			return false;
+		const uint32_t dimension	= Read32(data + headerSize + 4);
+		const uint32_t miscFlag		= Read32(data + headerSize + 8);
+		const uint32_t arraySize	= Read32(data + headerSize + 12);
+		if (dimension != k_ddsDimension2D || arraySize > 1 || (miscFlag & 0x4))
+			return false;
+		m_format	= FromDxgi(Read32(data + headerSize));
+		offset		+= 20;
+	}
+	else if (formatFlags & k_ddsFourCCFlag)
+	{
+		if (fourCC == FourCC('D', 'X', 'T', '1'))											m_format = FORMAT::BC1_UNORM;
+		else if (fourCC == FourCC('D', 'X', 'T', '2') || fourCC == FourCC('D', 'X', 'T', '3'))	m_format = FORMAT::BC2_UNORM;
+		else if (fourCC == FourCC('D', 'X', 'T', '4') || fourCC == FourCC('D', 'X', 'T', '5'))	m_format = FORMAT::BC3_UNORM;
+		else if (fourCC == FourCC('A', 'T', 'I', '1') || fourCC == FourCC('B', 'C', '4', 'U'))	m_format = FORMAT::BC4_UNORM;
+		else if (fourCC == FourCC('B', 'C', '4', 'S'))										m_format = FORMAT::BC4_SNORM;
+		else if (fourCC == FourCC('A', 'T', 'I', '2') || fourCC == FourCC('B', 'C', '5', 'U'))	m_format = FORMAT::BC5_UNORM;
+		else if (fourCC == FourCC('B', 'C', '5', 'S'))										m_format = FORMAT::BC5_SNORM;
+	}
+	else if ((formatFlags & k_ddsRgbFlag) && Read32(pixelFormat + 12) == 32)
+	{
+		// 32 bit masks, red in the low byte is RGBA order
+		const uint32_t redMask = Read32(pixelFormat + 16);
+		if (redMask == 0x000000ff)		m_format = FORMAT::R8G8B8A8_UNORM;
+		else if (redMask == 0x00ff0000)	m_format = FORMAT::B8G8R8A8_UNORM;
+	}
+
+	if (m_format == FORMAT::UNKNOWN || width == 0 || height == 0 || mipNum > k_maxLevels)
+		return false;
+
+	// Levels follow the header back to back, largest first
+	uint64_t position = offset;
+	for (uint32_t i = 0; i < mipNum; ++i)
+	{
+		Level level{};
+		level.Width		= (std::max)(width >> i, 1u);
+		level.Height	= (std::max)(height >> i, 1u);
+		level.Offset	= position;
+		level.Bytes		= LevelBytes(m_format, level.Width, level.Height, &level.RowPitch);
+		position		+= level.Bytes;
+		m_levels.push_back(level);
+	}
+	return position <= fileSize;
+}
+
+// Parse KTX2
+bool TextureFile::ParseKtx2(const uint8_t* data, const size_t size, const uint64_t fileSize)
+{
+	// identifier(12) + 9 header words + index(32), level index starts at 80
+	const size_t levelIndexOffset = 80;
+	if (size < levelIndexOffset)
+		return false;
+
+	const uint32_t vkFormat			= Read32(data + 12);
+	const uint32_t width			= Read32(data + 20);
+	const uint32_t height			= Read32(data + 24);
+	const uint32_t depth			= Read32(data + 28);
+	const uint32_t layerNum			= Read32(data + 32);
+	const uint32_t faceNum			= Read32(data + 36);
+	const uint32_t mipNum			= (std::max)(Read32(data + 40), 1u);
+	const uint32_t supercompression	= Read32(data + 44);
+	if (depth > 1 || layerNum > 1 || faceNum != 1 || supercompression != 0 || height == 0)
+		return false;
+
+	m_format = FromVulkan(vkFormat);
+	if (m_format == FORMAT::UNKNOWN || width == 0 || mipNum > k_maxLevels || size < levelIndexOffset + mipNum * 24)
+		return false;
+
+	// Level index is largest first, level data in the file is usually smallest first
+	for (uint32_t i = 0; i < mipNum; ++i)
+	{
+		const uint8_t* entry = data + levelIndexOffset + i * 24;
+		Level level{};
+		level.Width		= (std::max)(width >> i, 1u);
+		level.Height	= (std::max)(height >> i, 1u);
+		level.Offset	= Read64(entry);
+		level.Bytes		= Read64(entry + 8);
+		if (level.Bytes != LevelBytes(m_format, level.Width, level.Height, &level.RowPitch) ||
+			level.Offset > fileSize || level.Bytes > fileSize - level.Offset)
+			return false;
+		m_levels.push_back(level);
+	}
+	return true;
+}
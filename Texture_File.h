@@ -0,0 +1,162 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Texture_File.h
+*		Detail	: DDS and KTX2 header parsing and per mip level reads
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class TextureFile
+{
+public:
+	//**************************************************
+	/// \brief Pixel format of the mip levels
+	//**************************************************
+	enum class FORMAT
+	{
+		UNKNOWN,
+		R8_UNORM,
+		R8G8_UNORM,
+		R8G8B8A8_UNORM,
+		R8G8B8A8_UNORM_SRGB,
+		B8G8R8A8_UNORM,
+		B8G8R8A8_UNORM_SRGB,
+		R16G16B16A16_FLOAT,
+		R32G32B32A32_FLOAT,
+		BC1_UNORM,
+		BC1_UNORM_SRGB,
+		BC2_UNORM,
+		BC2_UNORM_SRGB,
+		BC3_UNORM,
+		BC3_UNORM_SRGB,
+		BC4_UNORM,
+		BC4_SNORM,
+		BC5_UNORM,
+		BC5_SNORM,
+		BC6H_UF16,
+		BC6H_SF16,
+		BC7_UNORM,
+		BC7_UNORM_SRGB,
+		NUM
+	};
+
+	//**************************************************
+	/// \brief Location and size of one mip level
+	//**************************************************
+	struct Level
+	{
+		uint64_t	Offset;		// from the file start
+		uint64_t	Bytes;
+		uint32_t	Width;
+		uint32_t	Height;
+		uint32_t	RowPitch;	// bytes per row of pixels or blocks
+	};
+
+	static const uint32_t k_maxLevels = 16;
+
+public:
+	TextureFile();
+
+	//**************************************************
+	/// \brief Read header and level index (.dds or .ktx2)
+	///        2D textures without supercompression only, pixel data is not read
+	///
+	/// \param[in] fileName	 ->	texture file
+	///
+	/// \return Success is true
+	//**************************************************
+	bool Open(const wchar_t* fileName);
+
+	//**************************************************
+	/// \brief Read pixel data of one level, safe to call from several threads
+	///
+	/// \param[in]  level	 ->	mip level (0 is the largest)
+	/// \param[out] data	 ->	Level::Bytes of storage
+	///
+	/// \return Success is true
+	//**************************************************
+	bool ReadLevel(
+		const uint32_t level,
+		void* data
+	) const;
+
+	FORMAT			GetFormat() const		{ return m_format; }
+	uint32_t		Width() const			{ return m_levels.empty() ? 0 : m_levels[0].Width; }
+	uint32_t		Height() const			{ return m_levels.empty() ? 0 : m_levels[0].Height; }
+	uint32_t		MipNum() const			{ return uint32_t(m_levels.size()); }
+	const Level&	GetLevel(uint32_t i) const	{ return m_levels[i]; }
+	bool			IsOpen() const			{ return !m_levels.empty(); }
+
+	//**************************************************
+	/// \brief Bytes per 4x4 block, or per pixel for uncompressed formats
+	///
+	/// \return 0 for UNKNOWN
+	//**************************************************
+	static uint32_t BlockBytes(const FORMAT format);
+
+	//**************************************************
+	/// \brief Format is block compressed (4x4 blocks)
+	///
+	/// \return if compressed then true
+	//**************************************************
+	static bool IsCompressed(const FORMAT format);
+
+	//**************************************************
+	/// \brief DXGI_FORMAT value of format
+	///
+	/// \return DXGI_FORMAT_UNKNOWN (0) for UNKNOWN
+	//**************************************************
+	static uint32_t DxgiFormat(const FORMAT format);
+
+	//**************************************************
+	/// \brief Size of one level of a tightly packed texture
+	///
+	/// \param[in]  format	 ->	pixel format
+	/// \param[in]  width	 ->	level width
+	/// \param[in]  height	 ->	level height
+	/// \param[out] rowPitch ->	bytes per row of pixels or blocks (may be nullptr)
+	///
+	/// \return bytes of the level
+	//**************************************************
+	static uint64_t LevelBytes(
+		const FORMAT format,
+		const uint32_t width,
+		const uint32_t height,
+		uint32_t* rowPitch
+	);
+
+private:
+	//**************************************************
+	/// \brief Parse DDS header, DX10 extension included
+	///
+	/// \return Success is true
+	//**************************************************
+	bool ParseDds(
+		const uint8_t* data,
+		const size_t size,
+		const uint64_t fileSize
+	);
+
+	//**************************************************
+	/// \brief Parse KTX2 header and level index
+	///
+	/// \return Success is true
+	//**************************************************
+	bool ParseKtx2(
+		const uint8_t* data,
+		const size_t size,
+		const uint64_t fileSize
+	);
+
+#if defined(_WIN32)
+	std::wstring		m_fileName;
+#else
+	std::string			m_fileName;		// narrowed once in Open
+#endif
+	FORMAT				m_format;
+	std::vector<Level>	m_levels;
+};
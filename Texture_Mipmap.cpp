@@ -0,0 +1,350 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Texture_Mipmap.cpp
+*		Detail	: Cpu mip chain generation with gamma correct resampling
+===================================================================================*/
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define TEXTURE_MIPMAP_SSE
+#endif
+
+#include "Texture_Mipmap.h"
+#include "Thread_Pool.h"
+
+const uint32_t TextureMipmap::k_tileRows;
+
+namespace
+{
+	const float		k_pi				= 3.14159265358979f;
+	const float		k_kaiserAlpha		= 4.0f;
+	const float		k_sincSupport		= 3.0f;		// lobes per side of Kaiser and Lanczos
+	const uint32_t	k_linearTableSize	= 4096;		// linear to sRGB table entries
+
+	//**************************************************
+	/// \brief Source taps of one destination pixel along one axis
+	//**************************************************
+	struct Contribution
+	{
+		uint32_t	Start;			// first source pixel
+		uint32_t	Count;
+		uint32_t	WeightOffset;	// into Resampler::Weights
+	};
+
+	struct Resampler
+	{
+		std::vector<Contribution>	Contributions;
+		std::vector<float>			Weights;		// normalized, sum of each pixel is 1
+	};
+
+	//**************************************************
+	/// \brief Float RGBA image, color premultiplied when requested
+	//**************************************************
+	struct Image
+	{
+		uint32_t			Width;
+		uint32_t			Height;
+		std::vector<float>	Pixels;
+	};
+
+	float Sinc(const float x)
+	{
+		const float angle = x * k_pi;
+		return std::fabs(angle) < 1e-5f ? 1.0f : std::sin(angle) / angle;
+	}
+
+	// Modified Bessel function of the first kind, order 0
+	float BesselI0(const float x)
+	{
+		float sum = 1.0f, term = 1.0f;
+		for (int k = 1; k < 32 && term > sum * 1e-8f; ++k)
+		{
+			const float factor = x / (2.0f * float(k));
+			term	*= factor * factor;
+			sum		+= term;
+		}
+		return sum;
+	}
+
+	float FilterWeight(const TextureMipmap::FILTER filter, const float x)
+	{
+		if (std::fabs(x) >= k_sincSupport)
+			return 0.0f;
+
+		if (filter == TextureMipmap::FILTER::LANCZOS)
+			return Sinc(x) * Sinc(x / k_sincSupport);
+
+		static const float s_normalize = 1.0f / BesselI0(k_kaiserAlpha);
+		const float t = x / k_sincSupport;
+		return Sinc(x) * BesselI0(k_kaiserAlpha * std::sqrt(1.0f - t * t)) * s_normalize;
+	}
+
+	//**************************************************
+	/// \brief Taps of every destination pixel, edges are clamped
+	///        Box covers the source area exactly, sinc filters are stretched by the scale
+	//**************************************************
+	void BuildResampler(const TextureMipmap::FILTER filter, const uint32_t source, const uint32_t destination, Resampler* resampler)
+	{
+		resampler->Contributions.resize(destination);
+		resampler->Weights.clear();
+
+		const float scale = float(source) / float(destination);
+		std::vector<float> taps;
+		for (uint32_t i = 0; i < destination; ++i)
+		{
+			const float center = (float(i) + 0.5f) * scale;
+			const float radius = filter == TextureMipmap::FILTER::BOX ? scale * 0.5f : k_sincSupport * scale;
+			const int first = int(std::floor(center - radius));
+			const int last = int(std::ceil(center + radius));
+
+			const int start = (std::max)(first, 0);
+			const int end	= (std::min)(last, int(source));
+			taps.assign(size_t(end - start), 0.0f);
+			for (int j = first; j < last; ++j)
+			{
+				float weight;
+				if (filter == TextureMipmap::FILTER::BOX)
+					weight = (std::max)((std::min)(float(j + 1), center + radius) - (std::max)(float(j), center - radius), 0.0f);
+				else
+					weight = FilterWeight(filter, (float(j) + 0.5f - center) / scale);
+
+				const int clamped = (std::min)((std::max)(j, start), end - 1);
+				taps[size_t(clamped - start)] += weight;
+			}
+
+			float sum = 0.0f;
+			for (float weight : taps)
+				sum += weight;
+
+			Contribution& contribution	= resampler->Contributions[i];
+			contribution.Start			= uint32_t(start);
+			contribution.Count			= uint32_t(taps.size());
+			contribution.WeightOffset	= uint32_t(resampler->Weights.size());
+			for (float weight : taps)
+				resampler->Weights.push_back(sum != 0.0f ? weight / sum : 1.0f / float(taps.size()));
+		}
+	}
+
+	float SrgbToLinear(const float value)
+	{
+		return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+	}
+
+	float LinearToSrgb(const float value)
+	{
+		return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+	}
+
+	//**************************************************
+	/// \brief Lookup tables of the sRGB transfer function
+	//**************************************************
+	struct TransferTables
+	{
+		float	ToLinear[256];
+		uint8_t	ToSrgb[k_linearTableSize];
+
+		TransferTables()
+		{
+			for (uint32_t i = 0; i < 256; ++i)
+				ToLinear[i] = SrgbToLinear(float(i) / 255.0f);
+			for (uint32_t i = 0; i < k_linearTableSize; ++i)
+				ToSrgb[i] = uint8_t(LinearToSrgb(float(i) / float(k_linearTableSize - 1)) * 255.0f + 0.5f);
+		}
+	};
+
+	const TransferTables& Tables()
+	{
+		static const TransferTables s_tables;
+		return s_tables;
+	}
+
+	//**************************************************
+	/// \brief Filter source into destination, vertical then horizontal per row
+	//**************************************************
+	void Resample(const Image& source, const TextureMipmap::Options& options, Image* destination)
+	{
+		Resampler horizontal, vertical;
+		BuildResampler(options.Filter, source.Width, destination->Width, &horizontal);
+		BuildResampler(options.Filter, source.Height, destination->Height, &vertical);
+		destination->Pixels.resize(size_t(destination->Width) * destination->Height * 4);
+
+		const size_t sourceStride	= size_t(source.Width) * 4;
+		const uint32_t tileNum		= (destination->Height + TextureMipmap::k_tileRows - 1) / TextureMipmap::k_tileRows;
+		ThreadPool::Shared().ParallelFor(tileNum, [&](size_t tile)
+		{
+			std::vector<float> row(sourceStride);
+			const uint32_t first	= uint32_t(tile) * TextureMipmap::k_tileRows;
+			const uint32_t last		= (std::min)(first + TextureMipmap::k_tileRows, destination->Height);
+			for (uint32_t y = first; y < last; ++y)
+			{
+				const Contribution& column	= vertical.Contributions[y];
+				const float* columnWeights	= vertical.Weights.data() + column.WeightOffset;
+				const float* sourceRow		= source.Pixels.data() + column.Start * sourceStride;
+				float* output				= destination->Pixels.data() + size_t(y) * destination->Width * 4;
+
+#if defined(TEXTURE_MIPMAP_SSE)
+				// One RGBA pixel per register
+				for (size_t x = 0; x < sourceStride; x += 4)
+				{
+					__m128 sum = _mm_setzero_ps();
+					for (uint32_t k = 0; k < column.Count; ++k)
+						sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(columnWeights[k]), _mm_loadu_ps(sourceRow + k * sourceStride + x)));
+					_mm_storeu_ps(row.data() + x, sum);
+				}
+
+				const __m128 zero	= _mm_setzero_ps();
+				const __m128 one	= _mm_set1_ps(1.0f);
+				for (uint32_t x = 0; x < destination->Width; ++x)
+				{
+					const Contribution& tap	= horizontal.Contributions[x];
+					const float* weights	= horizontal.Weights.data() + tap.WeightOffset;
+					const float* input		= row.data() + tap.Start * 4;
+					__m128 sum = _mm_setzero_ps();
+					for (uint32_t k = 0; k < tap.Count; ++k)
+						sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[k]), _mm_loadu_ps(input + k * 4)));
+
+					// Negative lobes overshoot, premultiplied color may not exceed alpha
+					sum = _mm_min_ps(_mm_max_ps(sum, zero), one);
+					if (options.PremultiplyAlpha)
+						sum = _mm_min_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(3, 3, 3, 3)));
+					_mm_storeu_ps(output + x * 4, sum);
+				}
+#else
+				for (size_t x = 0; x < sourceStride; ++x)
+				{
+					float sum = 0.0f;
+					for (uint32_t k = 0; k < column.Count; ++k)
+						sum += columnWeights[k] * sourceRow[k * sourceStride + x];
+					row[x] = sum;
+				}
+
+				for (uint32_t x = 0; x < destination->Width; ++x)
+				{
+					const Contribution& tap	= horizontal.Contributions[x];
+					const float* weights	= horizontal.Weights.data() + tap.WeightOffset;
+					const float* input		= row.data() + tap.Start * 4;
+					float sum[4]{};
+					for (uint32_t k = 0; k < tap.Count; ++k)
+					{
+						for (uint32_t c = 0; c < 4; ++c)
+							sum[c] += weights[k] * input[k * 4 + c];
+					}
+					for (uint32_t c = 0; c < 4; ++c)
+						sum[c] = (std::min)((std::max)(sum[c], 0.0f), 1.0f);
+					for (uint32_t c = 0; options.PremultiplyAlpha && c < 3; ++c)
+						sum[c] = (std::min)(sum[c], sum[3]);
+					std::memcpy(output + x * 4, sum, sizeof(sum));
+				}
+#endif
+			}
+		});
+	}
+
+	//**************************************************
+	/// \brief RGBA8 to float, linear and premultiplied as requested
+	//**************************************************
+	void ToFloat(const uint8_t* rgba, const uint32_t rowPitch, const TextureMipmap::Options& options, Image* image)
+	{
+		const TransferTables& tables = Tables();
+		image->Pixels.resize(size_t(image->Width) * image->Height * 4);
+		ThreadPool::Shared().ParallelFor(image->Height, [&](size_t y)
+		{
+			const uint8_t* input	= rgba + y * rowPitch;
+			float* output			= image->Pixels.data() + y * image->Width * 4;
+			for (uint32_t x = 0; x < image->Width * 4; x += 4)
+			{
+				const float alpha = float(input[x + 3]) / 255.0f;
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					const float value = options.Srgb ? tables.ToLinear[input[x + c]] : float(input[x + c]) / 255.0f;
+					output[x + c] = options.PremultiplyAlpha ? value * alpha : value;
+				}
+				output[x + 3] = alpha;
+			}
+		});
+	}
+
+	//**************************************************
+	/// \brief Float to RGBA8, undo premultiplication and encode sRGB
+	//**************************************************
+	void ToBytes(const Image& image, const TextureMipmap::Options& options, uint8_t* rgba)
+	{
+		const TransferTables& tables = Tables();
+		ThreadPool::Shared().ParallelFor(image.Height, [&](size_t y)
+		{
+			const float* input	= image.Pixels.data() + y * image.Width * 4;
+			uint8_t* output		= rgba + y * image.Width * 4;
+			for (uint32_t x = 0; x < image.Width * 4; x += 4)
+			{
+				const float alpha = input[x + 3];
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					float value = input[x + c];
+					if (options.PremultiplyAlpha)
+						value = alpha > 0.0f ? (std::min)(value / alpha, 1.0f) : 0.0f;
+					output[x + c] = options.Srgb ?
+						tables.ToSrgb[uint32_t(value * float(k_linearTableSize - 1) + 0.5f)] :
+						uint8_t(value * 255.0f + 0.5f);
+				}
+				output[x + 3] = uint8_t(alpha * 255.0f + 0.5f);
+			}
+		});
+	}
+}
+
+/* Generate */
+bool TextureMipmap::Generate(const uint8_t* rgba, const uint32_t width, const uint32_t height, const uint32_t rowPitch, const Options& options, std::vector<Level>* levels)
+{
+	if (!rgba || width == 0 || height == 0 || options.Filter >= FILTER::NUM)
+		return false;
+
+	const uint32_t fullLevelNum	= FullLevelNum(width, height);
+	const uint32_t levelNum		= options.LevelNum == 0 ? fullLevelNum : (std::min)(options.LevelNum, fullLevelNum);
+	levels->resize(levelNum);
+
+	Level& top = (*levels)[0];
+	top.Width	= width;
+	top.Height	= height;
+	top.Pixels.resize(size_t(width) * height * 4);
+	for (uint32_t y = 0; y < height; ++y)
+		std::memcpy(top.Pixels.data() + size_t(y) * width * 4, rgba + size_t(y) * rowPitch, size_t(width) * 4);
+
+	// Every level is filtered from the float copy of the previous one, rounding happens once
+	Image current{ width, height, {} };
+	Image next{};
+	if (levelNum > 1)
+		ToFloat(rgba, rowPitch, options, &current);
+
+	for (uint32_t i = 1; i < levelNum; ++i)
+	{
+		next.Width	= (std::max)(current.Width / 2, 1u);
+		next.Height	= (std::max)(current.Height / 2, 1u);
+		Resample(current, options, &next);
+
+		Level& level	= (*levels)[i];
+		level.Width		= next.Width;
+		level.Height	= next.Height;
+		level.Pixels.resize(size_t(next.Width) * next.Height * 4);
+		ToBytes(next, options, level.Pixels.data());
+
+		std::swap(current, next);
+	}
+	return true;
+}
+
+/* Full level number */
+uint32_t TextureMipmap::FullLevelNum(const uint32_t width, const uint32_t height)
+{
+	uint32_t size = (std::max)(width, height);
+	uint32_t levelNum = 1;
+	while (size > 1)
+	{
+		size >>= 1;
+		++levelNum;
+	}
+	return levelNum;
+}
@@ -0,0 +1,82 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Texture_Mipmap.h
+*		Detail	: Cpu mip chain generation with gamma correct resampling
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class TextureMipmap
+{
+public:
+	//**************************************************
+	/// \brief Downsampling kernel
+	//**************************************************
+	enum class FILTER
+	{
+		BOX,		// area average, fastest, soft
+		KAISER,		// Kaiser windowed sinc, 3 taps per side
+		LANCZOS,	// Lanczos 3, sharpest, rings on hard edges
+		NUM
+	};
+
+	//**************************************************
+	/// \brief Generation settings
+	//**************************************************
+	struct Options
+	{
+		FILTER		Filter				= FILTER::KAISER;
+		bool		Srgb				= true;		// RGB is sRGB encoded, filtered in linear space
+		bool		PremultiplyAlpha	= true;		// weight color by alpha while filtering
+		uint32_t	LevelNum			= 0;		// 0 is the full chain down to 1x1
+	};
+
+	//**************************************************
+	/// \brief One generated level, RGBA8 tightly packed
+	//**************************************************
+	struct Level
+	{
+		uint32_t				Width;
+		uint32_t				Height;
+		std::vector<uint8_t>	Pixels;
+	};
+
+	static const uint32_t k_tileRows = 16;	// destination rows per ThreadPool job
+
+public:
+	//**************************************************
+	/// \brief Build the chain, each level is filtered from the previous one in float
+	///        Sizes are halved and rounded down, so any size works
+	///        Rows of a level are split into tiles on ThreadPool::Shared
+	///
+	/// \param[in]  rgba	 ->	source pixels, 4 bytes each
+	/// \param[in]  width	 ->	width in pixels
+	/// \param[in]  height	 ->	height in pixels
+	/// \param[in]  rowPitch ->	bytes per source row
+	/// \param[in]  options	 ->	filter and color space
+	/// \param[out] levels	 ->	level 0 is a copy of the source
+	///
+	/// \return Success is true
+	//**************************************************
+	static bool Generate(
+		const uint8_t* rgba,
+		const uint32_t width,
+		const uint32_t height,
+		const uint32_t rowPitch,
+		const Options& options,
+		std::vector<Level>* levels
+	);
+
+	//**************************************************
+	/// \brief Number of levels of a full chain
+	///
+	/// \return floor(log2(max(width, height))) + 1
+	//**************************************************
+	static uint32_t FullLevelNum(
+		const uint32_t width,
+		const uint32_t height
+	);
+};
@@ -0,0 +1,214 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Texture_Residency.cpp
+*		Detail	: Mip level load and eviction decisions under a memory budget
+===================================================================================*/
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+
+#include "Texture_Residency.h"
+
+const uint32_t	TextureResidency::k_maxLevels;
+const float		TextureResidency::k_evictionBias = 1.25f;
+
+namespace
+{
+	const uint32_t k_noTexture = (std::numeric_limits<uint32_t>::max)();
+}
+
+/* Constructor */
+TextureResidency::TextureResidency()
+	:m_budget((std::numeric_limits<uint64_t>::max)()),
+	m_residentBytes(0),
+	m_pendingBytes(0),
+	m_frame(0)
+{
+}
+
+/* Add */
+uint32_t TextureResidency::Add(const uint64_t* levelBytes, const uint32_t mipNum, const uint32_t tailMip)
+{
+	Texture texture{};
+	texture.MipNum			= (std::min)((std::max)(mipNum, 1u), k_maxLevels);
+	texture.TailMip			= (std::min)(tailMip, texture.MipNum - 1);
+	texture.ResidentMip		= texture.TailMip;
+	texture.FinestMip		= 0;
+	texture.DesiredMip		= float(texture.TailMip);
+	texture.Priority		= 0.0f;
+	texture.LastDemandFrame	= m_frame;
+	texture.Loading			= false;
+	for (uint32_t i = 0; i < texture.MipNum; ++i)
+	{
+		texture.LevelBytes[i] = levelBytes[i];
+		if (i >= texture.TailMip)
+			m_residentBytes += levelBytes[i];
+	}
+
+	m_textures.push_back(texture);
+	return uint32_t(m_textures.size() - 1);
+}
+
+/* Begin frame */
+void TextureResidency::BeginFrame()
+{
+	++m_frame;
+	for (Texture& texture : m_textures)
+	{
+		texture.DesiredMip	= float(texture.TailMip);
+		texture.Priority	= 0.0f;
+	}
+}
+
+/* Set demand */
+void TextureResidency::SetDemand(const uint32_t texture, const float desiredMip, const float priority)
+{
+	if (texture >= m_textures.size())
+		return;
+
+	// BeginFrame reset demand to the tail with no priority
+	Texture& target			= m_textures[texture];
+	const float mip			= (std::min)((std::max)(desiredMip, 0.0f), float(target.TailMip));
+	target.DesiredMip		= (std::min)(target.DesiredMip, mip);
+	target.Priority			= (std::max)(target.Priority, priority);
+	target.LastDemandFrame	= m_frame;
+}
+
+/* Plan */
+void TextureResidency::Plan(const size_t maxLoads, std::vector<Request>* loads, std::vector<Request>* evictions)
+{
+	// Budget was lowered or loads landed over it
+	while (m_residentBytes + m_pendingBytes > m_budget && this->EvictOne(FLT_MAX, k_noTexture, evictions))
+	{
+	}
+
+	if (maxLoads == 0)
+		return;
+
+	// Next finer level of every texture below its demand, most valuable first
+	struct Candidate
+	{
+		uint32_t	Texture;
+		float		Score;
+	};
+	std::vector<Candidate> candidates;
+	for (uint32_t i = 0; i < m_textures.size(); ++i)
+	{
+		const Texture& texture = m_textures[i];
+		const uint32_t desired = (std::max)(uint32_t(texture.DesiredMip), texture.FinestMip);
+		if (texture.Loading || texture.Priority <= 0.0f || texture.ResidentMip <= desired)
+			continue;
+		candidates.push_back({ i, LevelValue(texture, texture.ResidentMip - 1) });
+	}
+	std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b)
+	{
+		return a.Score > b.Score || (a.Score == b.Score && a.Texture < b.Texture);
+	});
+
+	size_t started = 0;
+	for (const Candidate& candidate : candidates)
+	{
+		if (started == maxLoads)
+			break;
+
+		Texture& texture		= m_textures[candidate.Texture];
+		const uint32_t mip		= texture.ResidentMip - 1;
+		const uint64_t bytes	= texture.LevelBytes[mip];
+		if (bytes > m_budget)
+			continue;
+
+		// Make room with levels worth clearly less than this one
+		while (m_residentBytes + m_pendingBytes + bytes > m_budget &&
+			this->EvictOne(candidate.Score / k_evictionBias, candidate.Texture, evictions))
+		{
+		}
+		if (m_residentBytes + m_pendingBytes + bytes > m_budget)
+			continue;
+
+		texture.Loading	= true;
+		m_pendingBytes	+= bytes;
+		loads->push_back({ candidate.Texture, mip });
+		++started;
+	}
+}
+
+/* On loaded */
+void TextureResidency::OnLoaded(const Request& request, const bool success)
+{
+	if (request.Texture >= m_textures.size())
+		return;
+
+	Texture& texture		= m_textures[request.Texture];
+	const uint64_t bytes	= texture.LevelBytes[request.Mip];
+	texture.Loading			= false;
+	m_pendingBytes			-= bytes;
+	if (success && request.Mip + 1 == texture.ResidentMip)
+	{
+		texture.ResidentMip	= request.Mip;
+		m_residentBytes		+= bytes;
+	}
+	else if (!success)
+	{
+		texture.FinestMip	= (std::max)(texture.FinestMip, request.Mip + 1);
+	}
+}
+
+/* Desired mip */
+float TextureResidency::DesiredMip(const uint32_t width, const uint32_t height, const float projectedWidth, const float projectedHeight)
+{
+	const float ratio = (std::max)(
+		float(width) / (std::max)(projectedWidth, 1.0f),
+		float(height) / (std::max)(projectedHeight, 1.0f));
+	return ratio > 1.0f ? std::log2(ratio) : 0.0f;
+}
+
+// Level value
+float TextureResidency::LevelValue(const Texture& texture, const uint32_t mip)
+{
+	// Missing levels hurt more the further the texture is from its demand
+	const float deficit = float(mip) + 1.0f - texture.DesiredMip;
+	return deficit > 0.0f ? texture.Priority * deficit : 0.0f;
+}
+
+// Evict one level
+bool TextureResidency::EvictOne(const float maxValue, const uint32_t keep, std::vector<Request>* evictions)
+{
+	// Least valuable first, then least recently demanded, then largest
+	uint32_t victim		= k_noTexture;
+	float victimValue	= 0.0f;
+	for (uint32_t i = 0; i < m_textures.size(); ++i)
+	{
+		const Texture& texture = m_textures[i];
+		if (i == keep || texture.Loading || texture.ResidentMip >= texture.TailMip)
+			continue;
+
+		const float value = LevelValue(texture, texture.ResidentMip);
+		if (value >= maxValue)
+			continue;
+
+		bool better = victim == k_noTexture || value < victimValue;
+		if (!better && value == victimValue)
+		{
+			const Texture& current = m_textures[victim];
+			better = texture.LastDemandFrame < current.LastDemandFrame ||
+				(texture.LastDemandFrame == current.LastDemandFrame &&
+					texture.LevelBytes[texture.ResidentMip] > current.LevelBytes[current.ResidentMip]);
+		}
+		if (better)
+		{
+			victim		= i;
+			victimValue	= value;
+		}
+	}
+
+	if (victim == k_noTexture)
+		return false;
+
+	Texture& texture = m_textures[victim];
+	evictions->push_back({ victim, texture.ResidentMip });
+	m_residentBytes -= texture.LevelBytes[texture.ResidentMip];
+	++texture.ResidentMip;
+	return true;
+}
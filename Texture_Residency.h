@@ -0,0 +1,170 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Texture_Residency.h
+*		Detail	: Mip level load and eviction decisions under a memory budget
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class TextureResidency
+{
+public:
+	//**************************************************
+	/// \brief One mip level of one texture
+	//**************************************************
+	struct Request
+	{
+		uint32_t	Texture;
+		uint32_t	Mip;
+	};
+
+	static const uint32_t	k_maxLevels		= 16;
+	static const float		k_evictionBias;	// a load must outscore a resident level by this factor
+
+public:
+	TextureResidency();
+
+	//**************************************************
+	/// \brief Add texture, levels from tailMip to the last are resident from the start
+	///
+	/// \param[in] levelBytes	 ->	bytes of each level, largest first
+	/// \param[in] mipNum		 ->	number of levels (at most k_maxLevels)
+	/// \param[in] tailMip		 ->	first level that is never evicted
+	///
+	/// \return texture index
+	//**************************************************
+	uint32_t Add(
+		const uint64_t* levelBytes,
+		const uint32_t mipNum,
+		const uint32_t tailMip
+	);
+
+	//**************************************************
+	/// \brief Change budget, Plan evicts until it is met
+	///
+	/// \return none
+	//**************************************************
+	void SetBudget(const uint64_t budget) { m_budget = budget; }
+
+	//**************************************************
+	/// \brief Start collecting demand of a new frame
+	///        Demand of the previous frame is dropped, resident levels stay until memory is needed
+	///
+	/// \return none
+	//**************************************************
+	void BeginFrame();
+
+	//**************************************************
+	/// \brief Add screen space demand, several calls per frame keep the finest mip
+	///
+	/// \param[in] texture		 ->	texture index
+	/// \param[in] desiredMip	 ->	level that matches the screen footprint (see DesiredMip)
+	/// \param[in] priority		 ->	importance, usually covered pixels
+	///
+	/// \return none
+	//**************************************************
+	void SetDemand(
+		const uint32_t texture,
+		const float desiredMip,
+		const float priority
+	);
+
+	//**************************************************
+	/// \brief Decide evictions and the next loads by priority
+	///        Loads are the next finer level of a texture, one in flight per texture
+	///
+	/// \param[in]  maxLoads	 ->	number of loads that may start
+	/// \param[out] loads		 ->	levels to read, reported with OnLoaded
+	/// \param[out] evictions	 ->	levels that are no longer resident
+	///
+	/// \return none
+	//**************************************************
+	void Plan(
+		const size_t maxLoads,
+		std::vector<Request>* loads,
+		std::vector<Request>* evictions
+	);
+
+	//**************************************************
+	/// \brief Finish a load started by Plan
+	///        A failed level is not requested again
+	///
+	/// \return none
+	//**************************************************
+	void OnLoaded(
+		const Request& request,
+		const bool success
+	);
+
+	//**************************************************
+	/// \brief Mip level of a texture footprint on screen
+	///
+	/// \param[in] width			 ->	texture width
+	/// \param[in] height			 ->	texture height
+	/// \param[in] projectedWidth	 ->	footprint width in pixels
+	/// \param[in] projectedHeight	 ->	footprint height in pixels
+	///
+	/// \return log2 of texels per pixel, 0 or more
+	//**************************************************
+	static float DesiredMip(
+		const uint32_t width,
+		const uint32_t height,
+		const float projectedWidth,
+		const float projectedHeight
+	);
+
+	uint32_t	ResidentMip(uint32_t texture) const	{ return m_textures[texture].ResidentMip; }
+	bool		IsLoading(uint32_t texture) const	{ return m_textures[texture].Loading; }
+	uint64_t	ResidentBytes() const				{ return m_residentBytes; }
+	uint64_t	PendingBytes() const				{ return m_pendingBytes; }
+	uint64_t	Budget() const						{ return m_budget; }
+	size_t		TextureNum() const					{ return m_textures.size(); }
+
+private:
+	struct Texture
+	{
+		uint64_t	LevelBytes[k_maxLevels];
+		uint32_t	MipNum;
+		uint32_t	TailMip;
+		uint32_t	ResidentMip;	// finest resident level, levels above it are resident too
+		uint32_t	FinestMip;		// levels finer than this failed to load
+		float		DesiredMip;
+		float		Priority;
+		uint64_t	LastDemandFrame;
+		bool		Loading;
+	};
+
+	//**************************************************
+	/// \brief Value of a level to its texture, 0 when finer than demanded
+	///
+	/// \return score comparable between textures
+	//**************************************************
+	static float LevelValue(
+		const Texture& texture,
+		const uint32_t mip
+	);
+
+	//**************************************************
+	/// \brief Evict the finest level of the least valuable texture
+	///
+	/// \param[in]  maxValue	 ->	only levels worth less than this are evicted
+	/// \param[in]  keep		 ->	texture that is never chosen
+	/// \param[out] evictions	 ->	evicted level is appended
+	///
+	/// \return if a level was evicted then true
+	//**************************************************
+	bool EvictOne(
+		const float maxValue,
+		const uint32_t keep,
+		std::vector<Request>* evictions
+	);
+
+	std::vector<Texture>	m_textures;
+	uint64_t				m_budget;
+	uint64_t				m_residentBytes;
+	uint64_t				m_pendingBytes;		// bytes of loads in flight
+	uint64_t				m_frame;
+};
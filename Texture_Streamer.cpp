@@ -0,0 +1,178 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Texture_Streamer.cpp
+*		Detail	: Mip level streaming on I/O threads under a memory budget
+===================================================================================*/
+#include <algorithm>
+
+#include "Texture_Streamer.h"
+
+const uint32_t TextureStreamer::k_tailSize;
+const uint32_t TextureStreamer::k_maxInFlight;
+const uint32_t TextureStreamer::k_invalidTexture;
+
+/* Constructor */
+TextureStreamer::TextureStreamer(const uint64_t budget, const unsigned int ioThreadNum)
+	:m_inFlight(0),
+	m_quit(false)
+{
+	m_residency.SetBudget(budget);
+
+	// Reads block on the disk, so they get their own threads instead of ThreadPool::Shared
+	const unsigned int workerNum = (std::max)(ioThreadNum, 1u);
+	m_workers.reserve(workerNum);
+	for (unsigned int i = 0; i < workerNum; ++i)
+		m_workers.emplace_back(&TextureStreamer::WorkerMain, this);
+}
+
+/* Destructor */
+TextureStreamer::~TextureStreamer()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_quit = true;
+		m_queue.clear();
+	}
+	m_wakeUp.notify_all();
+
+	for (std::thread& worker : m_workers)
+		worker.join();
+}
+
+/* Register */
+uint32_t TextureStreamer::Register(const wchar_t* fileName)
+{
+	std::unique_ptr<Texture> texture(new Texture());
+	if (!texture->File.Open(fileName))
+		return k_invalidTexture;
+
+	const TextureFile& file	= texture->File;
+	const uint32_t mipNum	= (std::min)(file.MipNum(), TextureResidency::k_maxLevels);
+	uint32_t tailMip		= mipNum - 1;
+	uint64_t levelBytes[TextureResidency::k_maxLevels]{};
+	for (uint32_t i = mipNum; i-- > 0;)
+	{
+		const TextureFile::Level& level = file.GetLevel(i);
+		levelBytes[i] = level.Bytes;
+		if ((std::max)(level.Width, level.Height) <= k_tailSize)
+			tailMip = i;
+	}
+
+	// Tail levels are always resident so something can be drawn right away
+	texture->Levels.resize(mipNum);
+	for (uint32_t i = tailMip; i < mipNum; ++i)
+	{
+		texture->Levels[i].resize(size_t(levelBytes[i]));
+		if (!file.ReadLevel(i, texture->Levels[i].data()))
+			return k_invalidTexture;
+	}
+
+	const uint32_t index = m_residency.Add(levelBytes, mipNum, tailMip);
+	m_textures.push_back(std::move(texture));
+	return index;
+}
+
+/* Begin frame */
+void TextureStreamer::BeginFrame()
+{
+	m_residency.BeginFrame();
+}
+
+/* Request */
+void TextureStreamer::Request(const uint32_t texture, const float projectedWidth, const float projectedHeight)
+{
+	if (texture >= m_textures.size())
+		return;
+
+	const TextureFile& file = m_textures[texture]->File;
+	m_residency.SetDemand(
+		texture,
+		TextureResidency::DesiredMip(file.Width(), file.Height(), projectedWidth, projectedHeight),
+		(std::max)(projectedWidth, 0.0f) * (std::max)(projectedHeight, 0.0f)
+	);
+}
+
+/* Update */
+void TextureStreamer::Update(std::vector<Event>* events)
+{
+	std::vector<Load> completed;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		completed.swap(m_completed);
+	}
+
+	for (Load& load : completed)
+	{
+		const TextureResidency::Request& request = load.Request;
+		m_residency.OnLoaded(request, load.Success);
+		--m_inFlight;
+		if (m_residency.ResidentMip(request.Texture) != request.Mip)
+			continue;
+
+		m_textures[request.Texture]->Levels[request.Mip].swap(load.Data);
+		if (events)
+			events->push_back({ request.Texture, request.Mip, true });
+	}
+
+	m_loads.clear();
+	m_evictions.clear();
+	m_residency.Plan(k_maxInFlight - m_inFlight, &m_loads, &m_evictions);
+
+	for (const TextureResidency::Request& eviction : m_evictions)
+	{
+		std::vector<uint8_t>().swap(m_textures[eviction.Texture]->Levels[eviction.Mip]);
+		if (events)
+			events->push_back({ eviction.Texture, eviction.Mip, false });
+	}
+
+	if (m_loads.empty())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (const TextureResidency::Request& request : m_loads)
+			m_queue.push_back({ request, &m_textures[request.Texture]->File, {}, false });
+	}
+	m_inFlight += uint32_t(m_loads.size());
+	m_wakeUp.notify_all();
+}
+
+/* Wait idle */
+void TextureStreamer::WaitIdle()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_idle.wait(lock, [this] { return m_completed.size() == m_inFlight; });
+}
+
+/* Level data */
+const void* TextureStreamer::LevelData(const uint32_t texture, const uint32_t mip) const
+{
+	if (texture >= m_textures.size() || mip >= m_textures[texture]->Levels.size() || mip < m_residency.ResidentMip(texture))
+		return nullptr;
+	return m_textures[texture]->Levels[mip].data();
+}
+
+// Worker main loop
+void TextureStreamer::WorkerMain()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true)
+	{
+		m_wakeUp.wait(lock, [this] { return m_quit || !m_queue.empty(); });
+		if (m_quit)
+			return;
+
+		Load load = std::move(m_queue.front());
+		m_queue.pop_front();
+		lock.unlock();
+
+		const TextureFile::Level& level = load.File->GetLevel(load.Request.Mip);
+		load.Data.resize(size_t(level.Bytes));
+		load.Success = load.File->ReadLevel(load.Request.Mip, load.Data.data());
+
+		lock.lock();
+		m_completed.push_back(std::move(load));
+		m_idle.notify_all();
+	}
+}
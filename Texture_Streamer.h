@@ -0,0 +1,160 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Texture_Streamer.h
+*		Detail	: Mip level streaming on I/O threads under a memory budget
+===================================================================================*/
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Texture_File.h"
+#include "Texture_Residency.h"
+
+class TextureStreamer
+{
+public:
+	//**************************************************
+	/// \brief Residency change of one level, mirrored by the renderer
+	///        Resident levels are contiguous, so the finest one is the min LOD clamp
+	//**************************************************
+	struct Event
+	{
+		uint32_t	Texture;
+		uint32_t	Mip;
+		bool		Resident;	// true: data is ready to upload, false: level was evicted
+	};
+
+	static const uint32_t k_tailSize		= 64;		// levels this size or smaller load on Register
+	static const uint32_t k_maxInFlight		= 8;		// loads queued or being read
+	static const uint32_t k_invalidTexture	= 0xffffffff;
+
+public:
+	//**************************************************
+	/// \brief Constructor, start I/O threads
+	///
+	/// \param[in] budget		 ->	bytes of streamed and tail levels
+	/// \param[in] ioThreadNum	 ->	number of reader threads
+	///
+	/// \return none
+	//**************************************************
+	TextureStreamer(
+		const uint64_t budget,
+		const unsigned int ioThreadNum = 2
+	);
+
+	//**************************************************
+	/// \brief Destructor, drop queued loads and join I/O threads
+	///
+	/// \return none
+	//**************************************************
+	~TextureStreamer();
+
+	TextureStreamer(const TextureStreamer&)				= delete;
+	TextureStreamer& operator=(const TextureStreamer&)	= delete;
+
+	//**************************************************
+	/// \brief Open texture and read its tail levels on the calling thread
+	///        Call from the thread that calls Update
+	///
+	/// \param[in] fileName	 ->	.dds or .ktx2 file
+	///
+	/// \return texture index, k_invalidTexture on failure
+	//**************************************************
+	uint32_t Register(const wchar_t* fileName);
+
+	//**************************************************
+	/// \brief Start collecting demand of a new frame
+	///
+	/// \return none
+	//**************************************************
+	void BeginFrame();
+
+	//**************************************************
+	/// \brief Request texture for a screen footprint this frame
+	///
+	/// \param[in] texture			 ->	index from Register
+	/// \param[in] projectedWidth	 ->	footprint width in pixels
+	/// \param[in] projectedHeight	 ->	footprint height in pixels
+	///
+	/// \return none
+	//**************************************************
+	void Request(
+		const uint32_t texture,
+		const float projectedWidth,
+		const float projectedHeight
+	);
+
+	//**************************************************
+	/// \brief Apply finished loads, evict to the budget and queue new loads
+	///
+	/// \param[out] events	 ->	residency changes since the last call (may be nullptr)
+	///
+	/// \return none
+	//**************************************************
+	void Update(std::vector<Event>* events);
+
+	//**************************************************
+	/// \brief Block until queued and running loads are finished
+	///
+	/// \return none
+	//**************************************************
+	void WaitIdle();
+
+	//**************************************************
+	/// \brief Pixel data of a resident level
+	///
+	/// \return nullptr when the level is not resident
+	//**************************************************
+	const void* LevelData(
+		const uint32_t texture,
+		const uint32_t mip
+	) const;
+
+	void				SetBudget(uint64_t budget)				{ m_residency.SetBudget(budget); }
+	uint32_t			ResidentMip(uint32_t texture) const		{ return m_residency.ResidentMip(texture); }
+	const TextureFile&	GetFile(uint32_t texture) const			{ return m_textures[texture]->File; }
+	const TextureResidency&	Residency() const					{ return m_residency; }
+
+private:
+	struct Texture
+	{
+		TextureFile							File;
+		std::vector<std::vector<uint8_t>>	Levels;		// empty when not resident
+	};
+
+	struct Load
+	{
+		TextureResidency::Request	Request;
+		const TextureFile*			File;				// textures are never removed
+		std::vector<uint8_t>		Data;
+		bool						Success;
+	};
+
+	//**************************************************
+	/// \brief I/O thread main loop
+	///
+	/// \return none
+	//**************************************************
+	void WorkerMain();
+
+	std::vector<std::unique_ptr<Texture>>	m_textures;
+	TextureResidency						m_residency;
+	std::vector<TextureResidency::Request>	m_loads;		// reused by Update
+	std::vector<TextureResidency::Request>	m_evictions;
+
+	std::vector<std::thread>				m_workers;
+	std::mutex								m_mutex;
+	std::condition_variable					m_wakeUp;
+	std::condition_variable					m_idle;
+	std::deque<Load>						m_queue;		// highest priority first
+	std::vector<Load>						m_completed;
+	uint32_t								m_inFlight;		// queued, reading or completed
+	bool									m_quit;
+};
@@ -0,0 +1,125 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Thread_Pool.cpp
+*		Detail	:
+===================================================================================*/
+#include "Thread_Pool.h"
+
+static thread_local bool s_insideJob = false;	// true while executing a ParallelFor body
+
+/* Constructor */
+ThreadPool::ThreadPool(unsigned int workerNum)
+	:m_func(nullptr),
+	m_context(nullptr),
+	m_count(0),
+	m_next(0),
+	m_done(0),
+	m_generation(0),
+	m_active(0),
+	m_quit(false)
+{
+	if (workerNum == 0)
+	{
+		unsigned int hardware = std::thread::hardware_concurrency();
+		workerNum = hardware > 1 ? hardware - 1 : 0;
+	}
+
+	m_workers.reserve(workerNum);
+	for (unsigned int i = 0; i < workerNum; ++i)
+		m_workers.emplace_back(&ThreadPool::WorkerMain, this);
+}
+
+/* Destructor */
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_quit = true;
+	}
+	m_wakeUp.notify_all();
+
+	for (std::thread& worker : m_workers)
+		worker.join();
+}
+
+/* Shared pool */
+ThreadPool& ThreadPool::Shared()
+{
+	static ThreadPool pool;
+	return pool;
+}
+
+// Dispatch job
+void ThreadPool::Dispatch(const size_t count, JobFunc func, void* context)
+{
+	if (count == 0)
+		return;
+
+	if (m_workers.empty() || count == 1 || s_insideJob)
+	{// Not worth waking anybody
+		for (size_t i = 0; i < count; ++i)
+			func(context, i);
+		return;
+	}
+
+	std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+
+		// Late workers of the previous job may still hold its snapshot
+		m_finished.wait(lock, [this] { return m_active == 0; });
+
+		m_func		= func;
+		m_context	= context;
+		m_count		= count;
+		m_next		= 0;
+		m_done		= 0;
+		++m_generation;
+	}
+	m_wakeUp.notify_all();
+
+	this->Execute();
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_finished.wait(lock, [this] { return m_done.load() == m_count && m_active == 0; });
+}
+
+// Execute current job
+void ThreadPool::Execute()
+{
+	s_insideJob = true;
+
+	size_t index;
+	while ((index = m_next.fetch_add(1)) < m_count)
+	{
+		m_func(m_context, index);
+		m_done.fetch_add(1);
+	}
+
+	s_insideJob = false;
+}
+
+// Worker main loop
+void ThreadPool::WorkerMain()
+{
+	unsigned long long seenGeneration = 0;
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true)
+	{
+		m_wakeUp.wait(lock, [&] { return m_quit || m_generation != seenGeneration; });
+		if (m_quit)
+			return;
+
+		seenGeneration = m_generation;
+		++m_active;
+		lock.unlock();
+
+		this->Execute();
+
+		lock.lock();
+		--m_active;
+		m_finished.notify_all();
+	}
+}
@@ -0,0 +1,113 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Thread_Pool.h
+*		Detail	: Worker threads for data parallel loops
+===================================================================================*/
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+class ThreadPool
+{
+public:
+	//**************************************************
+	/// \brief Constructor
+	///
+	/// \param[in] workerNum	 ->	worker thread count (0 is hardware concurrency - 1)
+	///
+	/// \return none
+	//**************************************************
+	explicit ThreadPool(unsigned int workerNum = 0);
+
+	//**************************************************
+	/// \brief Destructor, join all workers
+	///
+	/// \return none
+	//**************************************************
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&)				= delete;
+	ThreadPool& operator=(const ThreadPool&)	= delete;
+
+	//**************************************************
+	/// \brief Run func(index) for index in [0, count), calling thread joins the work
+	///        Nested calls from inside a job run serially on the calling thread
+	///
+	/// \param[in] count	 ->	number of iterations
+	/// \param[in] func		 ->	callable as void(size_t)
+	///
+	/// \return none
+	//**************************************************
+	template<class Func>
+	void ParallelFor(const size_t count, Func&& func)
+	{
+		using FuncType = typename std::remove_reference<Func>::type;
+		this->Dispatch(
+			count,
+			[](void* context, size_t index) { (*static_cast<FuncType*>(context))(index); },
+			(void*)&func
+		);
+	}
+
+	//**************************************************
+	/// \brief Thread count including the calling thread
+	///
+	/// \return number of threads executing ParallelFor
+	//**************************************************
+	unsigned int ThreadCount() const { return static_cast<unsigned int>(m_workers.size()) + 1; }
+
+	//**************************************************
+	/// \brief Process wide pool shared by asset and culling code
+	///
+	/// \return thread pool
+	//**************************************************
+	static ThreadPool& Shared();
+
+private:
+	using JobFunc = void(*)(void*, size_t);
+
+	//**************************************************
+	/// \brief Publish job to workers and wait for completion
+	///
+	/// \return none
+	//**************************************************
+	void Dispatch(
+		const size_t count,
+		JobFunc func,
+		void* context
+	);
+
+	//**************************************************
+	/// \brief Pull indices of current job until exhausted
+	///
+	/// \return none
+	//**************************************************
+	void Execute();
+
+	//**************************************************
+	/// \brief Worker thread main loop
+	///
+	/// \return none
+	//**************************************************
+	void WorkerMain();
+
+	std::vector<std::thread>	m_workers;
+	std::mutex					m_mutex;
+	std::mutex					m_dispatchMutex;	// serialize ParallelFor callers
+	std::condition_variable		m_wakeUp;
+	std::condition_variable		m_finished;
+	JobFunc						m_func;
+	void*						m_context;
+	size_t						m_count;
+	std::atomic<size_t>			m_next;				// next index to process
+	std::atomic<size_t>			m_done;				// processed index count
+	unsigned long long			m_generation;		// incremented per job
+	unsigned int				m_active;			// workers inside current job
+	bool						m_quit;
+};
+
@@ -0,0 +1,459 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Vertex_Format.cpp
+*		Detail	: Packed 16 byte vertex with per mesh dequantization
+===================================================================================*/
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define VERTEX_FORMAT_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define VERTEX_FORMAT_TARGET_F16C
+#else
+#include <cpuid.h>
+#define VERTEX_FORMAT_TARGET_F16C __attribute__((target("f16c")))
+#endif
+#endif
+
+#include "Vertex_Format.h"
+using namespace DirectX;
+using namespace structure;
+
+static const float k_snorm16Max = 32767.0f;
+static const float k_unorm16Max = 65535.0f;
+static const uint16_t k_halfOne = 0x3c00;
+
+//**************************************************
+/// \brief Float to half, round to nearest even
+//**************************************************
+static uint16_t FloatToHalf(const float value)
+{
+	uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+
+	const uint32_t sign		= (bits >> 16) & 0x8000;
+	const uint32_t exponent	= (bits >> 23) & 0xff;
+	uint32_t mantissa		= bits & 0x7fffff;
+
+	if (exponent == 0xff)	// inf and nan
+		return uint16_t(sign | 0x7c00 | (mantissa ? 0x200 : 0));
+
+	const int halfExponent = int(exponent) - 127 + 15;
+	if (halfExponent >= 31)	// overflow
+		return uint16_t(sign | 0x7c00);
+
+	if (halfExponent <= 0)
+	{// Subnormal half
+		if (halfExponent < -10)
+			return uint16_t(sign);
+
+		mantissa |= 0x800000;
+		const uint32_t shift		= uint32_t(14 - halfExponent);
+		uint32_t half				= mantissa >> shift;
+		const uint32_t remainder	= mantissa & ((1u << shift) - 1);
+		const uint32_t halfway		= 1u << (shift - 1);
+		if (remainder > halfway || (remainder == halfway && (half & 1)))
+			++half;
+		return uint16_t(sign | half);
+	}
+
+	uint32_t half				= (uint32_t(halfExponent) << 10) | (mantissa >> 13);
+	const uint32_t remainder	= mantissa & 0x1fff;
+	if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+		++half;	// carry into the exponent is the correct result
+	return uint16_t(sign | half);
+}
+
+//**************************************************
+/// \brief Half to float
+//**************************************************
+static float HalfToFloat(const uint16_t half)
+{
+	const uint32_t sign	= uint32_t(half & 0x8000) << 16;
+	uint32_t exponent	= (half >> 10) & 0x1f;
+	uint32_t mantissa	= half & 0x3ff;
+	uint32_t bits;
+
+	if (exponent == 0)
+	{
+		if (mantissa == 0)
+		{
+			bits = sign;
+		}
+		else
+		{// Normalize subnormal
+			uint32_t shift = 0;
+			while (!(mantissa & 0x400))
+			{
+				mantissa <<= 1;
+				++shift;
+			}
+			bits = sign | ((127 - 14 - shift) << 23) | ((mantissa & 0x3ff) << 13);
+		}
+	}
+	else if (exponent == 31)
+	{
+		bits = sign | 0x7f800000 | (mantissa << 13) | (mantissa ? 0x400000 : 0);	// nan is quiet like F16C
+	}
+	else
+	{
+		bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+	}
+
+	float value;
+	std::memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+static int16_t ToSnorm16(const float value)
+{
+	return int16_t(std::lround((std::max)(-1.0f, (std::min)(1.0f, value)) * k_snorm16Max));
+}
+
+static float FromSnorm16(const int16_t value)
+{
+	return (std::max)(float(value) / k_snorm16Max, -1.0f);
+}
+
+#if defined(VERTEX_FORMAT_X86)
+//**************************************************
+/// \brief F16C kernels, only called when HasF16C() is true
+//**************************************************
+VERTEX_FORMAT_TARGET_F16C static void EncodeHalfF16C(const float* values, uint16_t* halfs, const size_t count)
+{
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		__m128i low		= _mm_cvtps_ph(_mm_loadu_ps(values + i), _MM_FROUND_TO_NEAREST_INT);
+		__m128i high	= _mm_cvtps_ph(_mm_loadu_ps(values + i + 4), _MM_FROUND_TO_NEAREST_INT);
+		_mm_storeu_si128((__m128i*)(halfs + i), _mm_unpacklo_epi64(low, high));
+	}
+	for (; i < count; ++i)
+		halfs[i] = FloatToHalf(values[i]);
+}
+
+VERTEX_FORMAT_TARGET_F16C static void DecodeHalfF16C(const uint16_t* halfs, float* values, const size_t count)
+{
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		__m128i packed = _mm_loadu_si128((const __m128i*)(halfs + i));
+		_mm_storeu_ps(values + i, _mm_cvtph_ps(packed));
+		_mm_storeu_ps(values + i + 4, _mm_cvtph_ps(_mm_unpackhi_epi64(packed, packed)));
+	}
+	for (; i < count; ++i)
+		values[i] = HalfToFloat(halfs[i]);
+}
+
+//**************************************************
+/// \brief Position and texcoord of one vertex in two conversions
+//**************************************************
+VERTEX_FORMAT_TARGET_F16C static void PackHalfF16C(const Vertex3D* vertices, const size_t vertexNum, const VertexLayout& layout, VertexPacked* packed)
+{
+	const __m128 offset		= _mm_setr_ps(layout.PositionOffset[0], layout.PositionOffset[1], layout.PositionOffset[2], 0.0f);
+	const __m128 invScale	= _mm_setr_ps(1.0f / layout.PositionScale[0], 1.0f / layout.PositionScale[1], 1.0f / layout.PositionScale[2], 0.0f);
+	const __m128 wOne		= _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+	const __m128 uvOffset	= _mm_setr_ps(layout.TexCoordScaleOffset[2], layout.TexCoordScaleOffset[3], 0.0f, 0.0f);
+	const __m128 uvInvScale	= _mm_setr_ps(1.0f / layout.TexCoordScaleOffset[0], 1.0f / layout.TexCoordScaleOffset[1], 0.0f, 0.0f);
+	const bool halfTexCoord	= (layout.TexCoord == VERTEX_TEXCOORD::HALF);
+
+	for (size_t i = 0; i < vertexNum; ++i)
+	{
+		const Vertex3D& vertex = vertices[i];
+		if (layout.Position == VERTEX_POSITION::HALF)
+		{// Lane w reads Normal.x, it is replaced by 1
+			__m128 position = _mm_loadu_ps(&vertex.Position.x);
+			position = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(position, offset), invScale), wOne);
+			_mm_storel_epi64((__m128i*)packed[i].Position, _mm_cvtps_ph(position, _MM_FROUND_TO_NEAREST_INT));
+		}
+		if (halfTexCoord)
+		{
+			__m128 texCoord = _mm_setr_ps(vertex.TexCoord.x, vertex.TexCoord.y, 0.0f, 0.0f);
+			texCoord = _mm_mul_ps(_mm_sub_ps(texCoord, uvOffset), uvInvScale);
+			int bits = _mm_cvtsi128_si32(_mm_cvtps_ph(texCoord, _MM_FROUND_TO_NEAREST_INT));
+			std::memcpy(packed[i].TexCoord, &bits, sizeof(bits));
+		}
+	}
+}
+#endif
+
+/* Create layout */
+VertexLayout VertexFormat::CreateLayout(const Vertex3D* vertices, const size_t vertexNum, const VERTEX_POSITION position, const VERTEX_TEXCOORD texCoord)
+{
+	XMFLOAT3 minimum{ FLT_MAX, FLT_MAX, FLT_MAX }, maximum{ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	XMFLOAT2 uvMinimum{ FLT_MAX, FLT_MAX }, uvMaximum{ -FLT_MAX, -FLT_MAX };
+	for (size_t i = 0; i < vertexNum; ++i)
+	{
+		const Vertex3D& vertex = vertices[i];
+		minimum.x	= (std::min)(minimum.x, vertex.Position.x);
+		minimum.y	= (std::min)(minimum.y, vertex.Position.y);
+		minimum.z	= (std::min)(minimum.z, vertex.Position.z);
+		maximum.x	= (std::max)(maximum.x, vertex.Position.x);
+		maximum.y	= (std::max)(maximum.y, vertex.Position.y);
+		maximum.z	= (std::max)(maximum.z, vertex.Position.z);
+		uvMinimum.x	= (std::min)(uvMinimum.x, vertex.TexCoord.x);
+		uvMinimum.y	= (std::min)(uvMinimum.y, vertex.TexCoord.y);
+		uvMaximum.x	= (std::max)(uvMaximum.x, vertex.TexCoord.x);
+		uvMaximum.y	= (std::max)(uvMaximum.y, vertex.TexCoord.y);
+	}
+	if (vertexNum == 0)
+	{
+		minimum = maximum = XMFLOAT3(0.0f, 0.0f, 0.0f);
+		uvMinimum = uvMaximum = XMFLOAT2(0.0f, 0.0f);
+	}
+
+	// Zero extent would divide by zero, any scale reproduces a flat axis
+	auto extent = [](float low, float high) { return high > low ? (high - low) : 1.0f; };
+
+	VertexLayout layout{};
+	layout.Position	= position;
+	layout.TexCoord	= texCoord;
+
+	// Both encodings are centered, half keeps most precision around zero
+	layout.PositionOffset[0]	= (minimum.x + maximum.x) * 0.5f;
+	layout.PositionOffset[1]	= (minimum.y + maximum.y) * 0.5f;
+	layout.PositionOffset[2]	= (minimum.z + maximum.z) * 0.5f;
+	layout.PositionOffset[3]	= 0.0f;
+	if (position == VERTEX_POSITION::SNORM16)
+	{
+		layout.PositionScale[0]	= extent(minimum.x, maximum.x) * 0.5f;
+		layout.PositionScale[1]	= extent(minimum.y, maximum.y) * 0.5f;
+		layout.PositionScale[2]	= extent(minimum.z, maximum.z) * 0.5f;
+	}
+	else
+	{
+		layout.PositionScale[0]	= 1.0f;
+		layout.PositionScale[1]	= 1.0f;
+		layout.PositionScale[2]	= 1.0f;
+	}
+	layout.PositionScale[3] = 1.0f;
+
+	if (texCoord == VERTEX_TEXCOORD::UNORM16)
+	{
+		layout.TexCoordScaleOffset[0] = extent(uvMinimum.x, uvMaximum.x);
+		layout.TexCoordScaleOffset[1] = extent(uvMinimum.y, uvMaximum.y);
+		layout.TexCoordScaleOffset[2] = uvMinimum.x;
+		layout.TexCoordScaleOffset[3] = uvMinimum.y;
+	}
+	else
+	{
+		layout.TexCoordScaleOffset[0] = 1.0f;
+		layout.TexCoordScaleOffset[1] = 1.0f;
+		layout.TexCoordScaleOffset[2] = 0.0f;
+		layout.TexCoordScaleOffset[3] = 0.0f;
+	}
+
+	return layout;
+}
+
+/* Pack */
+void VertexFormat::Pack(const Vertex3D* vertices, const size_t vertexNum, const VertexLayout& layout, VertexPacked* packed)
+{
+	const float invScale[3]{ 1.0f / layout.PositionScale[0], 1.0f / layout.PositionScale[1], 1.0f / layout.PositionScale[2] };
+	const float uvInvScale[2]{ 1.0f / layout.TexCoordScaleOffset[0], 1.0f / layout.TexCoordScaleOffset[1] };
+
+	bool halfDone = false;
+#if defined(VERTEX_FORMAT_X86)
+	if (VertexFormat::HasF16C())
+	{
+		PackHalfF16C(vertices, vertexNum, layout, packed);
+		halfDone = true;
+	}
+
+	const __m128 offset		= _mm_setr_ps(layout.PositionOffset[0], layout.PositionOffset[1], layout.PositionOffset[2], 0.0f);
+	const __m128 scale		= _mm_setr_ps(invScale[0] * k_snorm16Max, invScale[1] * k_snorm16Max, invScale[2] * k_snorm16Max, 0.0f);
+	const __m128 upper		= _mm_set1_ps(k_snorm16Max);
+	const __m128 lower		= _mm_set1_ps(-k_snorm16Max);
+#endif
+
+	for (size_t i = 0; i < vertexNum; ++i)
+	{
+		const Vertex3D& vertex	= vertices[i];
+		VertexPacked& out		= packed[i];
+
+		if (layout.Position == VERTEX_POSITION::SNORM16)
+		{
+#if defined(VERTEX_FORMAT_X86)
+			// 4 lanes at once, lane w reads Normal.x and is overwritten below
+			__m128 position = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&vertex.Position.x), offset), scale);
+			position = _mm_max_ps(lower, _mm_min_ps(upper, position));
+			__m128i quantized = _mm_cvtps_epi32(position);
+			_mm_storel_epi64((__m128i*)out.Position, _mm_packs_epi32(quantized, quantized));
+#else
+			out.Position[0] = uint16_t(ToSnorm16((vertex.Position.x - layout.PositionOffset[0]) * invScale[0]));
+			out.Position[1] = uint16_t(ToSnorm16((vertex.Position.y - layout.PositionOffset[1]) * invScale[1]));
+			out.Position[2] = uint16_t(ToSnorm16((vertex.Position.z - layout.PositionOffset[2]) * invScale[2]));
+#endif
+			out.Position[3] = uint16_t(int16_t(k_snorm16Max));
+		}
+		else if (!halfDone)
+		{
+			out.Position[0] = FloatToHalf((vertex.Position.x - layout.PositionOffset[0]) * invScale[0]);
+			out.Position[1] = FloatToHalf((vertex.Position.y - layout.PositionOffset[1]) * invScale[1]);
+			out.Position[2] = FloatToHalf((vertex.Position.z - layout.PositionOffset[2]) * invScale[2]);
+			out.Position[3] = k_halfOne;
+		}
+
+		VertexFormat::EncodeOctahedral(vertex.Normal, out.Normal);
+
+		const float u = (vertex.TexCoord.x - layout.TexCoordScaleOffset[2]) * uvInvScale[0];
+		const float v = (vertex.TexCoord.y - layout.TexCoordScaleOffset[3]) * uvInvScale[1];
+		if (layout.TexCoord == VERTEX_TEXCOORD::UNORM16)
+		{
+			out.TexCoord[0] = uint16_t(std::lround((std::max)(0.0f, (std::min)(1.0f, u)) * k_unorm16Max));
+			out.TexCoord[1] = uint16_t(std::lround((std::max)(0.0f, (std::min)(1.0f, v)) * k_unorm16Max));
+		}
+		else if (!halfDone)
+		{
+			out.TexCoord[0] = FloatToHalf(u);
+			out.TexCoord[1] = FloatToHalf(v);
+		}
+	}
+}
+
+/* Unpack */
+void VertexFormat::Unpack(const VertexPacked* packed, const size_t vertexNum, const VertexLayout& layout, Vertex3D* vertices)
+{
+	for (size_t i = 0; i < vertexNum; ++i)
+	{
+		const VertexPacked& in	= packed[i];
+		Vertex3D& vertex		= vertices[i];
+
+		float position[4], texCoord[2];
+		if (layout.Position == VERTEX_POSITION::SNORM16)
+		{
+			for (int axis = 0; axis < 3; ++axis)
+				position[axis] = FromSnorm16(int16_t(in.Position[axis]));
+		}
+		else
+		{
+			VertexFormat::DecodeHalf(in.Position, position, 3);
+		}
+
+		if (layout.TexCoord == VERTEX_TEXCOORD::UNORM16)
+		{
+			texCoord[0] = float(in.TexCoord[0]) / k_unorm16Max;
+			texCoord[1] = float(in.TexCoord[1]) / k_unorm16Max;
+		}
+		else
+		{
+			VertexFormat::DecodeHalf(in.TexCoord, texCoord, 2);
+		}
+
+		vertex.Position.x	= position[0] * layout.PositionScale[0] + layout.PositionOffset[0];
+		vertex.Position.y	= position[1] * layout.PositionScale[1] + layout.PositionOffset[1];
+		vertex.Position.z	= position[2] * layout.PositionScale[2] + layout.PositionOffset[2];
+		vertex.Normal		= VertexFormat::DecodeOctahedral(in.Normal);
+		vertex.TexCoord.x	= texCoord[0] * layout.TexCoordScaleOffset[0] + layout.TexCoordScaleOffset[2];
+		vertex.TexCoord.y	= texCoord[1] * layout.TexCoordScaleOffset[1] + layout.TexCoordScaleOffset[3];
+	}
+}
+
+/* Encode half */
+void VertexFormat::EncodeHalf(const float* values, uint16_t* halfs, const size_t count)
+{
+#if defined(VERTEX_FORMAT_X86)
+	if (VertexFormat::HasF16C())
+	{
+		EncodeHalfF16C(values, halfs, count);
+		return;
+	}
+#endif
+	for (size_t i = 0; i < count; ++i)
+		halfs[i] = FloatToHalf(values[i]);
+}
+
+/* Decode half */
+void VertexFormat::DecodeHalf(const uint16_t* halfs, float* values, const size_t count)
+{
+#if defined(VERTEX_FORMAT_X86)
+	if (count >= 8 && VertexFormat::HasF16C())
+	{
+		DecodeHalfF16C(halfs, values, count);
+		return;
+	}
+#endif
+	for (size_t i = 0; i < count; ++i)
+		values[i] = HalfToFloat(halfs[i]);
+}
+
+/* Encode octahedral */
+void VertexFormat::EncodeOctahedral(const XMFLOAT3& normal, int16_t encoded[2])
+{
+	float length = std::fabs(normal.x) + std::fabs(normal.y) + std::fabs(normal.z);
+	if (length <= 0.0f)
+	{// Zero vector has no direction, store +z
+		encoded[0] = encoded[1] = 0;
+		return;
+	}
+
+	float x = normal.x / length;
+	float y = normal.y / length;
+	if (normal.z < 0.0f)
+	{// Fold lower hemisphere onto the corners
+		float foldX = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+		float foldY = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+		x = foldX;
+		y = foldY;
+	}
+
+	encoded[0] = ToSnorm16(x);
+	encoded[1] = ToSnorm16(y);
+}
+
+/* Decode octahedral */
+XMFLOAT3 VertexFormat::DecodeOctahedral(const int16_t encoded[2])
+{
+	float x = FromSnorm16(encoded[0]);
+	float y = FromSnorm16(encoded[1]);
+	float z = 1.0f - std::fabs(x) - std::fabs(y);
+	float t = (std::max)(-z, 0.0f);
+	x += (x >= 0.0f) ? -t : t;
+	y += (y >= 0.0f) ? -t : t;
+
+	float invLength = 1.0f / std::sqrt(x * x + y * y + z * z);
+	return XMFLOAT3(x * invLength, y * invLength, z * invLength);
+}
+
+/* Has F16C */
+bool VertexFormat::HasF16C()
+{
+#if defined(VERTEX_FORMAT_X86)
+	static const bool supported = []()
+	{
+		unsigned int ecx = 0;
+#if defined(_MSC_VER)
+		int info[4]{};
+		__cpuid(info, 1);
+		ecx = (unsigned int)info[2];
+#else
+		unsigned int eax = 0, ebx = 0, edx = 0;
+		if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+			return false;
+#endif
+		// F16C is VEX encoded, the os must save ymm state (OSXSAVE and XCR0)
+		const bool f16c		= (ecx & (1u << 29)) != 0;
+		const bool osxsave	= (ecx & (1u << 27)) != 0;
+		if (!f16c || !osxsave)
+			return false;
+
+#if defined(_MSC_VER)
+		unsigned long long xcr0 = _xgetbv(0);
+#else
+		unsigned int xcr0Low = 0, xcr0High = 0;
+		__asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+		unsigned long long xcr0 = xcr0Low;
+#endif
+		return (xcr0 & 0x6) == 0x6;
+	}();
+	return supported;
+#else
+	return false;
+#endif
+}
@@ -0,0 +1,158 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: Vertex_Format.h
+*		Detail	: Packed 16 byte vertex with per mesh dequantization
+===================================================================================*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "Graphics_Interface.h"
+
+namespace structure
+{
+	//**************************************************
+	/// \brief Encoding of packed position
+	//**************************************************
+	enum class VERTEX_POSITION
+	{
+		SNORM16,	// R16G16B16A16_SNORM, normalized to the mesh bounds
+		HALF,		// R16G16B16A16_FLOAT, relative to the mesh center
+		NUM
+	};
+
+	//**************************************************
+	/// \brief Encoding of packed texcoord
+	//**************************************************
+	enum class VERTEX_TEXCOORD
+	{
+		HALF,		// R16G16_FLOAT
+		UNORM16,	// R16G16_UNORM, normalized to the mesh texcoord range
+		NUM
+	};
+
+	//**************************************************
+	/// \brief 16 byte vertex (Vertex3D is 32 bytes)
+	//**************************************************
+	struct VertexPacked
+	{
+		uint16_t	Position[4];	// xyz and w = 1, bits of SNORM16 or half
+		int16_t		Normal[2];		// octahedral SNORM16, R16G16_SNORM
+		uint16_t	TexCoord[2];	// bits of half or UNORM16
+	};
+
+	//**************************************************
+	/// \brief Encodings and dequantization of one mesh
+	///        the three float4 match cbuffer g_vertexLayoutBuffer (b3)
+	//**************************************************
+	struct VertexLayout
+	{
+		float			PositionScale[4];		// position = decoded * scale + offset
+		float			PositionOffset[4];
+		float			TexCoordScaleOffset[4];	// texcoord = decoded * xy + zw
+		VERTEX_POSITION	Position;
+		VERTEX_TEXCOORD	TexCoord;
+	};
+}
+
+class VertexFormat
+{
+public:
+	//**************************************************
+	/// \brief Compute dequantization from mesh bounds
+	///
+	/// \param[in] vertices	 ->	source vertices
+	/// \param[in] vertexNum ->	number of vertices
+	/// \param[in] position	 ->	position encoding
+	/// \param[in] texCoord	 ->	texcoord encoding
+	///
+	/// \return layout for Pack, Unpack and IGraphics::SetVertexLayout
+	//**************************************************
+	static structure::VertexLayout CreateLayout(
+		const structure::Vertex3D* vertices,
+		const size_t vertexNum,
+		const structure::VERTEX_POSITION position,
+		const structure::VERTEX_TEXCOORD texCoord
+	);
+
+	//**************************************************
+	/// \brief Convert vertices to packed format
+	///
+	/// \param[in]  vertices  ->	source vertices
+	/// \param[in]  vertexNum ->	number of vertices
+	/// \param[in]  layout	  ->	layout from CreateLayout
+	/// \param[out] packed	  ->	destination, vertexNum elements
+	///
+	/// \return none
+	//**************************************************
+	static void Pack(
+		const structure::Vertex3D* vertices,
+		const size_t vertexNum,
+		const structure::VertexLayout& layout,
+		structure::VertexPacked* packed
+	);
+
+	//**************************************************
+	/// \brief Convert packed vertices back to full precision
+	///
+	/// \param[in]  packed	  ->	source vertices
+	/// \param[in]  vertexNum ->	number of vertices
+	/// \param[in]  layout	  ->	layout used by Pack
+	/// \param[out] vertices  ->	destination, vertexNum elements
+	///
+	/// \return none
+	//**************************************************
+	static void Unpack(
+		const structure::VertexPacked* packed,
+		const size_t vertexNum,
+		const structure::VertexLayout& layout,
+		structure::Vertex3D* vertices
+	);
+
+	//**************************************************
+	/// \brief Float to half, round to nearest even (F16C when available)
+	///
+	/// \return none
+	//**************************************************
+	static void EncodeHalf(
+		const float* values,
+		uint16_t* halfs,
+		const size_t count
+	);
+
+	//**************************************************
+	/// \brief Half to float (F16C when available)
+	///
+	/// \return none
+	//**************************************************
+	static void DecodeHalf(
+		const uint16_t* halfs,
+		float* values,
+		const size_t count
+	);
+
+	//**************************************************
+	/// \brief Unit vector to octahedral SNORM16
+	///
+	/// \return none
+	//**************************************************
+	static void EncodeOctahedral(
+		const DirectX::XMFLOAT3& normal,
+		int16_t encoded[2]
+	);
+
+	//**************************************************
+	/// \brief Octahedral SNORM16 to unit vector
+	///
+	/// \return normal
+	//**************************************************
+	static DirectX::XMFLOAT3 DecodeOctahedral(const int16_t encoded[2]);
+
+	//**************************************************
+	/// \brief Processor supports F16C conversion
+	///
+	/// \return if supported then true
+	//**************************************************
+	static bool HasF16C();
+};
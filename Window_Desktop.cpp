@@ -50,8 +50,8 @@ WindowDesktop::~WindowDesktop()
 bool WindowDesktop::Close()
 {
     MSG msg;
-    if (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
-    {
+    while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
+    {// Drain all queued messages, one per frame falls behind input
         if (msg.message == WM_QUIT)
         {
             return true;
@@ -71,3 +71,16 @@ void* WindowDesktop::GetHandle()
 {
     return m_windowHandle;
 }
+
+/* Minimized */
+bool WindowDesktop::Minimized()
+{
+    return IsIconic(m_windowHandle) != FALSE;
+}
+
+/* Wait event */
+void WindowDesktop::WaitEvent(const unsigned int timeout)
+{
+    // Block the thread without burning cpu until any input or timeout
+    MsgWaitForMultipleObjectsEx(0, nullptr, timeout, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+}
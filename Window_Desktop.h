@@ -52,6 +52,22 @@ public:
 	//**************************************************
 	void* GetHandle() override;
 
+	//**************************************************
+	/// \brief Check window is minimized
+	/// 
+	/// \return if Window minimized then true
+	//**************************************************
+	bool Minimized() override;
+
+	//**************************************************
+	/// \brief Sleep until window message arrives
+	/// 
+	/// \param[in] timeout	 ->	wait time limit (ms)
+	/// 
+	/// \return none
+	//**************************************************
+	void WaitEvent(const unsigned int timeout) override;
+
 private:
 	const HINSTANCE m_hInstance;	// handle instance
 	LPCWSTR			m_className;	// window class name
@@ -12,6 +12,8 @@ public:
 	virtual ~WindowInterface() {}
 	virtual bool Close() = 0;
 	virtual void* GetHandle() = 0;
+	virtual bool Minimized() { return false; }
+	virtual void WaitEvent(const unsigned int timeout) { (void)timeout; }
 
 	//**************************************************
 	/// \brief Get window width of initialized value
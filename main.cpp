@@ -4,7 +4,19 @@
 *		File	: main.cpp
 *		Detail	:
 ===================================================================================*/
+#include <cstdio>
+#include <cstring>
+#include <string>
+
 #include "Application.h"
+#include "Benchmark_Report.h"
+#include "Benchmark_Suite.h"
+#include "Frame_Scheduler.h"
+#include "Profiler.h"
+
+static const double			k_targetFrameRate	= 60.0;			// frame rate limit (0 is vsync only)
+static const double			k_fixedTimeStep		= 1.0 / 60.0;	// simulation step (sec)
+static const unsigned int	k_idleTimeout		= 100;			// wake up interval while idle (ms)
 
 /* main */
 int __stdcall WinMain(
@@ -15,21 +27,54 @@ int __stdcall WinMain(
 )
 {
 	UNREFERENCED_PARAMETER(hPrevInstance);
-	UNREFERENCED_PARAMETER(lpCmdLine);
 	UNREFERENCED_PARAMETER(nCmdShow);
 
+	// Headless benchmark on the cpu backends, no window is created (-benchmark or -benchmark=name)
+	std::string benchmark;
+	if (lpCmdLine && BenchmarkReport::FindOption(lpCmdLine, "benchmark", benchmark))
+		return BenchmarkSuite::Main(benchmark.c_str(), lpCmdLine);
+	if (lpCmdLine && BenchmarkReport::FindSwitch(lpCmdLine, "benchmark"))
+		return BenchmarkSuite::Main("scene", lpCmdLine);
+
 	Application app(1280, 780, hInstance, Application::USING_API_TYPE::DIRECTX_12);
 
+	// Capture chrome trace of the whole session (-trace=file.json)
+	const char* traceOption = lpCmdLine ? std::strstr(lpCmdLine, "-trace=") : nullptr;
+	if (traceOption)
+		Profiler::StartCapture();
+
 	if (app.Init())
 	{
+		FrameScheduler scheduler(k_targetFrameRate, k_fixedTimeStep);
 		while (!app.Close())
 		{
-			app.Upadte();
-			app.Draw();
+			if (app.Idle())
+			{// Nothing visible, block until window events instead of spinning
+				app.WaitEvent(k_idleTimeout);
+				scheduler.Reset();
+				if (app.Minimized())
+					continue;
+			}
+
+			scheduler.BeginFrame();
+			while (scheduler.Step())
+			{
+				app.Upadte();
+			}
+			app.Draw(scheduler.Alpha());
+			scheduler.EndFrame();
 		}
 	}
 
 	app.Uninit();
 
+	if (traceOption)
+	{
+		char fileName[MAX_PATH]{};
+		sscanf_s(traceOption, "-trace=%259s", fileName, (unsigned)_countof(fileName));
+		Profiler::StopCapture(fileName);
+	}
+	Profiler::Shutdown();
+
 	return 0;
 }
\ No newline at end of file
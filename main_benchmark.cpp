@@ -0,0 +1,35 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: main_benchmark.cpp
+*		Detail	: Portable entry point of the headless benchmarks
+===================================================================================*/
+#include <string>
+
+#include "Benchmark_Suite.h"
+#include "Profiler.h"
+
+/* main */
+int main(int argc, char** argv)
+{
+	// First argument names the benchmark, the scene when it is an option
+	int first = 1;
+	const char* name = "scene";
+	if (argc > 1 && argv[1][0] != '-')
+	{
+		name	= argv[1];
+		first	= 2;
+	}
+
+	// Options keep the "-name=value" form of the WinMain command line
+	std::string commandLine;
+	for (int i = first; i < argc; ++i)
+	{
+		commandLine += argv[i];
+		commandLine += ' ';
+	}
+
+	const int exitCode = BenchmarkSuite::Main(name, commandLine.c_str());
+	Profiler::Shutdown();
+	return exitCode;
+}
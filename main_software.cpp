@@ -0,0 +1,134 @@
+/*===================================================================================
+*	Date : 2026/10/19(Mon)
+*		Author	: Gakuto.S
+*		File	: main_software.cpp
+*		Detail	: Portable entry point, renders a cube with the software backend to a file
+===================================================================================*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Graphics_Software.h"
+#include "Profiler.h"
+using namespace DirectX;
+using namespace structure;
+
+namespace
+{
+	//**************************************************
+	/// \brief Cube of 24 vertices, the normal is the color
+	//**************************************************
+	void BuildCube(Vertex3D* vertices, unsigned short* indices)
+	{
+		const XMFLOAT3 normals[6]{ { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+		for (int face = 0; face < 6; ++face)
+		{
+			const XMVECTOR normal	= XMLoadFloat3(&normals[face]);
+			const XMVECTOR up		= face < 2 || face > 3 ? XMVectorSet(0, 1, 0, 0) : XMVectorSet(0, 0, 1, 0);
+			const XMVECTOR side		= XMVector3Cross(up, normal);
+			for (int corner = 0; corner < 4; ++corner)
+			{
+				const float u = (corner & 1) ? 0.5f : -0.5f;
+				const float v = (corner & 2) ? 0.5f : -0.5f;
+				Vertex3D& vertex	= vertices[face * 4 + corner];
+				XMStoreFloat3(&vertex.Position, XMVectorAdd(XMVectorScale(normal, 0.5f), XMVectorAdd(XMVectorScale(side, u), XMVectorScale(up, v))));
+				vertex.Normal		= XMFLOAT3(normals[face].x * 0.5f + 0.5f, normals[face].y * 0.5f + 0.5f, normals[face].z * 0.5f + 0.5f);
+				vertex.TexCoord		= XMFLOAT2(u + 0.5f, v + 0.5f);
+			}
+
+			const unsigned short base = (unsigned short)(face * 4);
+			const unsigned short quad[6]{ 0, 1, 3, 3, 2, 0 };
+			for (int i = 0; i < 6; ++i)
+				indices[face * 6 + i] = (unsigned short)(base + quad[i]);
+		}
+	}
+
+	//**************************************************
+	/// \brief Write color target as 32 bit top down TGA
+	///
+	/// \return Success is true
+	//**************************************************
+	bool WriteTga(const char* fileName, const GraphicsSoftware& graphics)
+	{
+		FILE* file = std::fopen(fileName, "wb");
+		if (!file)
+			return false;
+
+		const int width		= graphics.Width();
+		const int height	= graphics.Height();
+		uint8_t header[18]{};
+		header[2]	= 2;	// uncompressed true color
+		header[12]	= uint8_t(width);
+		header[13]	= uint8_t(width >> 8);
+		header[14]	= uint8_t(height);
+		header[15]	= uint8_t(height >> 8);
+		header[16]	= 32;
+		header[17]	= 0x28;	// 8 alpha bits, first row is the top
+		bool success = std::fwrite(header, sizeof(header), 1, file) == 1;
+
+		// B8G8R8A8 is the byte order of TGA already
+		for (int y = 0; y < height && success; ++y)
+			success = std::fwrite(graphics.ColorBuffer() + size_t(y) * graphics.Stride(), sizeof(uint32_t), size_t(width), file) == size_t(width);
+
+		std::fclose(file);
+		return success;
+	}
+}
+
+/* main */
+int main(int argc, char** argv)
+{
+	int width				= 640;
+	int height				= 360;
+	unsigned int frameNum	= 1;
+	const char* output		= "software.tga";
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strncmp(argv[i], "-width=", 7) == 0)			width		= std::atoi(argv[i] + 7);
+		else if (std::strncmp(argv[i], "-height=", 8) == 0)		height		= std::atoi(argv[i] + 8);
+		else if (std::strncmp(argv[i], "-frames=", 8) == 0)		frameNum	= (unsigned int)(std::strtoul(argv[i] + 8, nullptr, 10));
+		else if (std::strncmp(argv[i], "-out=", 5) == 0)		output		= argv[i] + 5;
+	}
+
+	GraphicsSoftware graphics;
+	if (!graphics.Init(width, height, nullptr))
+		return 1;
+
+	Vertex3D vertices[24];
+	unsigned short indices[36];
+	BuildCube(vertices, indices);
+
+	XMFLOAT4X4 view, projection, world;
+	XMStoreFloat4x4(&view, XMMatrixLookAtLH(XMVectorSet(0.0f, 1.0f, -2.5f, 1.0f), XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f)));
+	XMStoreFloat4x4(&projection, XMMatrixPerspectiveFovLH(XM_PI / 3.0f, float(width) / float(height), 0.1f, 100.0f));
+
+	// Last frame is the image, every frame turns the cube a little
+	for (unsigned int frame = 0; frame < (frameNum ? frameNum : 1); ++frame)
+	{
+		XMStoreFloat4x4(&world, XMMatrixRotationY(0.6f + 0.1f * float(frame)));
+
+		graphics.Clear();
+		graphics.SetCamera(view, projection);
+		graphics.SetVertexBuffer(vertices, 24);
+		graphics.SetIndexBuffer(indices, 36);
+		graphics.SetObjectConstants(world, XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f));
+		graphics.DrawIndexed(36, 0, 0);
+		graphics.Present();
+	}
+
+	// An image of only the clear color means the pipeline is broken
+	const uint32_t clearColor = graphics.ColorBuffer()[0];
+	size_t covered = 0;
+	for (int y = 0; y < height; ++y)
+	{
+		for (int x = 0; x < width; ++x)
+			covered += graphics.ColorBuffer()[size_t(y) * graphics.Stride() + x] != clearColor ? 1 : 0;
+	}
+	std::printf("%s: %dx%d, %zu pixels covered\n", output, width, height, covered);
+
+	const bool written = WriteTga(output, graphics);
+	graphics.Uninit();
+	Profiler::Shutdown();
+
+	return written && covered > 0 ? 0 : 1;
+}
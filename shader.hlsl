@@ -11,17 +11,34 @@ struct VS_INPUT
     float2 TexCoord : TEXCOORD;
 };
 
-cbuffer g_worldBuffer : register(b0)
+/* Grouped by update frequency, layouts match Graphics_Constants.h */
+cbuffer g_objectBuffer : register(b0)
 {
-    matrix world;
+    row_major matrix world;
+    float4 materialColor;
 };
-cbuffer g_viewBuffer : register(b1)
+cbuffer g_frameBuffer : register(b1)
 {
-    matrix view;
+    row_major matrix viewProjection;    // view * projection on the cpu, once per frame
+    float4 cameraPosition;
 };
-cbuffer g_projectionBuffer : register(b2)
+cbuffer g_passBuffer : register(b2)
 {
-    matrix projection;
+    float4 viewportSize;                // width, height, 1 / width, 1 / height
+};
+cbuffer g_vertexLayoutBuffer : register(b3)
+{
+    float4 positionScale;       // position = decoded * scale + offset
+    float4 positionOffset;
+    float4 texCoordScaleOffset; // texcoord = decoded * xy + zw
+};
+
+/* Packed vertex, the input assembler already converts SNORM16 / UNORM16 / half to float */
+struct VS_INPUT_PACKED
+{
+    float4 Position : POSITION;
+    float2 Normal   : NORMAL;   // octahedral
+    float2 TexCoord : TEXCOORD;
 };
 
 struct PS_INPUT
@@ -29,23 +46,40 @@ struct PS_INPUT
     float4 Position : SV_Position;
     float4 Normal   : NORMAL;
     float2 TexCoord : TEXCOORD;
+    float4 Color    : COLOR;
 };
 
 PS_INPUT vsmain(VS_INPUT input)
 {
     PS_INPUT output;
-    float4 worldPosition    = mul(input.Position, world);
-    matrix viewProjection   = mul(view, projection);
+    float4 worldPosition    = mul(float4(input.Position.xyz, 1.0f), world);
     
     /* These params send to pixel shader*/
-    //output.Position         = mul(worldPosition, viewProjection);
-    output.Position         = input.Position;
+    output.Position         = mul(worldPosition, viewProjection);
     output.Normal           = input.Normal;
     output.TexCoord         = input.TexCoord;
+    output.Color            = materialColor;
     
 	return output;
 }
 
+float3 DecodeOctahedral(float2 encoded)
+{
+    float3 normal   = float3(encoded, 1.0f - abs(encoded.x) - abs(encoded.y));
+    float t         = saturate(-normal.z);
+    normal.xy       += (normal.xy >= 0.0f) ? -t : t;
+    return normalize(normal);
+}
+
+PS_INPUT vsmain_packed(VS_INPUT_PACKED input)
+{
+    VS_INPUT unpacked;
+    unpacked.Position   = float4(input.Position.xyz * positionScale.xyz + positionOffset.xyz, 1.0f);
+    unpacked.Normal     = float4(DecodeOctahedral(input.Normal), 0.0f);
+    unpacked.TexCoord   = input.TexCoord * texCoordScaleOffset.xy + texCoordScaleOffset.zw;
+    return vsmain(unpacked);
+}
+
 /*===================================================================================
 *	Date : 2022/10/14(Fri)
 *		Author	: Gakuto.S
@@ -59,5 +93,5 @@ float4 psmain(PS_INPUT input) : SV_TARGET
 {
     // float4 texColor = g_texture.Sample(g_sampler, input.TexCoord);
     
-    return float4(input.Normal.rgb, 1.0f);
+    return float4(input.Normal.rgb * input.Color.rgb, 1.0f);
 }
\ No newline at end of file